@@ -0,0 +1,478 @@
+/*
+ * bench - runs identical workloads against str and other string libraries.
+ *
+ * Usage: bench [corpus options] [--reps N] [--json FILE] [--impl NAME]
+ *              [--pin CPU] [--warmup N] [--baseline FILE] [--alpha P] [--threshold PCT]
+ *
+ * The corpus comes from corpus.h (corpusgen writes the same text for a
+ * given set of options), so two runs with the same options measure exactly
+ * the same work. Results are printed as a table, and as JSON when --json
+ * is given ("-" for stdout).
+ *
+ * With --baseline, the samples of every run are compared against those
+ * saved in an earlier --json file. Outliers are dropped from both sides and
+ * a run counts as a regression when the one-sided Mann-Whitney p-value is
+ * below --alpha and the median slowed down by more than --threshold percent.
+ * The exit status is 3 if any run regressed.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "corpus.h"
+#include "stats.h"
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+static const char *const workload_names[BENCH_WORKLOADS] = {
+	"append", "replace", "casefold", "split", "lines", "logfmt", "headers",
+};
+
+static const struct bench_impl *const impls[] = {
+	&bench_str_impl,
+	&bench_naive_impl,
+#ifdef STRUTIL_BENCH_STD
+	&bench_std_impl,
+#endif
+#ifdef STRUTIL_BENCH_SDS
+	&bench_sds_impl,
+#endif
+};
+#define NIMPLS (sizeof(impls) / sizeof(impls[0]))
+
+struct result {
+	double	*ms;		/* one sample per repetition */
+	double	median;		/* of the samples left after outlier rejection */
+	double	min;
+	size_t	kept;
+	uint64_t checksum;
+	int	match;		/* same checksum as the first implementation */
+};
+
+static double now_ms(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+/* Splits @text on ' ' and '\n' into the word arrays of @in. */
+static int split_words(struct bench_input *in, const char *text, size_t len)
+{
+	const char **words = (const char **)malloc((len / 2 + 1) * sizeof(*words));
+	size_t *lens = (size_t *)malloc((len / 2 + 1) * sizeof(*lens));
+	size_t n = 0, start = 0;
+
+	if (!words || !lens) {
+		free(words);
+		free(lens);
+		return -1;
+	}
+
+	for (size_t i = 0; i <= len; i++) {
+		if (i < len && text[i] != ' ' && text[i] != '\n')
+			continue;
+		if (i > start) {
+			words[n] = text + start;
+			lens[n++] = i - start;
+		}
+		start = i + 1;
+	}
+
+	in->words = words;
+	in->word_lens = lens;
+	in->nwords = n;
+	return 0;
+}
+
+/*
+ * Builds the inputs of the parsing workloads from the corpus words: at least
+ * @size bytes of logfmt lines shaped like our service logs, and as much of
+ * HTTP request header blocks.
+ */
+static int make_records(struct bench_input *in, size_t size)
+{
+	static const char *const levels[] = { "info", "info", "info", "warn", "error", "debug" };
+	char *logfmt = (char *)malloc(size + 1024), *headers = (char *)malloc(size + 1024);
+	size_t k = 0, n = 0;
+
+	if (!logfmt || !headers || !in->nwords) {
+		free(logfmt);
+		free(headers);
+		return -1;
+	}
+
+#define W(i)	(int)in->word_lens[(k + (i)) % in->nwords], in->words[(k + (i)) % in->nwords]
+	for (size_t line = 0; n < size; line++, k += 7) {
+		n += (size_t)sprintf(logfmt + n,
+			"ts=2024-05-01T12:%02zu:%02zu.%03zuZ level=%s svc=%.*s req_id=%.*s-%zu "
+			"msg=\"%.*s %.*s %.*s\" user=%.*s latency_ms=%zu path=/%.*s/%.*s",
+			line / 60 % 60, line % 60, line % 1000, levels[line % 6], W(0), W(1), line,
+			W(2), W(3), W(4), W(5), line * 7 % 1000, W(6), W(0));
+		if (line % 8 == 0)
+			n += (size_t)sprintf(logfmt + n, " err=\"%.*s \\\"%.*s\\\" failed\"", W(1), W(2));
+		if (line % 5 == 0)
+			n += (size_t)sprintf(logfmt + n, " cached");
+		logfmt[n++] = '\n';
+	}
+	logfmt[n] = '\0';
+	in->logfmt = logfmt;
+	in->logfmt_len = n;
+
+	n = 0;
+	for (size_t req = 0; n < size; req++, k += 5)
+		n += (size_t)sprintf(headers + n,
+			"Host: %.*s.example.org\r\nUser-Agent: %.*s/%zu.%zu\r\n"
+			"Accept: text/html, application/json;q=0.9\r\nAccept-Language: en-US,en;q=0.5\r\n"
+			"Cookie: session=%.*s; theme=%.*s\r\nX-Request-Id: %.*s-%zu\r\n"
+			"Content-Length: %zu\r\n\r\n",
+			W(0), W(1), req % 10, req % 7, W(2), W(3), W(4), req, req * 13 % 4096);
+#undef W
+	in->headers = headers;
+	in->headers_len = n;
+	return 0;
+}
+
+/* Pins the process to @cpu so runs do not migrate between cores. */
+static int pin_cpu(int cpu)
+{
+#ifdef __linux__
+	cpu_set_t set;
+
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return sched_setaffinity(0, sizeof(set), &set);
+#else
+	(void)cpu;
+	fprintf(stderr, "bench: --pin is not supported on this platform\n");
+	return 0;
+#endif
+}
+
+static char *read_file(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	char *buf = NULL;
+	size_t len = 0, cap = 0, n;
+
+	if (!f)
+		return NULL;
+
+	do {
+		if (cap - len < 4096) {
+			char *tmp = (char *)realloc(buf, cap = cap ? cap * 2 : 65536);
+			if (!tmp) {
+				free(buf);
+				fclose(f);
+				return NULL;
+			}
+			buf = tmp;
+		}
+		n = fread(buf + len, 1, cap - len - 1, f);
+		len += n;
+	} while (n);
+
+	buf[len] = '\0';
+	fclose(f);
+	return buf;
+}
+
+/* Returns the value following "@key": in the JSON object starting at @p. */
+static const char *json_field(const char *p, const char *key)
+{
+	char pat[64];
+
+	snprintf(pat, sizeof(pat), "\"%s\": ", key);
+	p = strstr(p, pat);
+	return p ? p + strlen(pat) : NULL;
+}
+
+/*
+ * baseline_samples - finds the samples of one run in a baseline written by --json
+ * @json: baseline file contents
+ * @workload: workload name
+ * @impl: implementation name
+ * @out: receives a malloc'd array of samples
+ *
+ * Return: the number of samples, or 0 if the run is not in the baseline.
+ */
+static size_t baseline_samples(const char *json, const char *workload, const char *impl, double **out)
+{
+	char pat[128];
+	const char *p;
+
+	snprintf(pat, sizeof(pat), "{\"workload\": \"%s\", \"impl\": \"%s\",", workload, impl);
+	if (!(p = strstr(json, pat)) || !(p = json_field(p, "samples_ms")))
+		return 0;
+
+	const char *end = strchr(p, ']');
+	size_t n = 0, cap = 0;
+	double *v = NULL;
+
+	for (p++; end && p < end; p++) {
+		char *next;
+		double x = strtod(p, &next);
+		if (next == p)
+			break;
+		if (n == cap) {
+			double *tmp = (double *)realloc(v, (cap = cap ? cap * 2 : 16) * sizeof(*v));
+			if (!tmp)
+				break;
+			v = tmp;
+		}
+		v[n++] = x;
+		p = next;
+	}
+
+	*out = v;
+	return n;
+}
+
+/* One-line summary of everything that shapes the corpus; baselines must match it. */
+static void describe_corpus(const struct corpus_opts *o, char *buf, size_t n)
+{
+	snprintf(buf, n, "seed=%llu size=%zu vocab=%zu zipf=%g lines=%zu:%zu%s utf8=%u "
+		 "needle=%s density=%u adversarial=%zu/%u",
+		 (unsigned long long)o->seed, o->size, o->vocab, o->zipf, o->line_min, o->line_max,
+		 o->lines == CORPUS_LINES_GEOMETRIC ? "g" : "", o->utf8_pct,
+		 o->needle, o->needle_permille, o->adv_len, o->adv_pct);
+}
+
+static void print_json(FILE *out, const char *corpus, int reps, struct result res[][NIMPLS])
+{
+	fprintf(out, "{\n  \"corpus\": \"%s\",\n  \"reps\": %d,\n  \"results\": [", corpus, reps);
+
+	const char *sep = "\n";
+	for (int w = 0; w < BENCH_WORKLOADS; w++) {
+		for (size_t i = 0; i < NIMPLS; i++) {
+			struct result *r = &res[w][i];
+			if (!r->ms)
+				continue;
+
+			fprintf(out, "%s    {\"workload\": \"%s\", \"impl\": \"%s\", \"median_ms\": %.6f, "
+				"\"min_ms\": %.6f, \"checksum\": \"%016llx\", \"match\": %s, \"samples_ms\": [",
+				sep, workload_names[w], impls[i]->name, r->median, r->min,
+				(unsigned long long)r->checksum, r->match ? "true" : "false");
+			for (int k = 0; k < reps; k++)
+				fprintf(out, "%s%.6f", k ? ", " : "", r->ms[k]);
+			fprintf(out, "]}");
+			sep = ",\n";
+		}
+	}
+	fprintf(out, "\n  ]\n}\n");
+}
+
+int main(int argc, char **argv)
+{
+	struct corpus_opts opts;
+	int reps = 5, warmup = 1, cpu = -1;
+	double alpha = 0.01, threshold = 2.0;
+	const char *json = NULL, *only = NULL, *baseline = NULL;
+
+	corpus_defaults(&opts, 1, 1 << 20);
+	opts.needle_permille = 2;
+
+	for (int i = 1; i < argc; i++) {
+		if (corpus_parse_arg(&opts, argc, argv, &i))
+			continue;
+		else if (!strcmp(argv[i], "--reps") && i + 1 < argc)
+			reps = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--json") && i + 1 < argc)
+			json = argv[++i];
+		else if (!strcmp(argv[i], "--impl") && i + 1 < argc)
+			only = argv[++i];
+		else if (!strcmp(argv[i], "--pin") && i + 1 < argc)
+			cpu = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--warmup") && i + 1 < argc)
+			warmup = atoi(argv[++i]);
+		else if (!strcmp(argv[i], "--baseline") && i + 1 < argc)
+			baseline = argv[++i];
+		else if (!strcmp(argv[i], "--alpha") && i + 1 < argc)
+			alpha = atof(argv[++i]);
+		else if (!strcmp(argv[i], "--threshold") && i + 1 < argc)
+			threshold = atof(argv[++i]);
+		else {
+			fprintf(stderr, "usage: %s " CORPUS_USAGE "\n"
+				"       [--reps N] [--json FILE] [--impl NAME] [--pin CPU] [--warmup N]\n"
+				"       [--baseline FILE] [--alpha P] [--threshold PCT]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (opts.size < 2 || reps < 1 || opts.vocab < 1 || warmup < 0) {
+		fprintf(stderr, "bench: --size, --vocab and --reps must be positive\n");
+		return 2;
+	}
+	if (opts.needle && (!*opts.needle || strpbrk(opts.needle, "#\"\\ \n"))) {
+		fprintf(stderr, "bench: --needle must be a non-empty word without '#', '\"' or '\\'\n");
+		return 2;
+	}
+	if (cpu >= 0 && pin_cpu(cpu)) {
+		perror("bench: --pin");
+		return 1;
+	}
+
+	/*
+	 * The needle defaults to a frequent vocabulary word. The replacement is
+	 * one '#' longer, so replacing grows the text and can never create a
+	 * new match.
+	 */
+	struct bench_input in;
+	char needle[CORPUS_WORD_MAX + 1], path[] = "/tmp/strutil_bench_XXXXXX";
+
+	if (!opts.needle) {
+		needle[corpus_word(opts.seed, 7, needle)] = '\0';
+		opts.needle = needle;
+	}
+
+	size_t needle_len = strlen(opts.needle);
+	char *repl = (char *)malloc(needle_len + 2);
+	char corpus[512];
+
+	if (!repl) {
+		perror("bench");
+		return 1;
+	}
+	memset(repl, '#', needle_len + 1);
+	repl[needle_len + 1] = '\0';
+	describe_corpus(&opts, corpus, sizeof(corpus));
+
+	char *base = NULL;
+	if (baseline) {
+		const char *field;
+
+		if (!(base = read_file(baseline))) {
+			perror(baseline);
+			return 1;
+		}
+		field = json_field(base, "corpus");
+		if (!field || strncmp(field + 1, corpus, strlen(corpus)) || field[1 + strlen(corpus)] != '"') {
+			fprintf(stderr, "bench: %s was recorded with different corpus options\n", baseline);
+			return 2;
+		}
+	}
+
+	char *text = corpus_generate(&opts);
+	if (!text) {
+		perror("bench");
+		return 1;
+	}
+
+	size_t size = opts.size;
+	int fd = mkstemp(path);
+
+	memset(&in, 0, sizeof(in));
+	if (fd < 0 || write(fd, text, size) != (ssize_t)size || split_words(&in, text, size) ||
+	    make_records(&in, size)) {
+		perror("bench");
+		return 1;
+	}
+	close(fd);
+
+	in.text = text;
+	in.text_len = size;
+	in.needle = opts.needle;
+	in.repl = repl;
+	in.path = path;
+
+	static struct result res[BENCH_WORKLOADS][NIMPLS];
+	int mismatch = 0, regressed = 0;
+
+	printf("%-10s %-12s %12s %12s %10s %5s  %s\n", "workload", "impl", "median ms", "min ms", "MB/s",
+	       "kept", "check");
+	for (int w = 0; w < BENCH_WORKLOADS; w++) {
+		struct result *ref = NULL;
+		size_t bytes = w == BENCH_LOGFMT ? in.logfmt_len : w == BENCH_HEADERS ? in.headers_len : size;
+
+		for (size_t i = 0; i < NIMPLS; i++) {
+			struct result *r = &res[w][i];
+			bench_fn fn = impls[i]->fn[w];
+			if (!fn || (only && strcmp(only, impls[i]->name)))
+				continue;
+
+			r->ms = (double *)calloc((size_t)reps, sizeof(double));
+			double *sorted = (double *)calloc((size_t)reps, sizeof(double));
+			if (!r->ms || !sorted) {
+				perror("bench");
+				return 1;
+			}
+
+			for (int k = 0; k < warmup; k++)
+				fn(&in);	/* warm caches and the allocator */
+			for (int k = 0; k < reps; k++) {
+				double t0 = now_ms();
+				r->checksum = fn(&in);
+				r->ms[k] = now_ms() - t0;
+			}
+
+			memcpy(sorted, r->ms, (size_t)reps * sizeof(double));
+			r->kept = stats_filter(sorted, (size_t)reps);
+			r->median = stats_quantile(sorted, r->kept, 0.5);
+			r->min = sorted[0];
+			if (!ref)
+				ref = r;
+			r->match = r->checksum == ref->checksum;
+			mismatch |= !r->match;
+
+			printf("%-10s %-12s %12.3f %12.3f %10.1f %2zu/%-2d  %s\n", workload_names[w], impls[i]->name,
+			       r->median, r->min, (double)bytes / 1e3 / r->median, r->kept, reps,
+			       r->match ? "ok" : "MISMATCH");
+
+			if (base) {
+				double *old = NULL;
+				size_t nold = baseline_samples(base, workload_names[w], impls[i]->name, &old);
+
+				if (!nold) {
+					printf("%-10s %-12s   not in baseline\n", "", "");
+				} else {
+					nold = stats_filter(old, nold);
+
+					double old_median = stats_quantile(old, nold, 0.5);
+					double change = (r->median / old_median - 1.0) * 100.0;
+					double p = stats_mann_whitney(sorted, r->kept, old, nold);
+					int slower = p < alpha && change > threshold;
+
+					printf("%-10s %-12s   vs baseline %12.3f ms  %+6.1f%%  p=%.4f  %s\n", "", "",
+					       old_median, change, p, slower ? "REGRESSION" : "ok");
+					regressed |= slower;
+				}
+				free(old);
+			}
+			free(sorted);
+		}
+	}
+
+	if (json) {
+		FILE *out = strcmp(json, "-") ? fopen(json, "w") : stdout;
+		if (!out) {
+			perror(json);
+			return 1;
+		}
+		print_json(out, corpus, reps, res);
+		if (out != stdout)
+			fclose(out);
+	}
+
+	unlink(path);
+	for (int w = 0; w < BENCH_WORKLOADS; w++)
+		for (size_t i = 0; i < NIMPLS; i++)
+			free(res[w][i].ms);
+	free((void *)in.words);
+	free((void *)in.word_lens);
+	free((void *)in.logfmt);
+	free((void *)in.headers);
+	free(text);
+	free(base);
+	free(repl);
+	if (mismatch)
+		return 1;
+	return regressed ? 3 : 0;
+}
@@ -0,0 +1,80 @@
+#ifndef _STRUTIL_BENCH_H_
+#define _STRUTIL_BENCH_H_ 1
+
+/*
+ * Shared definitions of the comparative benchmark.
+ *
+ * Every implementation runs the same workloads on the same input and
+ * returns a checksum of its result, so that the driver can verify that
+ * all of them did the same work before comparing their times.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum bench_workload {
+	BENCH_APPEND,	/* append every word of the corpus to one string */
+	BENCH_REPLACE,	/* replace every occurrence of a needle */
+	BENCH_CASEFOLD,	/* lowercase a copy of the corpus */
+	BENCH_SPLIT,	/* split the corpus into words */
+	BENCH_LINES,	/* read the corpus file line by line */
+	BENCH_LOGFMT,	/* split logfmt lines into key/value pairs */
+	BENCH_HEADERS,	/* split blocks of HTTP headers into name/value pairs */
+	BENCH_WORKLOADS
+};
+
+struct bench_input {
+	const char *text;	/* the corpus */
+	size_t	text_len;
+	const char *const *words;	/* the corpus split on ' ' and '\n' */
+	const size_t *word_lens;
+	size_t	nwords;
+	const char *needle;	/* BENCH_REPLACE */
+	const char *repl;
+	const char *path;	/* the corpus written to a file */
+	const char *logfmt;	/* BENCH_LOGFMT: log lines made of corpus words */
+	size_t	logfmt_len;
+	const char *headers;	/* BENCH_HEADERS: header blocks made of corpus words */
+	size_t	headers_len;
+};
+
+typedef uint64_t (*bench_fn)(const struct bench_input *in);
+
+struct bench_impl {
+	const char *name;
+	bench_fn fn[BENCH_WORKLOADS];	/* NULL if not supported */
+};
+
+extern const struct bench_impl bench_str_impl;
+extern const struct bench_impl bench_naive_impl;
+extern const struct bench_impl bench_std_impl;
+extern const struct bench_impl bench_sds_impl;
+
+/* Cheap order-sensitive checksum of a result string. */
+static inline uint64_t bench_checksum(const char *s, size_t n)
+{
+	uint64_t h = 1469598103934665603ull ^ n;
+	size_t step = n / 64 + 1;
+
+	for (size_t i = 0; i < n; i += step)
+		h = (h ^ (unsigned char)s[i]) * 1099511628211ull;
+	return h;
+}
+
+/* Folds one parsed key/value pair into a checksum. */
+static inline uint64_t bench_kv_sum(uint64_t sum, size_t key_len, const char *val, size_t val_len)
+{
+	sum = sum * 31 + key_len;
+	sum = sum * 31 + val_len;
+	return val_len ? sum * 31 + (unsigned char)val[0] : sum;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _STRUTIL_BENCH_H_ */
@@ -0,0 +1,183 @@
+/*
+ * Naive C baseline: what the workloads look like written directly against
+ * libc, with an exact-size realloc per append and no buffer reuse.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+
+static uint64_t naive_append(const struct bench_input *in)
+{
+	char *s = NULL;
+	size_t len = 0;
+
+	for (size_t i = 0; i < in->nwords; i++) {
+		size_t n = in->word_lens[i];
+		s = (char *)realloc(s, len + n + 2);
+		memcpy(s + len, in->words[i], n);
+		len += n;
+		s[len++] = ' ';
+		s[len] = '\0';
+	}
+
+	uint64_t sum = bench_checksum(s, len);
+	free(s);
+	return sum;
+}
+
+static uint64_t naive_replace(const struct bench_input *in)
+{
+	size_t nlen = strlen(in->needle), rlen = strlen(in->repl);
+	char *s = strdup(in->text);
+	char *p;
+
+	while ((p = strstr(s, in->needle)) != NULL) {
+		size_t len = strlen(s);
+		char *t = (char *)malloc(len - nlen + rlen + 1);
+		size_t off = (size_t)(p - s);
+
+		memcpy(t, s, off);
+		memcpy(t + off, in->repl, rlen);
+		strcpy(t + off + rlen, p + nlen);
+		free(s);
+		s = t;
+	}
+
+	uint64_t sum = bench_checksum(s, strlen(s));
+	free(s);
+	return sum;
+}
+
+static uint64_t naive_casefold(const struct bench_input *in)
+{
+	char *s = strdup(in->text);
+
+	for (char *p = s; *p; p++)
+		*p = (char)tolower((unsigned char)*p);
+
+	uint64_t sum = bench_checksum(s, in->text_len);
+	free(s);
+	return sum;
+}
+
+static uint64_t naive_split(const struct bench_input *in)
+{
+	const char *p = in->text, *end = in->text + in->text_len;
+	uint64_t sum = 0;
+
+	for (;;) {
+		const char *q = p;
+		while (q < end && *q != ' ' && *q != '\n')
+			q++;
+
+		char *tok = (char *)malloc((size_t)(q - p) + 1);
+		memcpy(tok, p, (size_t)(q - p));
+		tok[q - p] = '\0';
+		sum = sum * 31 + strlen(tok);
+		free(tok);
+
+		if (q == end)
+			break;
+		p = q + 1;
+	}
+	return sum;
+}
+
+static uint64_t naive_lines(const struct bench_input *in)
+{
+	FILE *f = fopen(in->path, "r");
+	char *line = NULL;
+	size_t len = 0, cap = 0;
+	uint64_t sum = 0;
+	int c;
+
+	if (!f)
+		return 0;
+
+	while ((c = fgetc(f)) != EOF) {
+		if (c == '\n') {
+			sum = sum * 31 + len;
+			len = 0;
+			continue;
+		}
+		if (len + 1 >= cap) {
+			cap = cap ? cap * 2 : 64;
+			line = (char *)realloc(line, cap);
+		}
+		line[len++] = (char)c;
+	}
+
+	free(line);
+	fclose(f);
+	return sum;
+}
+
+static uint64_t naive_logfmt(const struct bench_input *in)
+{
+	const char *p = in->logfmt;
+	uint64_t sum = 0;
+
+	while (*p) {
+		while (*p == ' ')
+			p++;
+		if (*p == '\n') {
+			p++;
+			continue;
+		}
+
+		const char *val = p;
+		size_t key_len = strcspn(p, " =\n"), val_len = 0;
+
+		p += key_len;
+		if (*p == '=' && p[1] == '"') {
+			const char *q = p + 2;
+
+			while ((q = strchr(q, '"')) != NULL && q[-1] == '\\')
+				q++;
+			if (!q)
+				break;
+			val = p + 2;
+			val_len = (size_t)(q - val);
+			p = q + 1;
+		} else if (*p == '=') {
+			val = ++p;
+			val_len = strcspn(p, " \n");
+			p += val_len;
+		}
+		sum = bench_kv_sum(sum, key_len, val, val_len);
+	}
+	return sum;
+}
+
+static uint64_t naive_headers(const struct bench_input *in)
+{
+	const char *p = in->headers, *eol;
+	uint64_t sum = 0;
+
+	while ((eol = strstr(p, "\r\n")) != NULL) {
+		if (eol == p) {		/* the empty line after a block */
+			p += 2;
+			continue;
+		}
+
+		const char *colon = strchr(p, ':'), *val = colon + 1, *end = eol;
+
+		while (val < end && (*val == ' ' || *val == '\t'))
+			val++;
+		while (end > val && (end[-1] == ' ' || end[-1] == '\t'))
+			end--;
+		sum = bench_kv_sum(sum, (size_t)(colon - p), val, (size_t)(end - val));
+		p = eol + 2;
+	}
+	return sum;
+}
+
+const struct bench_impl bench_naive_impl = {
+	"naive",
+	{ naive_append, naive_replace, naive_casefold, naive_split, naive_lines, naive_logfmt,
+	  naive_headers },
+};
@@ -0,0 +1,107 @@
+/*
+ * Benchmark workloads on top of sds (https://github.com/antirez/sds).
+ *
+ * sds is not part of this repository. Configure with
+ * -DSTRUTIL_SDS_DIR=<dir holding sds.c and sds.h> to include it.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "sds.h"
+
+static uint64_t sds_append(const struct bench_input *in)
+{
+	sds s = sdsempty();
+
+	for (size_t i = 0; i < in->nwords; i++) {
+		s = sdscatlen(s, in->words[i], in->word_lens[i]);
+		s = sdscatlen(s, " ", 1);
+	}
+
+	uint64_t sum = bench_checksum(s, sdslen(s));
+	sdsfree(s);
+	return sum;
+}
+
+static uint64_t sds_replace(const struct bench_input *in)
+{
+	size_t nlen = strlen(in->needle), rlen = strlen(in->repl);
+	sds out = sdsempty();
+	const char *p = in->text, *q;
+
+	while ((q = strstr(p, in->needle)) != NULL) {
+		out = sdscatlen(out, p, (size_t)(q - p));
+		out = sdscatlen(out, in->repl, rlen);
+		p = q + nlen;
+	}
+	out = sdscatlen(out, p, in->text_len - (size_t)(p - in->text));
+
+	uint64_t sum = bench_checksum(out, sdslen(out));
+	sdsfree(out);
+	return sum;
+}
+
+static uint64_t sds_casefold(const struct bench_input *in)
+{
+	sds s = sdsnewlen(in->text, in->text_len);
+
+	sdstolower(s);
+
+	uint64_t sum = bench_checksum(s, sdslen(s));
+	sdsfree(s);
+	return sum;
+}
+
+static uint64_t sds_split(const struct bench_input *in)
+{
+	const char *p = in->text, *end = in->text + in->text_len;
+	uint64_t sum = 0;
+
+	for (;;) {
+		const char *q = p;
+		while (q < end && *q != ' ' && *q != '\n')
+			q++;
+
+		sds tok = sdsnewlen(p, (size_t)(q - p));
+		sum = sum * 31 + sdslen(tok);
+		sdsfree(tok);
+
+		if (q == end)
+			break;
+		p = q + 1;
+	}
+	return sum;
+}
+
+static uint64_t sds_lines(const struct bench_input *in)
+{
+	FILE *f = fopen(in->path, "r");
+	char buf[4096];
+	sds line = sdsempty();
+	uint64_t sum = 0;
+
+	if (!f)
+		return 0;
+
+	while (fgets(buf, sizeof(buf), f)) {
+		size_t n = strlen(buf);
+		int eol = n && buf[n - 1] == '\n';
+
+		line = sdscatlen(line, buf, n - (size_t)eol);
+		if (eol) {
+			sum = sum * 31 + sdslen(line);
+			sdsclear(line);
+		}
+	}
+
+	sdsfree(line);
+	fclose(f);
+	return sum;
+}
+
+const struct bench_impl bench_sds_impl = {
+	"sds",
+	{ sds_append, sds_replace, sds_casefold, sds_split, sds_lines },
+};
@@ -0,0 +1,75 @@
+/*
+ * Benchmark workloads on top of std::string.
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <string>
+
+#include "bench.h"
+
+static uint64_t std_append(const struct bench_input *in)
+{
+	std::string s;
+
+	for (size_t i = 0; i < in->nwords; i++) {
+		s.append(in->words[i], in->word_lens[i]);
+		s.push_back(' ');
+	}
+	return bench_checksum(s.data(), s.size());
+}
+
+static uint64_t std_replace(const struct bench_input *in)
+{
+	std::string s(in->text, in->text_len);
+	const std::string needle(in->needle), repl(in->repl);
+
+	for (size_t pos = s.find(needle); pos != std::string::npos;
+	     pos = s.find(needle, pos + repl.size()))
+		s.replace(pos, needle.size(), repl);
+
+	return bench_checksum(s.data(), s.size());
+}
+
+static uint64_t std_casefold(const struct bench_input *in)
+{
+	std::string s(in->text, in->text_len);
+
+	std::transform(s.begin(), s.end(), s.begin(),
+		       [](unsigned char c) { return (char)std::tolower(c); });
+	return bench_checksum(s.data(), s.size());
+}
+
+static uint64_t std_split(const struct bench_input *in)
+{
+	const std::string s(in->text, in->text_len);
+	uint64_t sum = 0;
+	size_t start = 0;
+
+	for (;;) {
+		size_t end = s.find_first_of(" \n", start);
+		std::string tok = s.substr(start, end == std::string::npos ? std::string::npos : end - start);
+		sum = sum * 31 + tok.size();
+		if (end == std::string::npos)
+			break;
+		start = end + 1;
+	}
+	return sum;
+}
+
+static uint64_t std_lines(const struct bench_input *in)
+{
+	std::ifstream f(in->path);
+	std::string line;
+	uint64_t sum = 0;
+
+	while (std::getline(f, line))
+		sum = sum * 31 + line.size();
+	return sum;
+}
+
+extern "C" const struct bench_impl bench_std_impl = {
+	"std::string",
+	{ std_append, std_replace, std_casefold, std_split, std_lines },
+};
@@ -0,0 +1,124 @@
+/*
+ * Benchmark workloads on top of strutil.h.
+ */
+
+#include "bench.h"
+#include "strutil.h"
+
+static uint64_t str_append(const struct bench_input *in)
+{
+	str *s = str_init();
+
+	for (size_t i = 0; i < in->nwords; i++) {
+		str_add_n(s, in->words[i], in->word_lens[i]);
+		str_add_n(s, " ", 1);
+	}
+
+	uint64_t sum = bench_checksum(s->data, s->len);
+	str_free(s);
+	return sum;
+}
+
+static uint64_t str_replace(const struct bench_input *in)
+{
+	str *s = str_init();
+
+	str_add_n(s, in->text, in->text_len);
+	while (str_swap_word(s, in->needle, in->repl) == 0)
+		;
+
+	uint64_t sum = bench_checksum(s->data, s->len);
+	str_free(s);
+	return sum;
+}
+
+static uint64_t str_casefold(const struct bench_input *in)
+{
+	str *s = str_init();
+
+	str_add_n(s, in->text, in->text_len);
+	str_to_lower(s);
+
+	uint64_t sum = bench_checksum(s->data, s->len);
+	str_free(s);
+	return sum;
+}
+
+static uint64_t str_split(const struct bench_input *in)
+{
+	str *s = str_init();
+	uint64_t sum = 0;
+	size_t start = 0;
+
+	str_add_n(s, in->text, in->text_len);
+	for (size_t i = 0; i <= s->len; i++) {
+		if (i < s->len && s->data[i] != ' ' && s->data[i] != '\n')
+			continue;
+
+		str *tok = str_substr(s, start, i - start);
+		sum = sum * 31 + str_get_size(tok);
+		str_free(tok);
+		start = i + 1;
+	}
+
+	str_free(s);
+	return sum;
+}
+
+static uint64_t str_lines(const struct bench_input *in)
+{
+	str_follow *f = str_follow_open(in->path, 0);
+	const char *line;
+	size_t len;
+	uint64_t sum = 0;
+
+	if (!f)
+		return 0;
+
+	while (str_follow_next(f, &line, &len) == 1)
+		sum = sum * 31 + len;
+
+	str_follow_close(f);
+	return sum;
+}
+
+static uint64_t str_logfmt(const struct bench_input *in)
+{
+	const char *p = in->logfmt, *end = in->logfmt + in->logfmt_len;
+	struct str_kv kv[32];
+	uint64_t sum = 0;
+
+	while (p < end) {
+		const char *nl = (const char *)memchr(p, '\n', (size_t)(end - p));
+		size_t len = nl ? (size_t)(nl - p) : (size_t)(end - p);
+		int n = str_parse_logfmt(p, len, kv, 32);
+
+		for (int i = 0; i < n; i++)
+			sum = bench_kv_sum(sum, kv[i].key_len, kv[i].val, kv[i].val_len);
+		p += len + 1;
+	}
+	return sum;
+}
+
+static uint64_t str_headers(const struct bench_input *in)
+{
+	struct str_kv kv[32];
+	uint64_t sum = 0;
+	size_t off = 0, used;
+
+	while (off < in->headers_len) {
+		int n = str_parse_headers(in->headers + off, in->headers_len - off, kv, 32, &used);
+		if (n < 0)
+			break;
+
+		for (int i = 0; i < n; i++)
+			sum = bench_kv_sum(sum, kv[i].key_len, kv[i].val, kv[i].val_len);
+		off += used;
+	}
+	return sum;
+}
+
+const struct bench_impl bench_str_impl = {
+	"str",
+	{ str_append, str_replace, str_casefold, str_split, str_lines, str_logfmt, str_headers },
+};
@@ -0,0 +1,69 @@
+#!/usr/bin/env bash
+#
+# cli_bench.sh - times the strutil CLI against tr, sed, awk and uniq.
+#
+# Usage: cli_bench.sh STRUTIL CORPUSGEN [SIZE] [REPS]
+#
+# Generates a SIZE byte corpus (default 2 GiB) with CORPUSGEN, checks that
+# each strutil command produces the same bytes as its classic counterpart
+# and prints the best wall time of REPS runs (default 3) for both.
+
+set -euo pipefail
+
+strutil=${1:?usage: $0 STRUTIL CORPUSGEN [SIZE] [REPS]}
+corpusgen=${2:?usage: $0 STRUTIL CORPUSGEN [SIZE] [REPS]}
+size=${3:-2147483648}
+reps=${4:-3}
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+input=$dir/corpus.txt
+needle=lifubawa
+
+echo "generating $size bytes..."
+"$corpusgen" --size "$size" --needle "$needle" --density 10 --lines 1:30 -o "$input"
+
+export LC_ALL=C
+
+# best_of CMD... - prints the fastest of $reps runs in seconds. Output goes
+# to a file, not /dev/null, which GNU grep detects and stops early for.
+best_of() {
+	local best="" t
+	for ((i = 0; i < reps; i++)); do
+		t=$( { TIMEFORMAT=%R; time "$@" > "$dir/out"; } 2>&1 )
+		if [[ -z $best ]] || awk -v a="$t" -v b="$best" 'BEGIN { exit !(a < b) }'; then
+			best=$t
+		fi
+	done
+	echo "$best"
+}
+
+# row NAME STRUTIL-ARGS -- OTHER-NAME OTHER-CMD...
+row() {
+	local name=$1; shift
+	local args=()
+	while [[ $1 != -- ]]; do args+=("$1"); shift; done
+	shift
+	local other=$1; shift
+
+	local a b check=ok
+	if ! cmp -s <("$strutil" "${args[@]}" "$input") <("$@" < "$input"); then
+		check=DIFFERS
+	fi
+	a=$(best_of "$strutil" "${args[@]}" "$input")
+	b=$(best_of sh -c '"$@" < "$0"' "$input" "$@")
+	awk -v n="$name" -v o="$other" -v a="$a" -v b="$b" -v s="$size" -v c="$check" 'BEGIN {
+		printf "%-10s %8.2fs %8.0f MB/s   %-6s %8.2fs %8.0f MB/s   %.2fx  %s\n",
+		       n, a, s / 1e6 / a, o, b, s / 1e6 / b, b / a, c }'
+}
+
+printf "%-10s %9s %13s   %-6s %9s %13s   %s\n" command strutil "" other time "" speedup
+row upper   upper -- tr tr a-z A-Z
+row lower   lower -- tr tr A-Z a-z
+row replace replace "$needle" REPLACED -- sed sed "s/$needle/REPLACED/g"
+row remove  remove "$needle" -- sed sed "s/$needle//g"
+row awk-sub replace "$needle" REPLACED -- awk awk "{ gsub(/$needle/, \"REPLACED\") } 1"
+row trim    trim -- sed sed -E 's/^[ \t]+//; s/[ \t]+$//'
+row dedup   dedup -- uniq uniq
+row grep    grep "$needle" -- grep grep -F "$needle"
+row grep-3  grep -e "$needle" -e zunum -e bedagivgo -- grep grep -F -e "$needle" -e zunum -e bedagivgo
@@ -0,0 +1,354 @@
+#ifndef _STRUTIL_CORPUS_H_
+#define _STRUTIL_CORPUS_H_ 1
+
+/*
+ * Deterministic text corpus for the benchmarks and tests.
+ *
+ * The same options always produce the same bytes on every platform, so
+ * results from different machines and builds compare like for like.
+ * Besides plain words the corpus can mix in multibyte UTF-8 words, a
+ * needle at a fixed density and adversarial "aaaa...ab" runs.
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CORPUS_WORD_MAX 64	/* longest vocabulary word in bytes */
+
+struct corpus_rng {
+	uint64_t state;
+};
+
+/* xorshift64* - small, fast and identical everywhere. */
+static inline uint64_t corpus_next(struct corpus_rng *rng)
+{
+	uint64_t x = rng->state;
+
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	rng->state = x;
+	return x * 0x2545F4914F6CDD1Dull;
+}
+
+static inline void corpus_seed(struct corpus_rng *rng, uint64_t seed)
+{
+	rng->state = seed ? seed : 0x9E3779B97F4A7C15ull;
+	for (int i = 0; i < 4; i++)
+		corpus_next(rng);
+}
+
+/* Uniform value in [0, n). */
+static inline uint64_t corpus_below(struct corpus_rng *rng, uint64_t n)
+{
+	return n ? corpus_next(rng) % n : 0;
+}
+
+/* Uniform value in [0, 1). */
+static inline double corpus_unit(struct corpus_rng *rng)
+{
+	return (double)(corpus_next(rng) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+enum corpus_lines {
+	CORPUS_LINES_UNIFORM,	/* line_min .. line_max words per line */
+	CORPUS_LINES_GEOMETRIC,	/* at least line_min, mean (line_min + line_max) / 2, long tail */
+};
+
+/*
+ * struct corpus_opts - What corpus_generate() produces.
+ * @seed: Seed; equal options give equal output.
+ * @size: Exact number of bytes to produce.
+ * @vocab: Number of distinct words to draw from.
+ * @zipf: Zipf exponent of word ranks; 0 draws words uniformly.
+ * @lines: Distribution of the number of words per line.
+ * @line_min: Fewest words per line.
+ * @line_max: Most words per line (uniform) or twice the mean less @line_min (geometric).
+ * @utf8_pct: Percentage of vocabulary words spelled with multibyte letters.
+ * @needle: Word inserted at @needle_permille, or NULL.
+ * @needle_permille: Per-mille of words that are @needle.
+ * @adv_len: Length of adversarial "aaaa...ab" words, 0 for none.
+ * @adv_pct: Percentage of words that are adversarial.
+ */
+struct corpus_opts {
+	uint64_t	seed;
+	size_t		size;
+	size_t		vocab;
+	double		zipf;
+	enum corpus_lines lines;
+	size_t		line_min;
+	size_t		line_max;
+	unsigned	utf8_pct;
+	const char	*needle;
+	unsigned	needle_permille;
+	size_t		adv_len;
+	unsigned	adv_pct;
+};
+
+/* ASCII text with a natural (s = 1) word distribution and 4 to 19 words per line. */
+static inline void corpus_defaults(struct corpus_opts *opts, uint64_t seed, size_t size)
+{
+	memset(opts, 0, sizeof(*opts));
+	opts->seed = seed;
+	opts->size = size;
+	opts->vocab = 1000;
+	opts->zipf = 1.0;
+	opts->lines = CORPUS_LINES_UNIFORM;
+	opts->line_min = 4;
+	opts->line_max = 19;
+}
+
+/*
+ * corpus_word() - Writes the @i-th ASCII vocabulary word of @seed into @buf.
+ *
+ * Words are built from consonant-vowel syllables, so they look like text
+ * and have a realistic spread of lengths.
+ *
+ * Returns:
+ *     The length of the word, at most 12
+ */
+static inline size_t corpus_word(uint64_t seed, size_t i, char *buf)
+{
+	static const char cons[] = "bcdfghjklmnprstvwz";
+	static const char vow[] = "aeiou";
+	struct corpus_rng rng;
+	size_t len = 0;
+
+	corpus_seed(&rng, seed ^ (0xA24BAED4963EE407ull * (i + 1)));
+
+	int syl = 1 + (int)corpus_below(&rng, 4);
+	for (int s = 0; s < syl; s++) {
+		buf[len++] = cons[corpus_below(&rng, sizeof(cons) - 1)];
+		buf[len++] = vow[corpus_below(&rng, sizeof(vow) - 1)];
+		if (corpus_below(&rng, 3) == 0)
+			buf[len++] = cons[corpus_below(&rng, sizeof(cons) - 1)];
+	}
+	return len;
+}
+
+/*
+ * corpus_vocab_word() - Writes the @i-th vocabulary word for @opts into @buf.
+ *
+ * @opts->utf8_pct percent of the words have their vowels replaced by
+ * accented Latin, Greek or Cyrillic letters, and a few are spelled in CJK
+ * ideographs, so 2, 3 and 4 byte sequences all occur. Whether a word is
+ * multibyte depends only on the seed and @i.
+ *
+ * Returns:
+ *     The length of the word, at most CORPUS_WORD_MAX
+ */
+static inline size_t corpus_vocab_word(const struct corpus_opts *opts, size_t i, char *buf)
+{
+	static const char *const vowels[] = {
+		"\xC3\xA9", "\xC3\xBC", "\xC3\xB6", "\xC3\xA4", "\xC4\xB1",	/* é ü ö ä ı */
+		"\xCE\xB1", "\xCE\xBF", "\xD0\xB8", "\xD1\x8F",			/* α ο и я */
+		"\xE1\xBA\xA1", "\xF0\x9D\x90\x9A",				/* ạ 𝐚 */
+	};
+	char ascii[16];
+	size_t n = corpus_word(opts->seed, i, ascii), len = 0;
+	struct corpus_rng rng;
+
+	corpus_seed(&rng, opts->seed ^ (0x9FB21C651E98DF25ull * (i + 1)));
+	if (corpus_below(&rng, 100) >= opts->utf8_pct) {
+		memcpy(buf, ascii, n);
+		return n;
+	}
+
+	if (corpus_below(&rng, 8) == 0) {
+		/* CJK Unified Ideographs, U+4E00 .. U+9FFF */
+		for (size_t k = 0; k < 1 + n / 3; k++) {
+			uint32_t cp = 0x4E00 + (uint32_t)corpus_below(&rng, 0x5200);
+			buf[len++] = (char)(0xE0 | (cp >> 12));
+			buf[len++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+			buf[len++] = (char)(0x80 | (cp & 0x3F));
+		}
+		return len;
+	}
+
+	for (size_t k = 0; k < n; k++) {
+		if (strchr("aeiou", ascii[k])) {
+			const char *v = vowels[corpus_below(&rng, sizeof(vowels) / sizeof(vowels[0]))];
+			size_t vn = strlen(v);
+			memcpy(buf + len, v, vn);
+			len += vn;
+		} else {
+			buf[len++] = ascii[k];
+		}
+	}
+	return len;
+}
+
+/* Cumulative Zipf weights of ranks 1 .. @n, normalised to end at 1. */
+static inline double *corpus_zipf_cdf(size_t n, double s)
+{
+	double *cdf = (double *)malloc(n * sizeof(*cdf)), sum = 0;
+
+	if (!cdf)
+		return NULL;
+	for (size_t k = 0; k < n; k++)
+		cdf[k] = sum += 1.0 / pow((double)(k + 1), s);
+	for (size_t k = 0; k < n; k++)
+		cdf[k] /= sum;
+	return cdf;
+}
+
+static inline size_t corpus_zipf_pick(const double *cdf, size_t n, double u)
+{
+	size_t lo = 0, hi = n - 1;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (cdf[mid] < u)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+static inline size_t corpus_line_words(struct corpus_rng *rng, const struct corpus_opts *opts)
+{
+	size_t min = opts->line_min ? opts->line_min : 1;
+	size_t max = opts->line_max > min ? opts->line_max : min;
+
+	if (opts->lines == CORPUS_LINES_UNIFORM)
+		return min + (size_t)corpus_below(rng, max - min + 1);
+
+	/* geometric number of extra words with mean (max - min) / 2 */
+	double p = 2.0 / (double)(max - min + 2);
+	size_t n = min;
+	while (n < 64 * max && corpus_unit(rng) >= p)
+		n++;
+	return n;
+}
+
+/*
+ * corpus_generate() - Produces @opts->size bytes of words and lines.
+ * @opts: What to generate; see struct corpus_opts.
+ *
+ * Words are separated by single spaces and lines by '\n'. The text always
+ * ends with '\n' and never ends inside a multibyte sequence. The caller
+ * frees the returned NUL-terminated buffer.
+ *
+ * Returns:
+ *     The generated text, or NULL if memory allocation fails
+ */
+static inline char *corpus_generate(const struct corpus_opts *opts)
+{
+	struct corpus_rng rng;
+	char word[CORPUS_WORD_MAX + 1];
+	size_t vocab = opts->vocab ? opts->vocab : 1;
+	size_t size = opts->size, len = 0, left = 0;
+	size_t needle_len = opts->needle ? strlen(opts->needle) : 0;
+	double *cdf = NULL;
+	char *out = (char *)malloc(size + 1);
+
+	if (!out || (opts->zipf > 0 && !(cdf = corpus_zipf_cdf(vocab, opts->zipf)))) {
+		free(out);
+		return NULL;
+	}
+
+	corpus_seed(&rng, opts->seed);
+	while (len < size) {
+		char *w = word;
+		size_t n;
+
+		if (left == 0)
+			left = corpus_line_words(&rng, opts);
+
+		if (needle_len && corpus_below(&rng, 1000) < opts->needle_permille) {
+			w = (char *)opts->needle;
+			n = needle_len;
+		} else if (opts->adv_len && corpus_below(&rng, 100) < opts->adv_pct) {
+			w = NULL;
+			n = opts->adv_len + 1;
+		} else {
+			size_t rank = cdf ? corpus_zipf_pick(cdf, vocab, corpus_unit(&rng))
+					  : (size_t)corpus_below(&rng, vocab);
+			n = corpus_vocab_word(opts, rank, word);
+		}
+
+		if (n + 1 > size - len) {
+			/* no room for the whole word: pad, so no sequence is cut short */
+			memset(out + len, ' ', size - len);
+			len = size;
+			break;
+		}
+
+		if (w)
+			memcpy(out + len, w, n);
+		else {
+			memset(out + len, 'a', n - 1);
+			out[len + n - 1] = 'b';
+		}
+		len += n;
+		out[len++] = --left ? ' ' : '\n';
+	}
+
+	if (size)
+		out[size - 1] = '\n';
+	out[size] = '\0';
+	free(cdf);
+	return out;
+}
+
+/*
+ * corpus_parse_arg() - Consumes a corpus option at argv[*i] into @opts.
+ *
+ * Recognised: --seed N, --size BYTES, --vocab N, --zipf S,
+ * --lines MIN:MAX, --geometric, --utf8 PCT, --needle WORD,
+ * --density PERMILLE, --adversarial LEN and --adv-pct PCT.
+ * On success *i points at the last argument consumed.
+ *
+ * Returns:
+ *     1 if the option was consumed, 0 if it is not a corpus option
+ */
+static inline int corpus_parse_arg(struct corpus_opts *opts, int argc, char **argv, int *i)
+{
+	const char *arg = argv[*i], *val = *i + 1 < argc ? argv[*i + 1] : NULL;
+
+	if (!strcmp(arg, "--geometric")) {
+		opts->lines = CORPUS_LINES_GEOMETRIC;
+		return 1;
+	}
+	if (!val)
+		return 0;
+
+	if (!strcmp(arg, "--seed"))
+		opts->seed = strtoull(val, NULL, 0);
+	else if (!strcmp(arg, "--size"))
+		opts->size = strtoull(val, NULL, 0);
+	else if (!strcmp(arg, "--vocab"))
+		opts->vocab = strtoull(val, NULL, 0);
+	else if (!strcmp(arg, "--zipf"))
+		opts->zipf = strtod(val, NULL);
+	else if (!strcmp(arg, "--lines")) {
+		char *end;
+		opts->line_min = strtoull(val, &end, 0);
+		opts->line_max = *end == ':' ? strtoull(end + 1, NULL, 0) : opts->line_min;
+	} else if (!strcmp(arg, "--utf8"))
+		opts->utf8_pct = (unsigned)strtoul(val, NULL, 0);
+	else if (!strcmp(arg, "--needle"))
+		opts->needle = val;
+	else if (!strcmp(arg, "--density"))
+		opts->needle_permille = (unsigned)strtoul(val, NULL, 0);
+	else if (!strcmp(arg, "--adversarial")) {
+		opts->adv_len = strtoull(val, NULL, 0);
+		if (!opts->adv_pct)
+			opts->adv_pct = 1;
+	} else if (!strcmp(arg, "--adv-pct"))
+		opts->adv_pct = (unsigned)strtoul(val, NULL, 0);
+	else
+		return 0;
+
+	(*i)++;
+	return 1;
+}
+
+#define CORPUS_USAGE \
+	"[--seed N] [--size BYTES] [--vocab N] [--zipf S] [--lines MIN:MAX] [--geometric]\n" \
+	"       [--utf8 PCT] [--needle WORD] [--density PERMILLE] [--adversarial LEN] [--adv-pct PCT]"
+
+#endif /* _STRUTIL_CORPUS_H_ */
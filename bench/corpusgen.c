@@ -0,0 +1,47 @@
+/*
+ * corpusgen - writes the benchmark corpus to a file or stdout.
+ *
+ * Usage: corpusgen [corpus options] [-o FILE]
+ *
+ * Takes the same corpus options as bench, so a corpus that shows odd
+ * results can be written out and inspected or fed to other tools.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "corpus.h"
+
+int main(int argc, char **argv)
+{
+	struct corpus_opts opts;
+	const char *path = NULL;
+
+	corpus_defaults(&opts, 1, 1 << 20);
+	for (int i = 1; i < argc; i++) {
+		if (corpus_parse_arg(&opts, argc, argv, &i))
+			continue;
+		if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+			path = argv[++i];
+			continue;
+		}
+		fprintf(stderr, "usage: %s " CORPUS_USAGE "\n       [-o FILE]\n", argv[0]);
+		return 2;
+	}
+
+	char *text = corpus_generate(&opts);
+	if (!text) {
+		perror("corpusgen");
+		return 1;
+	}
+
+	FILE *out = path ? fopen(path, "wb") : stdout;
+	if (!out || fwrite(text, 1, opts.size, out) != opts.size || (path && fclose(out))) {
+		perror(path ? path : "corpusgen");
+		free(text);
+		return 1;
+	}
+
+	free(text);
+	return 0;
+}
@@ -0,0 +1,121 @@
+/*
+ * stats.h - sample statistics for the benchmark regression gate.
+ *
+ * Samples are rejected as outliers with Tukey's fences and two sample sets
+ * are compared with a one-sided Mann-Whitney U test (normal approximation
+ * with tie correction), which makes no assumption about the shape of the
+ * timing distribution.
+ */
+
+#ifndef STRUTIL_BENCH_STATS_H
+#define STRUTIL_BENCH_STATS_H
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int stats_cmp(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+/* Linear interpolated quantile of the sorted samples @v. */
+static double stats_quantile(const double *v, size_t n, double q)
+{
+	double pos = q * (double)(n - 1);
+	size_t i = (size_t)pos;
+
+	if (i + 1 >= n)
+		return v[n - 1];
+	return v[i] + (pos - (double)i) * (v[i + 1] - v[i]);
+}
+
+/*
+ * stats_filter - sort @v and drop samples outside [Q1 - 1.5 IQR, Q3 + 1.5 IQR]
+ * @v: samples, sorted and compacted in place
+ * @n: number of samples
+ *
+ * Return: the number of samples kept.
+ */
+static size_t stats_filter(double *v, size_t n)
+{
+	size_t kept = 0;
+
+	qsort(v, n, sizeof(*v), stats_cmp);
+	if (n < 4)
+		return n;
+
+	double q1 = stats_quantile(v, n, 0.25), q3 = stats_quantile(v, n, 0.75);
+	double lo = q1 - 1.5 * (q3 - q1), hi = q3 + 1.5 * (q3 - q1);
+
+	for (size_t i = 0; i < n; i++)
+		if (v[i] >= lo && v[i] <= hi)
+			v[kept++] = v[i];
+	return kept;
+}
+
+struct stats_rank {
+	double	v;
+	int	from_a;
+};
+
+static int stats_rank_cmp(const void *a, const void *b)
+{
+	return stats_cmp(&((const struct stats_rank *)a)->v, &((const struct stats_rank *)b)->v);
+}
+
+/*
+ * stats_mann_whitney - one-sided Mann-Whitney U test
+ * @a: first sample set
+ * @na: size of @a
+ * @b: second sample set
+ * @nb: size of @b
+ *
+ * Tests whether values in @a tend to be larger than values in @b.
+ *
+ * Return: the p-value, or 1.0 if either set is empty or all values tie.
+ */
+static double stats_mann_whitney(const double *a, size_t na, const double *b, size_t nb)
+{
+	size_t n = na + nb;
+	struct stats_rank *r;
+	double ranks_a = 0, ties = 0;
+
+	if (!na || !nb || !(r = (struct stats_rank *)malloc(n * sizeof(*r))))
+		return 1.0;
+
+	for (size_t i = 0; i < na; i++)
+		r[i] = (struct stats_rank){ a[i], 1 };
+	for (size_t i = 0; i < nb; i++)
+		r[na + i] = (struct stats_rank){ b[i], 0 };
+	qsort(r, n, sizeof(*r), stats_rank_cmp);
+
+	for (size_t i = 0; i < n;) {
+		size_t j = i;
+		while (j < n && r[j].v == r[i].v)
+			j++;
+
+		double rank = (double)(i + j + 1) / 2.0;	/* average of ranks i+1 .. j */
+		double t = (double)(j - i);
+		for (size_t k = i; k < j; k++)
+			if (r[k].from_a)
+				ranks_a += rank;
+		ties += t * t * t - t;
+		i = j;
+	}
+	free(r);
+
+	double u = ranks_a - (double)na * (double)(na + 1) / 2.0;
+	double mean = (double)na * (double)nb / 2.0;
+	double var = (double)na * (double)nb / 12.0 *
+		     ((double)(n + 1) - ties / ((double)n * (double)(n - 1)));
+
+	if (var <= 0)
+		return 1.0;
+
+	double z = (u - mean - 0.5) / sqrt(var);
+	return 0.5 * erfc(z / sqrt(2.0));
+}
+
+#endif /* STRUTIL_BENCH_STATS_H */
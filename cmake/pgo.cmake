@@ -0,0 +1,119 @@
+# pgo.cmake - profile-guided build of the benchmark, reported against a plain build.
+#
+# Run by the bench-pgo target as a script (cmake -P) with these variables:
+#   SOURCE_DIR       project source directory
+#   WORK_DIR         scratch directory for the sub-builds and profiles
+#   C_COMPILER       C compiler of the parent build
+#   CXX_COMPILER     C++ compiler of the parent build
+#   COMPILER_ID      GNU or Clang
+#   SDS_DIR          passed through as STRUTIL_SDS_DIR
+#   TRAIN_ARGS       benchmark arguments for the training run
+#   BENCH_ARGS       benchmark arguments for the reported runs
+#   BOLT             ON to post-link optimize the PGO binary with llvm-bolt
+#
+# The instrumented and the optimized binary are built in the same directory,
+# so the object paths recorded in the profile match when it is read back.
+
+cmake_minimum_required(VERSION 3.0)
+
+separate_arguments(TRAIN_ARGS UNIX_COMMAND "${TRAIN_ARGS}")
+separate_arguments(BENCH_ARGS UNIX_COMMAND "${BENCH_ARGS}")
+
+set(PROFILE_DIR ${WORK_DIR}/profile)
+set(PLAIN_BIN ${WORK_DIR}/plain/strutil_bench)
+set(PGO_BIN ${WORK_DIR}/pgo/strutil_bench)
+
+function(run)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE rc)
+    if(NOT rc EQUAL 0)
+        message(FATAL_ERROR "pgo: command failed (${rc}): ${ARGN}")
+    endif()
+endfunction()
+
+function(build_bench dir flags link_flags)
+    run(${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${dir}
+        -DCMAKE_BUILD_TYPE=Release
+        -DCMAKE_C_COMPILER=${C_COMPILER}
+        -DCMAKE_CXX_COMPILER=${CXX_COMPILER}
+        "-DCMAKE_C_FLAGS=${flags}"
+        "-DCMAKE_CXX_FLAGS=${flags}"
+        "-DCMAKE_EXE_LINKER_FLAGS=${link_flags}"
+        -DSTRUTIL_BUILD_BENCH=ON
+        -DSTRUTIL_PGO=OFF
+        "-DSTRUTIL_SDS_DIR=${SDS_DIR}")
+    run(${CMAKE_COMMAND} --build ${dir} --target strutil_bench)
+endfunction()
+
+if(COMPILER_ID STREQUAL "GNU")
+    set(GEN_FLAGS "-fprofile-generate=${PROFILE_DIR}")
+    set(USE_FLAGS "-fprofile-use=${PROFILE_DIR} -fprofile-correction -Wno-missing-profile")
+elseif(COMPILER_ID MATCHES "Clang")
+    find_program(LLVM_PROFDATA llvm-profdata)
+    if(NOT LLVM_PROFDATA)
+        message(FATAL_ERROR "pgo: llvm-profdata is required with Clang")
+    endif()
+    set(GEN_FLAGS "-fprofile-instr-generate")
+    set(USE_FLAGS "-fprofile-instr-use=${PROFILE_DIR}/merged.profdata -Wno-profile-instr-unprofiled")
+else()
+    message(FATAL_ERROR "pgo: unsupported compiler ${COMPILER_ID}")
+endif()
+
+set(LINK_FLAGS "")
+if(BOLT)
+    find_program(LLVM_BOLT llvm-bolt)
+    if(LLVM_BOLT)
+        set(LINK_FLAGS "-Wl,--emit-relocs")
+    else()
+        message(WARNING "pgo: llvm-bolt not found, skipping the BOLT step")
+    endif()
+endif()
+
+# 1. Plain build, the reference for the report
+build_bench(${WORK_DIR}/plain "" "")
+
+# 2. Instrumented build and training run
+file(REMOVE_RECURSE ${PROFILE_DIR})
+file(MAKE_DIRECTORY ${PROFILE_DIR})
+build_bench(${WORK_DIR}/pgo "${GEN_FLAGS}" "")
+message(STATUS "pgo: training with ${TRAIN_ARGS}")
+run(${CMAKE_COMMAND} -E env LLVM_PROFILE_FILE=${PROFILE_DIR}/bench-%p.profraw
+    ${PGO_BIN} ${TRAIN_ARGS})
+
+if(NOT COMPILER_ID STREQUAL "GNU")
+    file(GLOB RAW_PROFILES ${PROFILE_DIR}/*.profraw)
+    run(${LLVM_PROFDATA} merge -o ${PROFILE_DIR}/merged.profdata ${RAW_PROFILES})
+endif()
+
+# 3. Rebuild the same tree with the profile
+build_bench(${WORK_DIR}/pgo "${USE_FLAGS}" "${LINK_FLAGS}")
+
+# 4. Optional BOLT pass over the PGO binary
+set(BOLT_BIN "")
+if(LLVM_BOLT)
+    set(BOLT_BIN ${WORK_DIR}/strutil_bench.bolt)
+    run(${LLVM_BOLT} ${PGO_BIN} -instrument -instrumentation-file=${WORK_DIR}/bolt.fdata
+        -o ${WORK_DIR}/strutil_bench.bolt-instr)
+    run(${WORK_DIR}/strutil_bench.bolt-instr ${TRAIN_ARGS})
+    run(${LLVM_BOLT} ${PGO_BIN} -o ${BOLT_BIN} -data=${WORK_DIR}/bolt.fdata
+        -reorder-blocks=ext-tsp -reorder-functions=hfsort -split-functions -split-all-cold)
+endif()
+
+# 5. Side-by-side report: each optimized build is compared against the plain one
+message(STATUS "pgo: plain build")
+run(${PLAIN_BIN} ${BENCH_ARGS} --json ${WORK_DIR}/plain.json)
+
+foreach(variant pgo bolt)
+    if(variant STREQUAL "pgo")
+        set(bin ${PGO_BIN})
+    else()
+        set(bin ${BOLT_BIN})
+    endif()
+    if(bin)
+        message(STATUS "pgo: ${variant} build vs plain (a REGRESSION line means slower than plain)")
+        execute_process(COMMAND ${bin} ${BENCH_ARGS} --baseline ${WORK_DIR}/plain.json
+            RESULT_VARIABLE rc)
+        if(NOT rc EQUAL 0 AND NOT rc EQUAL 3)
+            message(FATAL_ERROR "pgo: ${variant} benchmark failed (${rc})")
+        endif()
+    endif()
+endforeach()
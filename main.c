@@ -0,0 +1,540 @@
+/*
+ * strutil - stream text through the str kernels.
+ *
+ * Usage: strutil COMMAND [ARGS] [FILE...]
+ *
+ * Reads the files in order, or stdin when none (or "-") is given, and
+ * writes the result to stdout. Input is read in large blocks into a
+ * str_ring and transformed a block of whole lines at a time, so memory use
+ * stays flat however big the input is.
+ *
+ * grep maps regular files instead and scans chunks of them in parallel,
+ * writing the matching lines of each chunk in input order.
+ */
+
+#define _GNU_SOURCE	/* memrchr */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "strutil.h"
+
+#define STRUTIL_BLOCK	(1 << 20)	/* read and transform granularity */
+#define STRUTIL_GREP_CHUNK	(8 << 20)	/* bytes of a mapped file per grep thread */
+#define STRUTIL_GREP_THREADS	64	/* most grep threads */
+
+enum strutil_cmd {
+	CMD_UPPER,
+	CMD_LOWER,
+	CMD_TITLE,
+	CMD_SENTENCE,
+	CMD_REPLACE,
+	CMD_REMOVE,
+	CMD_TRIM,
+	CMD_DEDUP,
+	CMD_NFC,
+	CMD_NFD,
+	CMD_GREP,
+};
+
+static const struct {
+	const char	*name;
+	int		nargs;
+	const char	*help;
+} commands[] = {
+	[CMD_UPPER]	= { "upper",	0, "convert to upper case" },
+	[CMD_LOWER]	= { "lower",	0, "convert to lower case" },
+	[CMD_TITLE]	= { "title",	0, "capitalize every word" },
+	[CMD_SENTENCE]	= { "sentence",	0, "capitalize after SEP (default \". \"), set with -s SEP" },
+	[CMD_REPLACE]	= { "replace",	2, "OLD NEW: replace every OLD with NEW" },
+	[CMD_REMOVE]	= { "remove",	1, "WORD: remove every WORD" },
+	[CMD_TRIM]	= { "trim",	0, "strip leading and trailing blanks from each line" },
+	[CMD_DEDUP]	= { "dedup",	0, "drop lines equal to the line before" },
+	[CMD_NFC]	= { "nfc",	0, "convert to Unicode Normalization Form C" },
+	[CMD_NFD]	= { "nfd",	0, "convert to Unicode Normalization Form D" },
+	[CMD_GREP]	= { "grep",	0, "[-c] [-j N] [-e PAT]... [PAT]: print lines containing any PAT" },
+};
+
+struct job {
+	enum strutil_cmd cmd;
+	const char	*arg1;
+	const char	*arg2;
+	str		*work;		/* block being transformed in place */
+	str		*out;		/* output of the line-by-line commands */
+	str		*prev;		/* dedup: last line written; sentence: tail of last block */
+	int		have_prev;
+
+	const char	**pats;		/* grep: literal patterns */
+	size_t		*plens;
+	size_t		npats;
+	str_ac		*ac;		/* grep: automaton, for more than one pattern */
+	int		count_only;	/* grep -c */
+	long		threads;	/* grep -j */
+	const char	*name;		/* grep: prefix for matching lines, or NULL */
+	size_t		matches;	/* grep: matching lines in the current file */
+};
+
+/* Exit status on errors: 1, or 2 for grep where 1 means "no match". */
+static int fail_status = 1;
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s COMMAND [ARGS] [FILE...]\n\ncommands:\n", prog);
+	for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); i++)
+		fprintf(stderr, "  %-10s %s\n", commands[i].name, commands[i].help);
+	exit(2);
+}
+
+static void die(const char *what, int err)
+{
+	fprintf(stderr, "strutil: %s: %s\n", what, strerror(err));
+	exit(fail_status);
+}
+
+static void write_out(const char *p, size_t n)
+{
+	while (n) {
+		ssize_t w = write(STDOUT_FILENO, p, n);
+		if (w < 0) {
+			if (errno == EINTR)
+				continue;
+			die("write", errno);
+		}
+		p += w;
+		n -= (size_t)w;
+	}
+}
+
+/* Empties @s and refills it with @n bytes, reusing its buffer. */
+static void load(str *s, const char *p, size_t n)
+{
+	str_consume_front(s, str_get_size(s));
+	if (str_add_n(s, p, n))
+		die("str_add_n", ENOMEM);
+}
+
+static void trim_line(struct job *job, const char *p, size_t n, int nl)
+{
+	while (n && (*p == ' ' || *p == '\t'))
+		p++, n--;
+	while (n && (p[n - 1] == ' ' || p[n - 1] == '\t'))
+		n--;
+
+	if (str_add_n(job->out, p, n) || (nl && str_add_n(job->out, "\n", 1)))
+		die("str_add_n", ENOMEM);
+}
+
+static void dedup_line(struct job *job, const char *p, size_t n, int nl)
+{
+	if (job->have_prev && str_get_size(job->prev) == n && !memcmp(job->prev->data, p, n))
+		return;
+
+	load(job->prev, p, n);
+	job->have_prev = 1;
+	if (str_add_n(job->out, p, n) || (nl && str_add_n(job->out, "\n", 1)))
+		die("str_add_n", ENOMEM);
+}
+
+static const char *grep_find(const struct job *job, const char *p, size_t n)
+{
+	if (job->ac)
+		return str_ac_find(job->ac, p, n, NULL);
+	return str_find_n(p, n, job->pats[0], job->plens[0]);
+}
+
+/*
+ * Appends the lines in @n bytes at @p that contain a pattern to @out, and
+ * returns how many there were. Line boundaries are only looked for around
+ * a match; everything in between is covered by the search alone.
+ */
+static size_t grep_chunk(const struct job *job, const char *p, size_t n, str *out)
+{
+	const char *end = p + n;
+	size_t count = 0;
+
+	while (p < end) {
+		const char *m = grep_find(job, p, (size_t)(end - p));
+		if (!m)
+			break;
+
+		const char *ls = memrchr(p, '\n', (size_t)(m - p));
+		const char *le = memchr(m, '\n', (size_t)(end - m));
+		ls = ls ? ls + 1 : p;
+		le = le ? le + 1 : end;
+
+		count++;
+		if (!job->count_only &&
+		    ((job->name && (str_add(out, job->name) || str_add_n(out, ":", 1))) ||
+		     str_add_n(out, ls, (size_t)(le - ls)) ||
+		     (le[-1] != '\n' && str_add_n(out, "\n", 1))))
+			die("str_add_n", ENOMEM);
+		p = le;
+	}
+	return count;
+}
+
+struct grep_task {
+	const struct job *job;
+	const char	*p;
+	size_t		n;
+	str		*out;
+	size_t		count;
+};
+
+static void *grep_worker(void *arg)
+{
+	struct grep_task *t = (struct grep_task *)arg;
+
+	str_consume_front(t->out, str_get_size(t->out));
+	t->count = grep_chunk(t->job, t->p, t->n, t->out);
+	return NULL;
+}
+
+/*
+ * Searches @n mapped bytes at @p in rounds of up to @job->threads chunks of
+ * STRUTIL_GREP_CHUNK bytes, each extended to the next newline. Each chunk
+ * of a round is scanned by its own thread, then the outputs are written in
+ * chunk order.
+ */
+static void grep_mapped(struct job *job, const char *p, size_t n)
+{
+	struct grep_task tasks[STRUTIL_GREP_THREADS];
+	pthread_t tids[STRUTIL_GREP_THREADS];
+	size_t off = 0;
+	long t;
+
+	for (t = 0; t < job->threads; t++) {
+		tasks[t].out = str_init();
+		if (!tasks[t].out || str_add_n(tasks[t].out, "", 0))
+			die("str_init", ENOMEM);
+	}
+
+	while (off < n) {
+		long used;
+
+		for (used = 0; used < job->threads && off < n; used++) {
+			size_t end = n - off > STRUTIL_GREP_CHUNK ? off + STRUTIL_GREP_CHUNK : n;
+			const char *nl = end < n ? memchr(p + end - 1, '\n', n - end + 1) : NULL;
+
+			if (end < n)
+				end = nl ? (size_t)(nl - p) + 1 : n;
+			tasks[used].job = job;
+			tasks[used].p = p + off;
+			tasks[used].n = end - off;
+			off = end;
+
+			int err = used ? pthread_create(&tids[used], NULL, grep_worker, &tasks[used]) : 0;
+			if (err)
+				die("pthread_create", err);
+		}
+
+		grep_worker(&tasks[0]);	/* the first chunk runs on this thread */
+		for (t = 0; t < used; t++) {
+			if (t)
+				pthread_join(tids[t], NULL);
+			job->matches += tasks[t].count;
+			write_out(tasks[t].out->data, str_get_size(tasks[t].out));
+		}
+	}
+
+	for (t = 0; t < job->threads; t++)
+		str_free(tasks[t].out);
+}
+
+/*
+ * Transforms @n bytes of whole lines at @p. Only the last block of the
+ * input may end without a newline.
+ */
+static void process(struct job *job, const char *p, size_t n)
+{
+	size_t skip = 0;
+	int ret = 0;
+
+	switch (job->cmd) {
+	case CMD_GREP:
+		str_consume_front(job->out, str_get_size(job->out));
+		job->matches += grep_chunk(job, p, n, job->out);
+		write_out(job->out->data, str_get_size(job->out));
+		return;
+
+	case CMD_TRIM:
+	case CMD_DEDUP:
+		str_consume_front(job->out, str_get_size(job->out));
+		while (n) {
+			const char *nl = memchr(p, '\n', n);
+			size_t len = nl ? (size_t)(nl - p) : n;
+
+			if (job->cmd == CMD_TRIM)
+				trim_line(job, p, len, nl != NULL);
+			else
+				dedup_line(job, p, len, nl != NULL);
+			p += len + (nl != NULL);
+			n -= len + (nl != NULL);
+		}
+		write_out(job->out->data, str_get_size(job->out));
+		return;
+
+	case CMD_SENTENCE:
+		/*
+		 * Prefix the tail of the previous block, so a separator ending
+		 * right at the boundary still capitalizes this block's first
+		 * character, then write only the new bytes.
+		 */
+		skip = job->have_prev ? str_get_size(job->prev) : 0;
+		load(job->work, job->prev->data, skip);
+		if (str_add_n(job->work, p, n))
+			die("str_add_n", ENOMEM);
+		ret = str_to_sentence_case(job->work, job->arg1);
+
+		size_t keep = strlen(job->arg1), len = str_get_size(job->work);
+		if (keep > len)
+			keep = len;
+		load(job->prev, job->work->data + len - keep, keep);
+		job->have_prev = 1;
+		break;
+
+	default:
+		load(job->work, p, n);
+		if (job->cmd == CMD_UPPER)
+			ret = str_to_upper(job->work);
+		else if (job->cmd == CMD_LOWER)
+			ret = str_to_lower(job->work);
+		else if (job->cmd == CMD_TITLE)
+			ret = str_to_title_case(job->work);
+		else if (job->cmd == CMD_NFC)
+			ret = str_normalize_nfc(job->work);
+		else if (job->cmd == CMD_NFD)
+			ret = str_normalize_nfd(job->work);
+		else if (job->cmd == CMD_REPLACE)
+			ret = str_swap_all(job->work, job->arg1, job->arg2);
+		else
+			ret = str_swap_all(job->work, job->arg1, "");
+		break;
+	}
+
+	if (ret < 0)
+		die(commands[job->cmd].name, ret == -1 ? EINVAL : -ret);
+	write_out(job->work->data + skip, str_get_size(job->work) - skip);
+}
+
+/*
+ * Feeds the blocks of whole lines read from @fd to process(). A line longer
+ * than the ring is collected in @pending until its newline arrives.
+ */
+static void run(struct job *job, str_ring *ring, str *pending, int fd, const char *name)
+{
+	for (;;) {
+		ssize_t got = str_ring_read(ring, fd);
+		if (got == -EINTR)
+			continue;
+		if (got < 0)
+			die(name, (int)-got);
+
+		const char *data = str_ring_data(ring);
+		size_t len = str_ring_get_size(ring);
+
+		if (got == 0) {
+			/* end of file: flush whatever is left, newline or not */
+			if (str_get_size(pending)) {
+				if (str_add_n(pending, data, len))
+					die("str_add_n", ENOMEM);
+				process(job, pending->data, str_get_size(pending));
+				str_consume_front(pending, str_get_size(pending));
+			} else if (len) {
+				process(job, data, len);
+			}
+			str_ring_consume(ring, len);
+			return;
+		}
+
+		const char *nl = memrchr(data, '\n', len);
+		if (!nl) {
+			if (len == ring->size) {
+				if (str_add_n(pending, data, len))
+					die("str_add_n", ENOMEM);
+				str_ring_consume(ring, len);
+			}
+			continue;
+		}
+
+		size_t n = (size_t)(nl - data) + 1;
+		if (str_get_size(pending)) {
+			if (str_add_n(pending, data, n))
+				die("str_add_n", ENOMEM);
+			process(job, pending->data, str_get_size(pending));
+			str_consume_front(pending, str_get_size(pending));
+		} else {
+			process(job, data, n);
+		}
+		str_ring_consume(ring, n);
+	}
+}
+
+/* Maps regular files for grep_mapped(); streams everything else through run(). */
+static void grep_file(struct job *job, str_ring *ring, str *pending, int fd, const char *name)
+{
+	struct stat st;
+	void *map = MAP_FAILED;
+
+	job->matches = 0;
+	if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+	    (uint64_t)st.st_size <= SIZE_MAX)
+		map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (map != MAP_FAILED) {
+		madvise(map, (size_t)st.st_size, MADV_SEQUENTIAL);
+		grep_mapped(job, (const char *)map, (size_t)st.st_size);
+		munmap(map, (size_t)st.st_size);
+	} else {
+		run(job, ring, pending, fd, name);
+	}
+
+	if (job->count_only) {
+		char line[64];
+		int len = snprintf(line, sizeof(line), "%zu\n", job->matches);
+
+		if (job->name)
+			write_out(job->name, strlen(job->name)), write_out(":", 1);
+		write_out(line, (size_t)len);
+	}
+}
+
+/* Parses the grep options and patterns starting at argv[*i]. */
+static void grep_args(struct job *job, int argc, char **argv, int *i)
+{
+	job->pats = (const char **)calloc((size_t)argc, sizeof(*job->pats));
+	job->plens = (size_t *)calloc((size_t)argc, sizeof(*job->plens));
+	job->threads = sysconf(_SC_NPROCESSORS_ONLN);
+	if (!job->pats || !job->plens)
+		die("grep", ENOMEM);
+
+	for (; *i < argc && argv[*i][0] == '-' && argv[*i][1]; (*i)++) {
+		if (!strcmp(argv[*i], "-c"))
+			job->count_only = 1;
+		else if (!strcmp(argv[*i], "-j") && *i + 1 < argc)
+			job->threads = atol(argv[++*i]);
+		else if (!strcmp(argv[*i], "-e") && *i + 1 < argc)
+			job->pats[job->npats++] = argv[++*i];
+		else if (!strcmp(argv[*i], "--")) {
+			(*i)++;
+			break;
+		} else
+			usage(argv[0]);
+	}
+	if (!job->npats) {
+		if (*i == argc)
+			usage(argv[0]);
+		job->pats[job->npats++] = argv[(*i)++];
+	}
+
+	if (job->threads < 1)
+		job->threads = 1;
+	if (job->threads > STRUTIL_GREP_THREADS)
+		job->threads = STRUTIL_GREP_THREADS;
+
+	for (size_t k = 0; k < job->npats; k++) {
+		job->plens[k] = strlen(job->pats[k]);
+		if (!job->plens[k] || strchr(job->pats[k], '\n')) {
+			fprintf(stderr, "strutil: grep: pattern must be non-empty and within one line\n");
+			exit(2);
+		}
+	}
+	if (job->npats > 1 && !(job->ac = str_ac_init(job->pats, job->plens, job->npats)))
+		die("grep", errno);
+}
+
+int main(int argc, char **argv)
+{
+	struct job job;
+	int i = 1;
+
+	memset(&job, 0, sizeof(job));
+	if (argc < 2)
+		usage(argv[0]);
+
+	for (job.cmd = CMD_UPPER; job.cmd <= CMD_GREP; job.cmd++)
+		if (!strcmp(argv[i], commands[job.cmd].name))
+			break;
+	if (job.cmd > CMD_GREP)
+		usage(argv[0]);
+	i++;
+
+	if (job.cmd == CMD_GREP) {
+		fail_status = 2;
+		grep_args(&job, argc, argv, &i);
+		if (argc - i > 1)
+			job.name = "";	/* replaced by each file's name below */
+	}
+	if (job.cmd == CMD_SENTENCE) {
+		job.arg1 = ". ";
+		if (i + 1 < argc && !strcmp(argv[i], "-s"))
+			job.arg1 = argv[i + 1], i += 2;
+	}
+	if (commands[job.cmd].nargs) {
+		if (argc - i < commands[job.cmd].nargs)
+			usage(argv[0]);
+		job.arg1 = argv[i++];
+		if (commands[job.cmd].nargs > 1)
+			job.arg2 = argv[i++];
+	}
+	if (job.arg1 && (!*job.arg1 || (job.cmd != CMD_SENTENCE && strchr(job.arg1, '\n')))) {
+		fprintf(stderr, "strutil: %s: pattern must be non-empty and within one line\n",
+			commands[job.cmd].name);
+		return 2;
+	}
+
+	str_ring *ring = str_ring_init(STRUTIL_BLOCK);
+	str *pending = str_init();
+
+	job.work = str_init();
+	job.out = str_init();
+	job.prev = str_init();
+	if (!ring || !pending || !job.work || !job.out || !job.prev)
+		die("init", errno ? errno : ENOMEM);
+
+	/* str functions expect initialized data, even when empty */
+	load(pending, "", 0);
+	load(job.work, "", 0);
+	load(job.out, "", 0);
+	load(job.prev, "", 0);
+
+	size_t matches = 0;
+
+	if (i == argc) {
+		if (job.cmd == CMD_GREP)
+			grep_file(&job, ring, pending, STDIN_FILENO, "stdin");
+		else
+			run(&job, ring, pending, STDIN_FILENO, "stdin");
+		matches = job.matches;
+	}
+	for (; i < argc; i++) {
+		int fd = strcmp(argv[i], "-") ? open(argv[i], O_RDONLY) : STDIN_FILENO;
+		if (fd < 0)
+			die(argv[i], errno);
+
+		if (job.cmd == CMD_GREP) {
+			if (job.name)
+				job.name = fd == STDIN_FILENO ? "(standard input)" : argv[i];
+			grep_file(&job, ring, pending, fd, argv[i]);
+			matches += job.matches;
+		} else {
+			run(&job, ring, pending, fd, argv[i]);
+		}
+		if (fd != STDIN_FILENO)
+			close(fd);
+	}
+
+	str_free(job.prev);
+	str_free(job.out);
+	str_free(job.work);
+	str_free(pending);
+	str_ring_free(ring);
+	str_ac_free(job.ac);
+	free(job.plens);
+	free(job.pats);
+	if (job.cmd == CMD_GREP)
+		return matches ? 0 : 1;
+	return 0;
+}
@@ -1,477 +1,10334 @@
-#ifndef _STRUTIL_H_
-#define _STRUTIL_H_ 1
-
-#ifdef __cplusplus
-extern "C" {
-#endif	/* __cplusplus */
-
-#include <stdio.h>   /* printf */
-#include <string.h>  /* strlen, strcpy ... */
-#include <stdlib.h>  /* malloc, calloc, realloc ... */
-#include <stdint.h>  /* uint8_t */
-#include <ctype.h>
-#include <assert.h>
-#include <errno.h>
-
-#if defined(__has_attribute)
-  #if __has_attribute(warn_unused_result)
-    #define STR_WARN_UNUSED_RESULT __attribute((warn_unused_result))
-  #else
-    #define STR_WARN_UNUSED_RESULT
-  #endif
-#else
-  #define STR_WARN_UNUSED_RESULT
-#endif
-
-#define MAX_STRING_SIZE SIZE_MAX
-
-
-typedef struct Str {
-	char	*data;
-	uint8_t is_dynamic;
-} str;
-
-
-/* FUNCTIONS -> */
-str	*str_init(void) STR_WARN_UNUSED_RESULT;
-int	str_add(str *self, const char *_data);
-int  	str_input(str *self);
-void    str_print(const str *self);
-void    str_free(str *self);
-int     str_pop_back(str *self, char sep);
-size_t  str_get_size(const str *self);
-void    str_clear(str *self);
-int	str_rem_word(str *self, const char *needle);
-const char *str_get_data(const str *self);
-
-static char* get_dyn_input(size_t max_str_size) STR_WARN_UNUSED_RESULT;
-int str_swap_word(str *self, const char *word1, const char *word2);
-
-//Functions planned to be written.
-int str_to_upper(str *self);
-int str_to_lower(str *self);
-int str_to_title_case(str *self);
-int str_to_sentence_case(str *self, const char *sep);
-/* <- FUNCTIONS */
-
-
-
-/*
- * str_init() - Initializes a new Str structure.
- *
- * This function initializes a new Str structure and allocates memory for it.
- * The caller is responsible for freeing the returned structure using str_free().
- * 
- * Returns:
- *     A pointer to the newly initialized Str structure, or NULL if memory allocation fails.
- */
-
-str *str_init()
-{
-	str *tmp = (str *)calloc(1, sizeof(str));
-	if (!tmp)
-		return NULL;
-
-	tmp->is_dynamic = 1;
-	return tmp;
-}
-
-
-/*
- * str_add() - Adds a string to the data member of a Str structure.
- * @self: Pointer to the Str structure.
- * @_data: Pointer to the string to be added.
- *
- * This function adds the string @_data to the data member of the Str structure @self.
- * If @self->data is not empty, @_data is appended with a space at the end.
- * 
- * Returns:
- *     0 on successful completion
- *    -1 if @self or @_data is NULL, or if memory allocation fails
- */
-int str_add(str *self, const char *_data)
-{
-	assert(self != NULL);
-
-	if (_data == NULL) {
-		return -EINVAL;
-	}
-
-	size_t self_data_size = self->data ? strlen(self->data) : 0;
-	size_t new_size = self_data_size + strlen(_data) + 2; // +2 for null
-	if (new_size >= MAX_STRING_SIZE) {
-		return -EINVAL;
-	}
-
-	char *new_data = realloc(self->data, new_size);
-	if (!new_data)
-		return -ENOMEM;
-
-	if (self->data == NULL) {
-		strcpy(new_data, _data); // Copy data if it's the first addition
-	} else {
-		strcat(new_data, _data); // Append new data
-	}
-
-	self->data = new_data;
-
-	return 0;
-}
-
-
-/*
- * str_input() - Adds a string from the terminal to the data member of a Str structure.
- * @self: Pointer to the Str structure.
- *
- * This function adds a string received from the terminal to the data member of the Str structure @self.
- * If @self->data is not empty, the received value is appended with a space.
- * 
- * Returns:
- *     0 on successful completion
- */
-
-int str_input(str *self)
-{
-	assert(self != NULL);
-
-	if (!self->data) {
-		self->data = get_dyn_input(MAX_STRING_SIZE);
-		return (self->data ? 0 : -EINVAL);
-	}
-
-
-	char *buf = get_dyn_input(MAX_STRING_SIZE - strlen(self->data));
-	if (!buf)
-		return -1;
-
-	char *self_data_ptr = (char *)realloc(self->data, (strlen(self->data) + strlen(buf) + 1));
-	if (!self_data_ptr)
-		return -ENOMEM;
-
-	strncat(self->data, buf, strlen(buf));
-
-	free(buf);
-	return 0;
-}
-
-
-/*
- * str_pop_back() - Removes the last character from the string in a Str structure.
- * @self: Pointer to the Str structure.
- * @sep: Separator character to be removed.
- *
- * This function removes the last occurrence of the separator character @sep 
- * from the string in the Str structure @self->data. If @self->data is empty or 
- * does not contain @sep, the function fails with -1.
- * 
- * Returns:
- *     0 on successful completion
- *    -1 if @self->data is NULL or empty, or if @sep is not found
- */
-int str_pop_back(str *self, char sep)
-{
-	if (self->data == NULL || strlen(self->data) == 0)
-		return -EINVAL;
-
-	char *p = strrchr(self->data, sep);
-	if (!p)
-		return -EINVAL;
-
-	*p = '\0';
-
-	char *self_data_ptr = (char *)realloc(self->data, strlen(self->data) + 1); // Trim memory
-	if (!self_data_ptr)
-		return -ENOMEM;
-	
-	self->data = self_data_ptr;
-	return 0;
-}
-
-/*
- * If @self->data is not empty, it prints the value in it to the terminal.
- */
-void str_print(const str *self)
-{
-	if (self->data) {
-		printf("%s", self->data);
-		fflush(stdout);
-	}
-}
-
-
-/*
- * If @self->data is not empty, it returns the number of characters in it.
- * @self: The struct that contains our return value.
- */
-size_t str_get_size(const str *self)
-{
-    	return (self->data ? strlen(self->data) : 0);
-}
-
-
-/*
- * If the 'data' member of the @self parameter is not empty,
- * it returns the 'data' member as 'const char *'.
- */
-const char *str_get_data(const str *self)
-{
-    	return (const char *)self->data;
-}
-
-/*
- * It only releases @self->data. It does not delete @self;
- */
-void str_clear(str *self)
-{
-	if (self->data) {
-		free(self->data);
-		self->data = NULL;
-	}
-}
-
-
-/*
- * It releases @str.
- */
-void str_free(str *self)
-{
-	if (self) { // Check NULL
-		if (self->data) {
-			free(self->data);
-			self->data = NULL;
-		}
-		if (self->is_dynamic) {
-			free(self);
-			self = NULL;
-		}
-	}
-}
-
-
-/*
- * get_dyn_input() - Dynamically reads input from the terminal.
- * @max_str_size: Maximum size of the input string to be read.
- *
- * This function dynamically reads input from the terminal, allocating memory as needed.
- * It continues reading characters until EOF or newline ('\n') is encountered, dynamically 
- * resizing the memory buffer as necessary. The caller is responsible for freeing the 
- * returned buffer.
- * 
- * Returns:
- *     A dynamically allocated buffer containing the input string read from the terminal,
- *     or NULL if memory allocation fails or EOF is encountered before any characters are read.
- */
-static char* get_dyn_input(size_t max_str_size)
-{
-	const int CHUNK_SIZE = 10;
-	char* buffer = (char *)calloc(CHUNK_SIZE,  sizeof(char));
-
-	if (buffer == NULL) 
-		return NULL;
-
-	size_t current_size = CHUNK_SIZE; // Size of available memory.
-	size_t length = 0; // Length of current string
-
-	int c;
-	while ((c = getchar()) != EOF && c != '\n') {
-		if (length + 1 >= current_size) { // Expand memory
-			current_size += CHUNK_SIZE;			
-			char* tmp = realloc(buffer, current_size);
-
-			if (tmp == NULL) {
-				free(buffer);
-				return NULL;
-			}
-			buffer = tmp;
-		}
-
-		if (current_size >= (max_str_size - 1)) {
-			free(buffer);
-			return NULL;
-		}
-
-		buffer[length++] = (char)c;
-		buffer[length] = '\0'; // End the series
-	}
-
-	// Finally release the extra memory
-	char *result = (char *)malloc((length + 1) * sizeof(char));
-	if (result == NULL) {
-		free(buffer);
-		return NULL;
-	}
-	
-	strncpy(result, buffer, strlen(buffer));
-	result[strlen(buffer)] = '\0';
-
-	free(buffer);
-	return result;
-}
-
-/*
- * str_rem_word() - Removes a specific word from the string.
- * @self: Pointer to the Str structure.
- * @needle: The word to be removed from @self->data.
- *
- * This function removes the specific word @needle from @self->data. 
- * If @needle cannot be found, the function fails with -1.
- * 
- * Returns:
- *     0 on successful completion
- *    -1 if @self, @self->data, or @needle is NULL, or if @needle cannot be found
- *
- * Note: This function is designed to manage dynamic memory governed by the 
- * @self->is_dynamic property. The caller is responsible for freeing 
- * the returned data to continue accessing the modified data.
- */
-int str_rem_word(str *self, const char *needle)
-{
-        if (!self && !self->data && !needle)
-        	return -EINVAL;
-            
-        size_t self_data_size = strlen(self->data);
-        size_t needle_size = strlen(needle);
-        
-        if (needle_size > self_data_size)
-        	return -EINVAL;
-            
-        char *L = NULL;
-        L = strstr(self->data, needle);
-        if(!L)
-        	return -EINVAL;
-
-        memmove(L, L + needle_size, self_data_size - (L - self->data) - needle_size + 1);
-	self->data[self_data_size - needle_size] = '\0';
-        
-        char *buf = (char*)realloc(self->data, 
-                ((self_data_size - needle_size)) +1);
-        
-	if (!buf)	// realloc başarısız oldu; ancak kelime diziden kaldırıldı ve sonuna NULL eklendi
-		return -ENOMEM;
-
-        if (buf)
-        	self->data = buf;
-
-	return 0;
-}
-
-
-/*
- * str_swap_word() - Replaces a specific word with another word.
- * @self: Pointer to the Str structure.
- * @word1: The word to be replaced.
- * @word2: The new word to replace @word1.
- *
- * This function replaces the specific word @word1 found in @self->data 
- * with @word2. If @word1 cannot be found, the function fails with -1.
- * 
- * Returns:
- *     0 on successful completion
- *    -1 if an error occurred
- *
- * Note: This function is designed to manage dynamic memory governed by the 
- * @self->is_dynamic property. The caller is responsible for freeing 
- * the returned data to continue accessing the modified data.
- */
-int str_swap_word(str *self, const char *word1, const char *word2)
-{
-	if (!self && !self->data && !self->is_dynamic && !word1 && !word2)
-		return -1;
-
-	size_t self_data_size = strlen(self->data);
-	size_t word1_size = strlen(word1);
-	size_t word2_size = strlen(word2);
-
-	char *L = strstr(self->data, word1);
-	if (!L)
-		return -1;
-
-	size_t new_size = self_data_size - word1_size + word2_size;
-	char *buf = (char *)malloc(sizeof(char) * (new_size + 1)); // +1 for null terminator
-	if (!buf)
-		return -1;
-
-	// Copy everything before word1
-	strncpy(buf, self->data, L - self->data);
-	buf[L - self->data] = '\0'; // Null terminate the buffer
-
-	// Copy word2
-	strcat(buf, word2);
-
-	// Copy everything after word1
-	strcat(buf, L + word1_size);
-
-	free(self->data);
-	self->data = buf;
-
-	return 0;
-}
-
-
-int str_to_upper(str *self)
-{
-	char *p = self->data;
-
-	if (!self && !self->data)
-		return -1;
-	
-	while (*p) {
-		*p = toupper((int)*p);
-		p++;
-	}
-
-	return 0;
-}
-
-
-int str_to_lower(str *self)
-{
-	char *p = self->data;
-
-	if (!self && !self->data)
-		return -1;
-	
-	while (*p) {
-		*p = tolower((int)*p);
-		p++;
-	}
-
-	return 0;
-}
-
-
-int str_to_sentence_case(str *self, const char *sep)
-{
-	if (!self && !self->data && !sep)
-		return -1;
-
-	char *end = NULL;
-	char *self_data_ptr = self->data;
-
-	if (*self_data_ptr) {
-		*self_data_ptr = toupper((int)*self_data_ptr);
-		self_data_ptr++;
-	}
-
-	end = strstr(self_data_ptr, sep);
-	while (end != NULL && *end != '\0') {
-		for (int i = 0; i < strlen(sep); i++) {
-			end++;
-			self_data_ptr++;
-			if (*end == '\0') {
-				break;
-			}
-		}
-		*end = toupper((int)*end);
-		end = strstr(self_data_ptr, sep);
-	}
-	return 0;
-}
-
-int str_to_title_case(str *self);
-
-#ifdef __cplusplus
-}
-#endif /* __cplusplus */
-
-#endif /* _XSTRING_H_ */
+#ifndef _STRUTIL_H_
+#define _STRUTIL_H_ 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#include <stdio.h>   /* printf */
+#include <string.h>  /* strlen, strcpy ... */
+#include <stdlib.h>  /* malloc, calloc, realloc ... */
+#include <stddef.h>  /* ptrdiff_t */
+#include <stdint.h>  /* uint8_t */
+#include <ctype.h>
+#include <assert.h>
+#include <errno.h>
+#include <limits.h>  /* INT_MAX */
+
+/*
+ * The POSIX parts (shared memory, rings, file loading and following) need
+ * POSIX.1-2008. Strict ISO C modes such as -std=c99 hide it unless a feature
+ * macro like _POSIX_C_SOURCE=200809L or _GNU_SOURCE is defined before the
+ * first #include; without one only the portable functions are compiled.
+ */
+#if (defined(__unix__) || defined(__APPLE__)) && \
+    (!defined(__STRICT_ANSI__) || (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200809L) || \
+     (defined(_XOPEN_SOURCE) && _XOPEN_SOURCE >= 700) || defined(_GNU_SOURCE) || \
+     defined(_DEFAULT_SOURCE) || defined(_BSD_SOURCE))
+  #include <unistd.h>    /* read, ftruncate, sysconf */
+  #include <fcntl.h>
+  #include <sys/mman.h>  /* mmap, munmap */
+  #include <sys/stat.h>
+  #include <poll.h>
+  #include <sys/socket.h> /* sendmsg, SCM_RIGHTS */
+  #include <sys/uio.h>    /* writev */
+  #define STR_HAVE_POSIX 1
+#endif
+#if defined(__linux__) && defined(STR_HAVE_POSIX)
+  #include <sys/syscall.h> /* SYS_memfd_create */
+  #include <sys/inotify.h>
+  #define STR_HAVE_INOTIFY 1
+#endif
+
+#if defined(__SSE4_2__)
+  #include <nmmintrin.h> /* _mm_crc32_u64 */
+#endif
+#if defined(__AVX2__)
+  #include <immintrin.h> /* _mm256_cmpeq_epi8 */
+#elif defined(__SSE2__)
+  #include <emmintrin.h> /* _mm_cmpeq_epi8 */
+#endif
+
+#if defined(STR_METRICS)
+  #include <time.h>        /* clock_gettime */
+  #if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h> /* __rdtsc */
+  #endif
+#endif
+
+#if defined(__has_attribute)
+  #if __has_attribute(warn_unused_result)
+    #define STR_WARN_UNUSED_RESULT __attribute((warn_unused_result))
+  #else
+    #define STR_WARN_UNUSED_RESULT
+  #endif
+#else
+  #define STR_WARN_UNUSED_RESULT
+#endif
+
+/*
+ * The allocation profiler charges each allocation to the address a traced
+ * function returns to (see STR_TRACE()), which is only the caller's if the
+ * function was not inlined into it.
+ */
+#if defined(STR_ALLOC_PROFILE)
+  #define STR_TRACED __attribute__((noinline))
+#else
+  #define STR_TRACED
+#endif
+
+#define MAX_STRING_SIZE SIZE_MAX
+
+/*
+ * Smallest capacity allocated for a non-empty string, and the amount of
+ * consumed front space (see str_consume_front()) that has to pile up before
+ * an append slides the contents back instead of growing the buffer.
+ */
+#define STR_MIN_CAP	15
+#define STR_COMPACT_MIN	64
+
+/*
+ * Initial buffer for str_load_fd() when the input size is unknown (pipes,
+ * sockets, procfs). Define STR_LOAD_FADVISE to 1 to have it hint sequential
+ * access to the kernel before reading.
+ */
+#define STR_LOAD_CHUNK	65536
+#ifndef STR_LOAD_FADVISE
+  #define STR_LOAD_FADVISE 0
+#endif
+
+/*
+ * Longest single sleep of str_follow_wait() when inotify is not available,
+ * so a caller waiting with no timeout still polls the file for new lines.
+ */
+#define STR_FOLLOW_POLL_MS	250
+
+/*
+ * Frame streams (str_frame_write() / str_frame_read()) move data in blocks
+ * of STR_FRAME_BUF bytes and refuse frames larger than STR_FRAME_MAX.
+ */
+#define STR_FRAME_BUF	65536
+#ifndef STR_FRAME_MAX
+  #define STR_FRAME_MAX	((size_t)1 << 28)
+#endif
+#define STR_FRAME_CRC	0x01	/* str_frame_write(): add a CRC32C */
+
+/* str_wrap() modes; STR_WRAP_JUSTIFY combines with either line breaker. */
+#define STR_WRAP_GREEDY		0x00	/* fill each line as far as it goes */
+#define STR_WRAP_OPTIMAL	0x01	/* minimize raggedness over each paragraph */
+#define STR_WRAP_JUSTIFY	0x02	/* pad lines to the width, except a paragraph's last */
+
+/* Flags for the str_from_* and str_to_* transcoders. */
+#define STR_UTF_BE	0x01	/* UTF-16/UTF-32 code units are big-endian */
+#define STR_UTF_BOM	0x02	/* start the output with a byte order mark */
+#define STR_UTF_REPLACE	0x04	/* substitute U+FFFD ('?' in Latin-1) for invalid input */
+
+/* str_seg_init() kinds. */
+#define STR_SEG_WORD		0	/* UAX #29 word boundaries */
+#define STR_SEG_SENTENCE	1	/* UAX #29 sentence boundaries */
+
+/* str_wordset_init() flags. */
+#define STR_WORDSET_ICASE	0x01	/* match ASCII letters in either case */
+
+/* str_diff() granularity. */
+#define STR_DIFF_LINES		0	/* compare whole lines, each with its '\n' */
+#define STR_DIFF_BYTES		1	/* compare single bytes */
+
+
+/*
+ * Reference count of a buffer shared between a string and the substrings
+ * taken from it with str_substr().
+ */
+struct str_share {
+	size_t	refs;
+	char	*base;	/* the allocation, freed with the last reference */
+	size_t	size;	/* bytes allocated at @base */
+};
+
+
+/*
+ * @data points @head bytes into the allocation, so that bytes can be
+ * prepended or consumed at the front without moving the rest. @len bytes
+ * are in use and @data[@len] is '\0'; @cap more bytes may be used before
+ * the buffer has to grow.
+ *
+ * While @share is set the buffer is read-only and may belong to other
+ * strings as well; the first modification copies it. A substring is not
+ * NUL-terminated unless it reaches the end of its parent.
+ *
+ * With STR_F_MAPPED the buffer is a shared memory mapping of @fd that
+ * cannot grow past @cap (see str_init_shared()).
+ */
+#define STR_F_MAPPED	0x01	/* @data lives in a mapping of @fd */
+#define STR_F_RDONLY	0x02	/* the contents cannot be modified */
+#define STR_F_SAMPLED	0x04	/* tracked by the allocation profiler */
+
+typedef struct Str {
+	char	*data;
+	uint8_t is_dynamic;
+	uint8_t flags;	/* STR_F_* */
+	size_t	len;	/* bytes in use, excluding the terminating NUL */
+	size_t	cap;	/* bytes usable from @data, excluding the NUL */
+	size_t	head;	/* free bytes in front of @data */
+	struct str_share *share;
+	int	fd;	/* memfd behind a STR_F_MAPPED buffer */
+	size_t	dwidth;	/* display width + 1, 0 if not known (see str_display_width()) */
+} str;
+
+
+/*
+ * str_ref - 16-byte string header with an inline prefix.
+ *
+ * Strings of up to STR_REF_INLINE bytes live entirely inside @buf. Longer
+ * strings keep their first four bytes in @buf and a pointer to the full
+ * contents in the remaining eight, so most comparisons are decided without
+ * touching the pointed-to bytes. Those bytes are borrowed: the caller keeps
+ * them alive and unchanged for as long as the reference is in use.
+ */
+#define STR_REF_INLINE	12
+#define STR_REF_PREFIX	4
+
+typedef struct StrRef {
+	uint32_t len;
+	char	 buf[STR_REF_INLINE];	/* inline bytes, or prefix + pointer */
+} str_ref;
+
+
+/*
+ * str_seg - Iterator over the words or sentences of a UTF-8 text.
+ *
+ * Segments are returned as views into the text, which is never copied or
+ * modified (see str_seg_next()).
+ */
+typedef struct StrSeg {
+	const char *data;
+	size_t	len;
+	size_t	pos;		/* offset of the next segment */
+	int	kind;		/* STR_SEG_WORD or STR_SEG_SENTENCE */
+	int	is_word;	/* the last word segment holds a letter, digit or ideograph */
+} str_seg;
+
+
+/*
+ * str_edit - Edit script made by str_diff().
+ *
+ * Each hunk replaces @a_len bytes at offset @a_off of the old text with
+ * @b_len bytes, found at offset @b_off of the new text. Hunks are ordered
+ * and do not overlap. The inserted bytes of all hunks are also kept back to
+ * back in @text, so the script can be applied without the new text.
+ */
+struct str_hunk {
+	size_t	a_off;
+	size_t	a_len;		/* bytes deleted */
+	size_t	b_off;
+	size_t	b_len;		/* bytes inserted */
+};
+
+typedef struct StrEdit {
+	struct str_hunk *hunks;
+	size_t	len;		/* number of hunks */
+	char	*text;		/* inserted bytes */
+	size_t	a_size;		/* length of the old text */
+	size_t	b_size;		/* length of the new text */
+	uint64_t a_hash;	/* hash of the old text, checked by str_patch() */
+} str_edit;
+
+
+/*
+ * str_tmpl - Template with ${name} markers, compiled by str_tmpl_init().
+ */
+struct str_tmpl_var {
+	size_t	off;		/* offset of the "${" */
+	size_t	len;		/* bytes up to and including the '}' */
+};
+
+typedef struct StrTmpl {
+	char	*text;
+	size_t	len;
+	struct str_tmpl_var *vars;
+	size_t	count;		/* number of markers */
+} str_tmpl;
+
+/* Returns the value of @n bytes at @name and its length, or NULL if it is not defined. */
+typedef const char *(*str_lookup_fn)(void *ctx, const char *name, size_t n, size_t *len);
+
+
+/*
+ * str_kv - A key and its value, as views into the text they were parsed from
+ * (see str_parse_logfmt() and str_parse_headers()).
+ */
+struct str_kv {
+	const char *key;
+	size_t	key_len;
+	const char *val;
+	size_t	val_len;
+	int	quoted;		/* @val was in double quotes and may hold backslash escapes */
+};
+
+
+/*
+ * str_wordset - Fixed set of words, such as a stopword list, built by
+ * str_wordset_init().
+ *
+ * The words are placed by a perfect hash: each bucket of keys has its own
+ * displacement, chosen at build time so that no two words share a slot.
+ * A lookup costs one hash, one slot and one comparison.
+ */
+typedef struct StrWordset {
+	char	*text;		/* the words back to back, folded with STR_WORDSET_ICASE */
+	uint32_t *offs;		/* offset of each word given, and of the end of @text */
+	uint32_t *slots;	/* @mask + 1 slots: 1 + word index, 0 for none */
+	uint16_t *disp;		/* per bucket: displacement of its slots */
+	size_t	buckets;
+	size_t	mask;
+	size_t	count;		/* number of distinct words */
+	size_t	max_len;	/* longer tokens are not looked up */
+	int	flags;
+} str_wordset;
+
+
+/*
+ * str_vec - Growable array of str_ref headers.
+ */
+typedef struct StrVec {
+	str_ref *items;
+	size_t	 len;
+	size_t	 cap;
+} str_vec;
+
+
+/*
+ * str_ac - Aho-Corasick automaton for finding any of a set of patterns.
+ *
+ * The automaton is stored complete, one row of 256 transitions per state,
+ * so matching costs a single table lookup per input byte.
+ */
+typedef struct StrAc {
+	uint32_t *next;		/* @states rows of 256 transitions */
+	uint32_t *match;	/* per state: 1 + pattern ending there, 0 for none */
+	size_t	*lens;		/* pattern lengths */
+	size_t	states;
+	size_t	count;		/* number of patterns */
+	uint8_t	start[256];	/* bytes that leave the root state */
+} str_ac;
+
+
+#ifdef STR_HAVE_POSIX
+/*
+ * str_ring - Fixed-size byte ring for streaming parsers.
+ *
+ * The same @size bytes are mapped twice back to back at @base, so the unread
+ * bytes always appear contiguous at @base + @head, and so does the free space
+ * after them, however the ring has wrapped.
+ */
+typedef struct StrRing {
+	char	*base;
+	size_t	size;	/* bytes in the ring, a multiple of the page size */
+	size_t	head;	/* offset of the first unread byte, below @size */
+	size_t	len;	/* unread bytes */
+} str_ring;
+
+
+
+/*
+ * str_follow - Incremental reader of a growing file, like `tail -f`.
+ *
+ * New bytes are appended to @buf and complete lines are handed out as views
+ * into it, then consumed from its front. Rotation (a new file at @path) and
+ * truncation are detected by comparing the inode and size on every refill.
+ */
+typedef struct StrFollow {
+	char	*path;
+	int	fd;
+	dev_t	dev;
+	ino_t	ino;
+	off_t	off;		/* file offset of the next unread byte */
+	str	buf;		/* read but not yet consumed bytes */
+	size_t	scan;		/* bytes of @buf known to hold no newline */
+	size_t	pending;	/* bytes of the last returned line to consume */
+	int	ifd;		/* inotify instance, or -1 */
+	int	wd_file;
+	int	wd_dir;
+} str_follow;
+
+
+/*
+ * str_frame_writer / str_frame_reader - Length-prefixed frame streams.
+ *
+ * Each frame is a LEB128 varint holding (length << 1 | has_crc), then the
+ * CRC32C of the payload as four little-endian bytes if has_crc is set, then
+ * the payload itself. Frames may hold any bytes, including NUL and '\n'.
+ */
+typedef struct StrFrameWriter {
+	int	fd;
+	str	buf;		/* frames not yet written to @fd */
+} str_frame_writer;
+
+typedef struct StrFrameReader {
+	int	fd;
+	str	buf;		/* bytes read from @fd but not yet returned */
+	size_t	pending;	/* bytes of the last returned frame to consume */
+	int	eof;
+} str_frame_reader;
+#endif	/* STR_HAVE_POSIX */
+
+
+/*
+ * Optional latency and size histograms for the public str_* functions.
+ *
+ * Build with -DSTR_METRICS (GCC or Clang) to record, for every call, the
+ * elapsed time and the length of the string it operated on into log-linear
+ * buckets (about 12% resolution). Counters live in a per-thread block, so
+ * recording costs two timestamp reads and two increments, and nested library
+ * calls are charged to the outermost one. str_metrics_snapshot() merges all
+ * threads and reports percentiles. Without STR_METRICS nothing is compiled in.
+ */
+enum str_metric_fn {
+	STR_M_ADD,
+	STR_M_ADD_N,
+	STR_M_INPUT,
+	STR_M_PREPEND,
+	STR_M_PREPEND_N,
+	STR_M_CONSUME_FRONT,
+	STR_M_POP_FRONT,
+	STR_M_POP_BACK,
+	STR_M_SUBSTR,
+	STR_M_DETACH,
+	STR_M_REM_WORD,
+	STR_M_SWAP_WORD,
+	STR_M_SWAP_ALL,
+	STR_M_TO_UPPER,
+	STR_M_TO_LOWER,
+	STR_M_TO_TITLE_CASE,
+	STR_M_TO_SENTENCE_CASE,
+	STR_M_WRAP,
+	STR_M_DISPLAY_WIDTH,
+	STR_M_FROM_UTF16,
+	STR_M_FROM_UTF32,
+	STR_M_FROM_LATIN1,
+	STR_M_TO_UTF16,
+	STR_M_TO_UTF32,
+	STR_M_TO_LATIN1,
+	STR_M_NORMALIZE_NFC,
+	STR_M_NORMALIZE_NFD,
+	STR_M_DIFF,
+	STR_M_PATCH,
+	STR_M_EXPAND,
+	STR_M_TMPL_RENDER,
+	STR_M_PARSE_LOGFMT,
+	STR_M_PARSE_HEADERS,
+	STR_M_REM_WORDS,
+	STR_M_LOAD_FD,
+	STR_M_FOLLOW_NEXT,
+	STR_M_FRAME_WRITE,
+	STR_M_FRAME_READ,
+	STR_M_COUNT
+};
+
+struct str_metric_stats {
+	const char *name;
+	uint64_t calls;
+	double	lat_p50_ns;
+	double	lat_p90_ns;
+	double	lat_p99_ns;
+	double	lat_p999_ns;
+	double	lat_max_ns;
+	uint64_t size_p50;
+	uint64_t size_p99;
+	uint64_t size_max;
+};
+
+
+/*
+ * Optional sampling profiler for buffer allocations.
+ *
+ * Build with -DSTR_ALLOC_PROFILE to record every STR_ALLOC_SAMPLE-th buffer
+ * (re)allocation made by the library together with the return address of
+ * the outermost str_* call that caused it. str_alloc_report() ranks those
+ * call sites by estimated bytes or count, and str_alloc_waste_report() lists
+ * sampled strings that are still alive with far more capacity than length.
+ * Strings have to be released with str_clear() or str_free() to leave the
+ * waste report. Traced functions are kept out of line in such builds (see
+ * STR_TRACED), so a site is always an address in the calling function.
+ */
+struct str_alloc_site_stats {
+	void	*site;		/* NULL for allocations outside traced calls */
+	uint64_t count;		/* estimated number of (re)allocations */
+	uint64_t bytes;		/* estimated bytes requested */
+};
+
+struct str_alloc_waste {
+	const str *s;
+	void	*site;		/* call site of the last sampled allocation */
+	size_t	len;
+	size_t	alloc;		/* bytes allocated for the buffer */
+};
+
+
+/* FUNCTIONS -> */
+str	*str_init(void) STR_WARN_UNUSED_RESULT;
+int	str_add(str *self, const char *_data) STR_TRACED;
+int	str_add_n(str *self, const char *_data, size_t n) STR_TRACED;
+int	str_prepend(str *self, const char *_data) STR_TRACED;
+int	str_prepend_n(str *self, const char *_data, size_t n) STR_TRACED;
+int	str_consume_front(str *self, size_t n) STR_TRACED;
+int	str_pop_front(str *self, char sep) STR_TRACED;
+str	*str_substr(str *self, size_t off, size_t len) STR_WARN_UNUSED_RESULT STR_TRACED;
+int	str_detach(str *self) STR_TRACED;
+int  	str_input(str *self) STR_TRACED;
+void    str_print(const str *self);
+void    str_free(str *self);
+int     str_pop_back(str *self, char sep) STR_TRACED;
+size_t  str_get_size(const str *self);
+void    str_clear(str *self);
+int	str_rem_word(str *self, const char *needle) STR_TRACED;
+const char *str_get_data(const str *self);
+size_t	str_display_width(str *self) STR_TRACED;
+size_t	str_display_width_n(const char *s, size_t n);
+size_t	str_utf8_valid(const char *s, size_t n);
+int	str_from_utf16(str *self, const char *src, size_t n, int flags) STR_TRACED;
+int	str_from_utf32(str *self, const char *src, size_t n, int flags) STR_TRACED;
+int	str_from_latin1(str *self, const char *src, size_t n) STR_TRACED;
+int	str_to_utf16(const str *self, str *out, int flags) STR_TRACED;
+int	str_to_utf32(const str *self, str *out, int flags) STR_TRACED;
+int	str_to_latin1(const str *self, str *out, int flags) STR_TRACED;
+int	str_normalize_nfc(str *self) STR_TRACED;
+int	str_normalize_nfd(str *self) STR_TRACED;
+void	str_seg_init(str_seg *self, const char *data, size_t len, int kind);
+int	str_seg_next(str_seg *self, const char **seg, size_t *n);
+str_edit *str_diff(const str *a, const str *b, int mode) STR_WARN_UNUSED_RESULT STR_TRACED;
+int	str_patch(str *self, const str_edit *edit) STR_TRACED;
+void	str_edit_free(str_edit *edit);
+int	str_expand(str *self, str_lookup_fn lookup, void *ctx) STR_TRACED;
+str_tmpl *str_tmpl_init(const char *s, size_t n) STR_WARN_UNUSED_RESULT;
+int	str_tmpl_render(const str_tmpl *self, str *out, str_lookup_fn lookup, void *ctx) STR_TRACED;
+void	str_tmpl_free(str_tmpl *tmpl);
+int	str_parse_logfmt(const char *s, size_t n, struct str_kv *out, size_t max) STR_TRACED;
+int	str_parse_headers(const char *s, size_t n, struct str_kv *out, size_t max, size_t *used) STR_TRACED;
+str_wordset *str_wordset_init(const char *const *words, const size_t *lens, size_t n,
+			      int flags) STR_WARN_UNUSED_RESULT;
+int	str_wordset_has(const str_wordset *self, const char *word, size_t n);
+void	str_wordset_free(str_wordset *self);
+int	str_rem_words(str *self, const str_wordset *set) STR_TRACED;
+
+static char* get_dyn_input(size_t max_str_size) STR_WARN_UNUSED_RESULT;
+int str_swap_word(str *self, const char *word1, const char *word2) STR_TRACED;
+int str_swap_all(str *self, const char *word1, const char *word2) STR_TRACED;
+
+//Functions planned to be written.
+int str_to_upper(str *self) STR_TRACED;
+int str_to_lower(str *self) STR_TRACED;
+int str_to_title_case(str *self) STR_TRACED;
+int str_wrap(str *self, size_t width, int mode) STR_TRACED;
+int str_to_sentence_case(str *self, const char *sep) STR_TRACED;
+
+int	str_ref_init(str_ref *ref, const char *s, size_t n);
+int	str_ref_from_str(str_ref *ref, const str *self);
+const char *str_ref_data(const str_ref *ref);
+int	str_ref_eq(const str_ref *a, const str_ref *b);
+int	str_ref_cmp(const str_ref *a, const str_ref *b);
+int	str_ref_starts_with(const str_ref *self, const str_ref *prefix);
+
+str_vec	*str_vec_init(void) STR_WARN_UNUSED_RESULT;
+int	str_vec_push(str_vec *self, const char *s, size_t n);
+void	str_vec_sort(str_vec *self);
+void	str_vec_free(str_vec *self);
+
+uint32_t str_crc32c(uint32_t crc, const void *buf, size_t n);
+const char *str_find_n(const char *hay, size_t n, const char *needle, size_t m);
+
+str_ac	*str_ac_init(const char *const *pats, const size_t *lens, size_t n) STR_WARN_UNUSED_RESULT;
+const char *str_ac_find(const str_ac *self, const char *hay, size_t n, size_t *which);
+void	str_ac_free(str_ac *self);
+
+#ifdef STR_HAVE_POSIX
+str	*str_init_shared(size_t size) STR_WARN_UNUSED_RESULT;
+str	*str_map_shared(int fd, size_t len) STR_WARN_UNUSED_RESULT;
+int	str_shared_fd(const str *self);
+int	str_shared_seal(str *self);
+int	str_shared_send(const str *self, int sock);
+str	*str_shared_recv(int sock) STR_WARN_UNUSED_RESULT;
+
+str	*str_load_fd(int fd) STR_WARN_UNUSED_RESULT STR_TRACED;
+str	*str_load_file(const char *path) STR_WARN_UNUSED_RESULT;
+
+str_ring *str_ring_init(size_t size) STR_WARN_UNUSED_RESULT;
+void	str_ring_free(str_ring *self);
+const char *str_ring_data(const str_ring *self);
+size_t	str_ring_get_size(const str_ring *self);
+char	*str_ring_tail(const str_ring *self, size_t *space);
+int	str_ring_commit(str_ring *self, size_t n);
+int	str_ring_add_n(str_ring *self, const char *_data, size_t n);
+ssize_t	str_ring_read(str_ring *self, int fd);
+int	str_ring_consume(str_ring *self, size_t n);
+
+str_follow *str_follow_open(const char *path, int from_end) STR_WARN_UNUSED_RESULT;
+int	str_follow_next(str_follow *self, const char **line, size_t *len) STR_TRACED;
+int	str_follow_wait(str_follow *self, int timeout_ms);
+void	str_follow_close(str_follow *self);
+
+str_frame_writer *str_frame_writer_init(int fd) STR_WARN_UNUSED_RESULT;
+int	str_frame_write(str_frame_writer *self, const char *_data, size_t n, int flags) STR_TRACED;
+int	str_frame_flush(str_frame_writer *self);
+void	str_frame_writer_free(str_frame_writer *self);
+str_frame_reader *str_frame_reader_init(int fd) STR_WARN_UNUSED_RESULT;
+int	str_frame_read(str_frame_reader *self, const char **_data, size_t *n) STR_TRACED;
+void	str_frame_reader_free(str_frame_reader *self);
+#endif	/* STR_HAVE_POSIX */
+
+#ifdef STR_METRICS
+int	str_metrics_snapshot(struct str_metric_stats *out, size_t n);
+void	str_metrics_reset(void);
+#endif
+#ifdef STR_ALLOC_PROFILE
+void	str_alloc_profile_rate(unsigned int n);
+void	str_alloc_profile_reset(void);
+int	str_alloc_report(struct str_alloc_site_stats *out, size_t n, int by_count);
+int	str_alloc_waste_report(struct str_alloc_waste *out, size_t n, size_t min_waste);
+void	str_alloc_profile_print(FILE *out);
+#endif
+/* <- FUNCTIONS */
+
+
+#ifdef STR_METRICS
+
+#define STR_METRIC_SUB_BITS	3
+#define STR_METRIC_RANGE_BITS	48
+#define STR_METRIC_BUCKETS	((STR_METRIC_RANGE_BITS - STR_METRIC_SUB_BITS + 1) << STR_METRIC_SUB_BITS)
+
+struct str_metric_block {
+	struct str_metric_block *next;
+	uint64_t lat[STR_M_COUNT][STR_METRIC_BUCKETS];
+	uint64_t size[STR_M_COUNT][STR_METRIC_BUCKETS];
+};
+
+static const char *const str_metric_names[STR_M_COUNT] = {
+	"str_add", "str_add_n", "str_input", "str_prepend", "str_prepend_n",
+	"str_consume_front", "str_pop_front", "str_pop_back", "str_substr",
+	"str_detach", "str_rem_word", "str_swap_word", "str_swap_all",
+	"str_to_upper", "str_to_lower", "str_to_title_case",
+	"str_to_sentence_case", "str_wrap", "str_display_width",
+	"str_from_utf16", "str_from_utf32", "str_from_latin1", "str_to_utf16",
+	"str_to_utf32", "str_to_latin1", "str_normalize_nfc",
+	"str_normalize_nfd", "str_diff", "str_patch", "str_expand",
+	"str_tmpl_render", "str_parse_logfmt", "str_parse_headers",
+	"str_rem_words", "str_load_fd", "str_follow_next", "str_frame_write",
+	"str_frame_read",
+};
+
+static struct str_metric_block *str_metric_blocks;
+static uint64_t str_metric_t0_tick;
+static uint64_t str_metric_t0_ns;
+static __thread struct str_metric_block *str_metric_tls;
+
+static uint64_t str_metric_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint64_t str_metric_tick(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return str_metric_ns();
+#endif
+}
+
+/*
+ * Maps @v to a bucket: exact below 2^STR_METRIC_SUB_BITS, then
+ * 2^STR_METRIC_SUB_BITS buckets per power of two.
+ */
+static inline unsigned int str_metric_bucket(uint64_t v)
+{
+	if (v >> STR_METRIC_RANGE_BITS)
+		v = ((uint64_t)1 << STR_METRIC_RANGE_BITS) - 1;
+	if (v < (1u << STR_METRIC_SUB_BITS))
+		return (unsigned int)v;
+
+	unsigned int shift = 63 - (unsigned int)__builtin_clzll(v) - STR_METRIC_SUB_BITS;
+	return ((shift + 1) << STR_METRIC_SUB_BITS) +
+	       (unsigned int)((v >> shift) - (1u << STR_METRIC_SUB_BITS));
+}
+
+/* Midpoint of the values that map to bucket @b. */
+static uint64_t str_metric_bucket_value(unsigned int b)
+{
+	if (b < (1u << STR_METRIC_SUB_BITS))
+		return b;
+
+	unsigned int shift = (b >> STR_METRIC_SUB_BITS) - 1;
+	uint64_t mant = (b & ((1u << STR_METRIC_SUB_BITS) - 1)) + (1u << STR_METRIC_SUB_BITS);
+	return (mant << shift) + (((uint64_t)1 << shift) >> 1);
+}
+
+static struct str_metric_block *str_metric_register(void)
+{
+	struct str_metric_block *blk = (struct str_metric_block *)calloc(1, sizeof(*blk));
+	if (!blk)
+		return NULL;
+
+	uint64_t zero = 0, tick = str_metric_tick();
+	if (__atomic_compare_exchange_n(&str_metric_t0_tick, &zero, tick, 0,
+					__ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		__atomic_store_n(&str_metric_t0_ns, str_metric_ns(), __ATOMIC_RELEASE);
+
+	/* Blocks are never freed, so counts of exited threads are kept. */
+	blk->next = __atomic_load_n(&str_metric_blocks, __ATOMIC_ACQUIRE);
+	while (!__atomic_compare_exchange_n(&str_metric_blocks, &blk->next, blk, 1,
+					    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+		;
+	return blk;
+}
+
+/* Only the owning thread writes a block; relaxed stores keep snapshots race-free. */
+static inline void str_metric_inc(uint64_t *c)
+{
+	__atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + 1, __ATOMIC_RELAXED);
+}
+
+static inline void str_metric_record(int fn, uint64_t start, uint64_t size)
+{
+	uint64_t dt = str_metric_tick() - start;
+
+	if (!str_metric_tls) {
+		str_metric_tls = str_metric_register();
+		if (!str_metric_tls)
+			return;
+	}
+	str_metric_inc(&str_metric_tls->lat[fn][str_metric_bucket(dt)]);
+	str_metric_inc(&str_metric_tls->size[fn][str_metric_bucket(size)]);
+}
+
+static uint64_t str_metric_quantile(const uint64_t *h, uint64_t total, double q)
+{
+	uint64_t rank = (uint64_t)(q * (double)total), seen = 0;
+
+	for (unsigned int b = 0; b < STR_METRIC_BUCKETS; b++) {
+		seen += h[b];
+		if (h[b] && seen > rank)
+			return str_metric_bucket_value(b);
+	}
+	return 0;
+}
+
+static uint64_t str_metric_top(const uint64_t *h)
+{
+	for (unsigned int b = STR_METRIC_BUCKETS; b-- > 0; )
+		if (h[b])
+			return str_metric_bucket_value(b);
+	return 0;
+}
+
+/*
+ * str_metrics_snapshot() - Merges the histograms of all threads.
+ * @out: Array receiving one entry per enum str_metric_fn value.
+ * @n: Number of entries available in @out.
+ *
+ * Latencies are converted to nanoseconds with a tick rate measured since
+ * the first recorded call. Functions that were never called report zero.
+ *
+ * Returns:
+ *     The number of entries written
+ */
+int str_metrics_snapshot(struct str_metric_stats *out, size_t n)
+{
+	uint64_t lat[STR_METRIC_BUCKETS], size[STR_METRIC_BUCKETS];
+	double ns_per_tick = 1.0;
+
+#if defined(__x86_64__) || defined(__i386__)
+	uint64_t t0 = __atomic_load_n(&str_metric_t0_tick, __ATOMIC_ACQUIRE);
+	uint64_t t0_ns = __atomic_load_n(&str_metric_t0_ns, __ATOMIC_ACQUIRE);
+	uint64_t now_ns = str_metric_ns(), now = str_metric_tick();
+	if (t0 && t0_ns && now > t0 && now_ns > t0_ns)
+		ns_per_tick = (double)(now_ns - t0_ns) / (double)(now - t0);
+#endif
+
+	if (n > STR_M_COUNT)
+		n = STR_M_COUNT;
+
+	for (size_t fn = 0; fn < n; fn++) {
+		uint64_t calls = 0;
+
+		memset(lat, 0, sizeof(lat));
+		memset(size, 0, sizeof(size));
+		for (struct str_metric_block *b = __atomic_load_n(&str_metric_blocks, __ATOMIC_ACQUIRE);
+		     b; b = b->next) {
+			for (unsigned int i = 0; i < STR_METRIC_BUCKETS; i++) {
+				uint64_t c = __atomic_load_n(&b->lat[fn][i], __ATOMIC_RELAXED);
+				lat[i] += c;
+				calls += c;
+				size[i] += __atomic_load_n(&b->size[fn][i], __ATOMIC_RELAXED);
+			}
+		}
+
+		struct str_metric_stats *st = &out[fn];
+		memset(st, 0, sizeof(*st));
+		st->name = str_metric_names[fn];
+		st->calls = calls;
+		if (!calls)
+			continue;
+
+		st->lat_p50_ns = (double)str_metric_quantile(lat, calls, 0.50) * ns_per_tick;
+		st->lat_p90_ns = (double)str_metric_quantile(lat, calls, 0.90) * ns_per_tick;
+		st->lat_p99_ns = (double)str_metric_quantile(lat, calls, 0.99) * ns_per_tick;
+		st->lat_p999_ns = (double)str_metric_quantile(lat, calls, 0.999) * ns_per_tick;
+		st->lat_max_ns = (double)str_metric_top(lat) * ns_per_tick;
+		st->size_p50 = str_metric_quantile(size, calls, 0.50);
+		st->size_p99 = str_metric_quantile(size, calls, 0.99);
+		st->size_max = str_metric_top(size);
+	}
+	return (int)n;
+}
+
+/*
+ * str_metrics_reset() - Clears the histograms of all threads.
+ *
+ * Calls that are being recorded concurrently may survive the reset.
+ */
+void str_metrics_reset(void)
+{
+	for (struct str_metric_block *b = __atomic_load_n(&str_metric_blocks, __ATOMIC_ACQUIRE);
+	     b; b = b->next) {
+		for (int fn = 0; fn < STR_M_COUNT; fn++) {
+			for (unsigned int i = 0; i < STR_METRIC_BUCKETS; i++) {
+				__atomic_store_n(&b->lat[fn][i], 0, __ATOMIC_RELAXED);
+				__atomic_store_n(&b->size[fn][i], 0, __ATOMIC_RELAXED);
+			}
+		}
+	}
+}
+
+#endif	/* STR_METRICS */
+
+
+#ifdef STR_ALLOC_PROFILE
+
+#ifndef STR_ALLOC_SAMPLE
+  #define STR_ALLOC_SAMPLE	64
+#endif
+#define STR_ALLOC_SITES		1024
+
+struct str_alloc_live {
+	const str *s;		/* NULL marks a free slot */
+	void	*site;
+};
+
+static struct str_alloc_site_stats str_alloc_sites[STR_ALLOC_SITES];
+static struct str_alloc_live *str_alloc_live_tab;
+static size_t str_alloc_live_cap;
+static size_t str_alloc_live_cnt;
+static uint64_t str_alloc_dropped;
+static unsigned int str_alloc_rate = STR_ALLOC_SAMPLE;
+static char str_alloc_lock_flag;
+static __thread unsigned int str_alloc_countdown;
+static __thread void *str_alloc_site;
+
+static void str_alloc_lock(void)
+{
+	while (__atomic_test_and_set(&str_alloc_lock_flag, __ATOMIC_ACQUIRE))
+		;
+}
+
+static void str_alloc_unlock(void)
+{
+	__atomic_clear(&str_alloc_lock_flag, __ATOMIC_RELEASE);
+}
+
+static size_t str_alloc_hash(const void *p, size_t mask)
+{
+	return (size_t)(((uint64_t)(uintptr_t)p * 0x9E3779B97F4A7C15ull) >> 29) & mask;
+}
+
+/* Inserts or updates @s in the live table. Called with the lock held. */
+static int str_alloc_live_put(const str *s, void *site)
+{
+	if ((str_alloc_live_cnt + 1) * 2 > str_alloc_live_cap) {
+		size_t cap = str_alloc_live_cap ? str_alloc_live_cap * 2 : 256;
+		struct str_alloc_live *tab = (struct str_alloc_live *)calloc(cap, sizeof(*tab));
+		if (!tab)
+			return -ENOMEM;
+
+		for (size_t i = 0; i < str_alloc_live_cap; i++) {
+			if (!str_alloc_live_tab[i].s)
+				continue;
+			size_t j = str_alloc_hash(str_alloc_live_tab[i].s, cap - 1);
+			while (tab[j].s)
+				j = (j + 1) & (cap - 1);
+			tab[j] = str_alloc_live_tab[i];
+		}
+		free(str_alloc_live_tab);
+		str_alloc_live_tab = tab;
+		str_alloc_live_cap = cap;
+	}
+
+	size_t mask = str_alloc_live_cap - 1;
+	size_t i = str_alloc_hash(s, mask);
+	while (str_alloc_live_tab[i].s && str_alloc_live_tab[i].s != s)
+		i = (i + 1) & mask;
+
+	if (!str_alloc_live_tab[i].s)
+		str_alloc_live_cnt++;
+	str_alloc_live_tab[i].s = s;
+	str_alloc_live_tab[i].site = site;
+	return 0;
+}
+
+/* Removes @s from the live table, shifting its probe chain back. */
+static void str_alloc_live_del(const str *s)
+{
+	if (!str_alloc_live_cap)
+		return;
+
+	size_t mask = str_alloc_live_cap - 1;
+	size_t i = str_alloc_hash(s, mask);
+	while (str_alloc_live_tab[i].s != s) {
+		if (!str_alloc_live_tab[i].s)
+			return;
+		i = (i + 1) & mask;
+	}
+
+	for (size_t j = (i + 1) & mask; str_alloc_live_tab[j].s; j = (j + 1) & mask) {
+		size_t k = str_alloc_hash(str_alloc_live_tab[j].s, mask);
+		if (((j - k) & mask) >= ((j - i) & mask)) {
+			str_alloc_live_tab[i] = str_alloc_live_tab[j];
+			i = j;
+		}
+	}
+	str_alloc_live_tab[i].s = NULL;
+	str_alloc_live_cnt--;
+}
+
+/*
+ * str_alloc_note() - Counts a buffer (re)allocation of @bytes for @self.
+ *
+ * Only every str_alloc_rate-th call per thread takes the lock; the sample
+ * is scaled up by the rate so that the report shows estimated totals.
+ */
+static void str_alloc_note(str *self, size_t bytes)
+{
+	unsigned int rate = __atomic_load_n(&str_alloc_rate, __ATOMIC_RELAXED);
+
+	/* A countdown left over from a sparser rate is cut short. */
+	if (str_alloc_countdown && str_alloc_countdown < rate) {
+		str_alloc_countdown--;
+		return;
+	}
+	str_alloc_countdown = rate - 1;
+
+	str_alloc_lock();
+
+	size_t i = str_alloc_hash(str_alloc_site, STR_ALLOC_SITES - 1), n = 0;
+	while (str_alloc_sites[i].count && str_alloc_sites[i].site != str_alloc_site &&
+	       ++n < STR_ALLOC_SITES)
+		i = (i + 1) & (STR_ALLOC_SITES - 1);
+
+	if (n < STR_ALLOC_SITES) {
+		str_alloc_sites[i].site = str_alloc_site;
+		str_alloc_sites[i].count += rate;
+		str_alloc_sites[i].bytes += (uint64_t)bytes * rate;
+	} else {
+		str_alloc_dropped += rate;
+	}
+
+	if (str_alloc_live_put(self, str_alloc_site) == 0)
+		self->flags |= STR_F_SAMPLED;
+
+	str_alloc_unlock();
+}
+
+/* Drops @self from the waste report when its buffer is released. */
+static void str_alloc_forget(str *self)
+{
+	str_alloc_lock();
+	str_alloc_live_del(self);
+	str_alloc_unlock();
+	self->flags &= (uint8_t)~STR_F_SAMPLED;
+}
+
+#define STR_ALLOC_NOTE(self, bytes)	str_alloc_note((self), (bytes))
+#define STR_ALLOC_FORGET(self) \
+	do { if ((self)->flags & STR_F_SAMPLED) str_alloc_forget(self); } while (0)
+
+/*
+ * str_alloc_profile_rate() - Samples one allocation in @n (1 records all).
+ */
+void str_alloc_profile_rate(unsigned int n)
+{
+	__atomic_store_n(&str_alloc_rate, n ? n : 1, __ATOMIC_RELAXED);
+}
+
+/*
+ * str_alloc_profile_reset() - Clears the call site statistics.
+ *
+ * Sampled strings that are still alive stay in the waste report.
+ */
+void str_alloc_profile_reset(void)
+{
+	str_alloc_lock();
+	memset(str_alloc_sites, 0, sizeof(str_alloc_sites));
+	str_alloc_dropped = 0;
+	str_alloc_unlock();
+}
+
+static int str_alloc_by_bytes(const void *a, const void *b)
+{
+	const struct str_alloc_site_stats *x = (const struct str_alloc_site_stats *)a;
+	const struct str_alloc_site_stats *y = (const struct str_alloc_site_stats *)b;
+	return (x->bytes < y->bytes) - (x->bytes > y->bytes);
+}
+
+static int str_alloc_by_count(const void *a, const void *b)
+{
+	const struct str_alloc_site_stats *x = (const struct str_alloc_site_stats *)a;
+	const struct str_alloc_site_stats *y = (const struct str_alloc_site_stats *)b;
+	return (x->count < y->count) - (x->count > y->count);
+}
+
+/*
+ * str_alloc_report() - Ranks allocation call sites.
+ * @out: Array receiving up to @n call sites.
+ * @n: Number of entries available in @out.
+ * @by_count: Non-zero to rank by number of allocations instead of bytes.
+ *
+ * Returns:
+ *     The number of entries written
+ */
+int str_alloc_report(struct str_alloc_site_stats *out, size_t n, int by_count)
+{
+	struct str_alloc_site_stats all[STR_ALLOC_SITES];
+	size_t cnt = 0;
+
+	str_alloc_lock();
+	for (size_t i = 0; i < STR_ALLOC_SITES; i++)
+		if (str_alloc_sites[i].count)
+			all[cnt++] = str_alloc_sites[i];
+	str_alloc_unlock();
+
+	qsort(all, cnt, sizeof(all[0]), by_count ? str_alloc_by_count : str_alloc_by_bytes);
+	if (n > cnt)
+		n = cnt;
+	memcpy(out, all, n * sizeof(all[0]));
+	return (int)n;
+}
+
+static int str_alloc_by_waste(const void *a, const void *b)
+{
+	const struct str_alloc_waste *x = (const struct str_alloc_waste *)a;
+	const struct str_alloc_waste *y = (const struct str_alloc_waste *)b;
+	size_t wx = x->alloc - x->len, wy = y->alloc - y->len;
+	return (wx < wy) - (wx > wy);
+}
+
+/*
+ * str_alloc_waste_report() - Lists sampled live strings that waste memory.
+ * @out: Array receiving up to @n strings, most wasteful first.
+ * @n: Number of entries available in @out.
+ * @min_waste: Only strings with at least this many unused bytes qualify.
+ *
+ * A string qualifies when its buffer is more than twice its length. The
+ * lengths are read without synchronisation, so strings being modified by
+ * other threads may be reported with stale values.
+ *
+ * Returns:
+ *     The number of entries written
+ */
+int str_alloc_waste_report(struct str_alloc_waste *out, size_t n, size_t min_waste)
+{
+	size_t cnt = 0;
+
+	str_alloc_lock();
+	for (size_t i = 0; i < str_alloc_live_cap; i++) {
+		const str *s = str_alloc_live_tab[i].s;
+		if (!s)
+			continue;
+
+		size_t alloc = s->head + s->cap + 1;
+		if (alloc / 2 <= s->len || alloc - s->len < min_waste)
+			continue;
+
+		struct str_alloc_waste w = { s, str_alloc_live_tab[i].site, s->len, alloc };
+		if (cnt < n) {
+			out[cnt++] = w;
+			continue;
+		}
+
+		/* Keep the @n most wasteful: replace the smallest kept entry. */
+		size_t min = 0;
+		for (size_t j = 1; j < n; j++)
+			if (out[j].alloc - out[j].len < out[min].alloc - out[min].len)
+				min = j;
+		if (n && alloc - s->len > out[min].alloc - out[min].len)
+			out[min] = w;
+	}
+	str_alloc_unlock();
+
+	qsort(out, cnt, sizeof(out[0]), str_alloc_by_waste);
+	return (int)cnt;
+}
+
+/*
+ * str_alloc_profile_print() - Writes the top call sites and wasteful strings.
+ *
+ * Call sites are printed as raw return addresses; resolve them with
+ * `addr2line -f -e <binary>` (subtract the load address for PIE binaries).
+ */
+void str_alloc_profile_print(FILE *out)
+{
+	struct str_alloc_site_stats sites[20];
+	struct str_alloc_waste waste[20];
+	int n;
+
+	fprintf(out, "str allocations by bytes (1 in %u sampled, %llu dropped):\n",
+		__atomic_load_n(&str_alloc_rate, __ATOMIC_RELAXED),
+		(unsigned long long)str_alloc_dropped);
+	n = str_alloc_report(sites, 20, 0);
+	for (int i = 0; i < n; i++)
+		fprintf(out, "  %18p %14llu bytes %10llu allocs\n", sites[i].site,
+			(unsigned long long)sites[i].bytes, (unsigned long long)sites[i].count);
+
+	fprintf(out, "str allocations by count:\n");
+	n = str_alloc_report(sites, 20, 1);
+	for (int i = 0; i < n; i++)
+		fprintf(out, "  %18p %10llu allocs %14llu bytes\n", sites[i].site,
+			(unsigned long long)sites[i].count, (unsigned long long)sites[i].bytes);
+
+	fprintf(out, "live strings with unused capacity:\n");
+	n = str_alloc_waste_report(waste, 20, 0);
+	for (int i = 0; i < n; i++)
+		fprintf(out, "  %18p %12zu used %12zu allocated  (str %p)\n", waste[i].site,
+			waste[i].len, waste[i].alloc, (const void *)waste[i].s);
+}
+
+#else	/* !STR_ALLOC_PROFILE */
+
+#define STR_ALLOC_NOTE(self, bytes)	do { } while (0)
+#define STR_ALLOC_FORGET(self)		do { } while (0)
+
+#endif	/* STR_ALLOC_PROFILE */
+
+
+/*
+ * STR_TRACE() opens the instrumentation scope of a public function for
+ * STR_METRICS and STR_ALLOC_PROFILE. Only the outermost library call is
+ * traced; the scope closes on every return path via the cleanup attribute.
+ */
+#if defined(STR_METRICS) || defined(STR_ALLOC_PROFILE)
+
+struct str_trace {
+	int	 outer;
+	int	 fn;
+	uint64_t size;
+	uint64_t start;
+};
+
+static __thread int str_trace_depth;
+
+static inline struct str_trace str_trace_begin(int fn, uint64_t size, void *site)
+{
+	struct str_trace t = { str_trace_depth++ == 0, fn, size, 0 };
+
+	(void)site;
+	if (t.outer) {
+#ifdef STR_ALLOC_PROFILE
+		str_alloc_site = site;
+#endif
+#ifdef STR_METRICS
+		t.start = str_metric_tick();
+#endif
+	}
+	return t;
+}
+
+static inline void str_trace_end(struct str_trace *t)
+{
+	str_trace_depth--;
+	if (!t->outer)
+		return;
+
+#ifdef STR_METRICS
+	str_metric_record(t->fn, t->start, t->size);
+#endif
+#ifdef STR_ALLOC_PROFILE
+	str_alloc_site = NULL;
+#endif
+}
+
+#define STR_TRACE(fn, size) \
+	struct str_trace _str_trace __attribute__((cleanup(str_trace_end))) = \
+		str_trace_begin((fn), (uint64_t)(size), __builtin_return_address(0))
+
+#else
+
+#define STR_TRACE(fn, size)	do { } while (0)
+
+#endif
+
+
+
+/*
+ * str_init() - Initializes a new Str structure.
+ *
+ * This function initializes a new Str structure and allocates memory for it.
+ * The caller is responsible for freeing the returned structure using str_free().
+ * 
+ * Returns:
+ *     A pointer to the newly initialized Str structure, or NULL if memory allocation fails.
+ */
+
+str *str_init()
+{
+	str *tmp = (str *)calloc(1, sizeof(str));
+	if (!tmp)
+		return NULL;
+
+	tmp->is_dynamic = 1;
+	return tmp;
+}
+
+
+/*
+ * str_copy_out() - Moves @self onto a private, exactly sized buffer.
+ *
+ * Drops @self's reference to a shared buffer, freeing the buffer if it
+ * was the last one.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -ENOMEM if memory allocation fails
+ */
+static int str_copy_out(str *self)
+{
+	struct str_share *sh = self->share;
+
+	char *buf = (char *)malloc(self->len + 1);
+	if (!buf)
+		return -ENOMEM;
+
+	memcpy(buf, self->data, self->len);
+	buf[self->len] = '\0';
+
+	if (--sh->refs == 0) {
+		free(sh->base);
+		free(sh);
+	}
+
+	self->data = buf;
+	self->cap = self->len;
+	self->head = 0;
+	self->share = NULL;
+
+	STR_ALLOC_NOTE(self, self->len + 1);
+	return 0;
+}
+
+
+/*
+ * str_unshare() - Makes the buffer of @self writable before a modification.
+ *
+ * The last string referencing a shared buffer takes it over without copying;
+ * otherwise @self gets a private copy of its bytes.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EPERM if @self is a read-only mapping
+ *    -ENOMEM if memory allocation fails
+ */
+static int str_unshare(str *self)
+{
+	struct str_share *sh = self->share;
+
+	if (self->flags & STR_F_RDONLY)
+		return -EPERM;
+
+	self->dwidth = 0;
+	if (!sh)
+		return 0;
+
+	if (sh->refs > 1)
+		return str_copy_out(self);
+
+	self->head = (size_t)(self->data - sh->base);
+	self->cap = sh->size - self->head - 1;
+	self->data[self->len] = '\0';
+	self->share = NULL;
+	free(sh);
+	return 0;
+}
+
+
+/*
+ * str_grow() - Makes room for @head bytes in front and @len bytes in total.
+ * @self: Pointer to the Str structure.
+ * @head: Minimum free space required in front of @self->data.
+ * @len: Minimum capacity required from @self->data.
+ *
+ * Capacity grows geometrically so that repeated appends are amortized O(1).
+ * Headroom grows in proportion to the string for the same reason on the
+ * prepend side. When an append needs room and at least STR_COMPACT_MIN bytes
+ * (and no less than the live contents) have been consumed from the front,
+ * the contents are slid back to the start of the buffer instead.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if the requested size exceeds MAX_STRING_SIZE
+ *    -ENOSPC if @self is a mapping without enough room
+ *    -EPERM if @self is read-only
+ *    -ENOMEM if memory allocation fails
+ */
+static int str_grow(str *self, size_t head, size_t len)
+{
+	int ret = str_unshare(self);
+	if (ret)
+		return ret;
+
+	if (self->data && self->head >= head && self->cap >= len)
+		return 0;
+
+	if (head >= MAX_STRING_SIZE / 2 || len >= MAX_STRING_SIZE / 2)
+		return -EINVAL;
+
+	char *base = self->data ? self->data - self->head : NULL;
+
+	if (head == 0 && self->head >= STR_COMPACT_MIN && self->head >= self->len &&
+	    self->head + self->cap >= len) {
+		memmove(base, self->data, self->len + 1);
+		self->cap += self->head;
+		self->head = 0;
+		self->data = base;
+		return 0;
+	}
+
+	if (self->flags & STR_F_MAPPED)
+		return -ENOSPC;
+
+	// Grow only the side that is short: prepends must not inflate the tail
+	size_t new_cap = self->cap;
+	if (!self->data || new_cap < len) {
+		new_cap = self->cap + self->cap / 2;
+		if (new_cap < len)
+			new_cap = len;
+		if (new_cap < STR_MIN_CAP)
+			new_cap = STR_MIN_CAP;
+	}
+
+	size_t new_head = self->head;
+	if (new_head < head)
+		new_head = head + (head + self->len) / 2;
+
+	if (new_head == self->head) {
+		base = (char *)realloc(base, new_head + new_cap + 1);
+		if (!base)
+			return -ENOMEM;
+	} else {
+		char *tmp = (char *)malloc(new_head + new_cap + 1);
+		if (!tmp)
+			return -ENOMEM;
+
+		if (self->data)
+			memcpy(tmp + new_head, self->data, self->len);
+		free(base);
+		base = tmp;
+	}
+
+	self->data = base + new_head;
+	self->data[self->len] = '\0';
+	self->head = new_head;
+	self->cap = new_cap;
+
+	STR_ALLOC_NOTE(self, new_head + new_cap + 1);
+	return 0;
+}
+
+/*
+ * Tells whether @p points into the buffer of @self, which str_grow() may
+ * move and an in-place rewrite may overwrite.
+ */
+static inline int str_is_inner(const str *self, const char *p)
+{
+	uintptr_t a = (uintptr_t)p, d = (uintptr_t)self->data;
+
+	return self->data && p && a >= d - self->head && a <= d + self->cap;
+}
+
+
+/*
+ * str_add() - Adds a string to the data member of a Str structure.
+ * @self: Pointer to the Str structure.
+ * @_data: Pointer to the string to be added.
+ *
+ * This function appends the string @_data to the data member of the Str structure @self.
+ * 
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @_data is NULL or the result would be too long
+ *    -ENOMEM if memory allocation fails
+ */
+int str_add(str *self, const char *_data)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_ADD, self->len);
+
+	if (_data == NULL) {
+		return -EINVAL;
+	}
+
+	return str_add_n(self, _data, strlen(_data));
+}
+
+
+/*
+ * str_add_n() - Appends @n bytes from @_data to @self.
+ *
+ * Like str_add(), but @_data does not have to be NUL-terminated.
+ */
+int str_add_n(str *self, const char *_data, size_t n)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_ADD_N, self->len);
+
+	if (_data == NULL && n)
+		return -EINVAL;
+
+	if (n > MAX_STRING_SIZE - self->len)
+		return -EINVAL;
+
+	// @_data may be part of @self, e.g. when appending a string to itself
+	int inner = str_is_inner(self, _data);
+	ptrdiff_t off = inner ? _data - self->data : 0;
+
+	int ret = str_grow(self, 0, self->len + n);
+	if (ret)
+		return ret;
+	if (inner)
+		_data = self->data + off;
+
+	if (n)
+		memcpy(self->data + self->len, _data, n);
+	self->len += n;
+	self->data[self->len] = '\0';
+
+	return 0;
+}
+
+
+/*
+ * str_prepend() - Inserts a string at the front of @self.
+ * @self: Pointer to the Str structure.
+ * @_data: Pointer to the string to be inserted.
+ *
+ * Free space left in front of the data (by str_consume_front() or by an
+ * earlier prepend) is used first, so repeated prepends are amortized O(1).
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @_data is NULL or the result would be too long
+ *    -ENOMEM if memory allocation fails
+ */
+int str_prepend(str *self, const char *_data)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_PREPEND, self->len);
+
+	if (_data == NULL)
+		return -EINVAL;
+
+	return str_prepend_n(self, _data, strlen(_data));
+}
+
+
+/*
+ * str_prepend_n() - Inserts @n bytes from @_data at the front of @self.
+ *
+ * Like str_prepend(), but @_data does not have to be NUL-terminated.
+ */
+int str_prepend_n(str *self, const char *_data, size_t n)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_PREPEND_N, self->len);
+
+	if (_data == NULL && n)
+		return -EINVAL;
+
+	if (n > MAX_STRING_SIZE - self->len)
+		return -EINVAL;
+
+	int inner = str_is_inner(self, _data);
+	ptrdiff_t off = inner ? _data - self->data : 0;
+
+	int ret = str_grow(self, n, self->len);
+	if (ret)
+		return ret;
+	if (inner)
+		_data = self->data + off;
+
+	self->data -= n;
+	self->head -= n;
+	self->cap += n;
+	self->len += n;
+	if (n)
+		memcpy(self->data, _data, n);
+
+	return 0;
+}
+
+
+/*
+ * str_consume_front() - Drops the first @n bytes of @self in O(1).
+ * @self: Pointer to the Str structure.
+ * @n: Number of bytes to drop.
+ *
+ * Nothing is moved: the dropped bytes become headroom for str_prepend(),
+ * and are only reclaimed by a later append once enough of them pile up
+ * (see STR_COMPACT_MIN).
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self holds fewer than @n bytes
+ */
+int str_consume_front(str *self, size_t n)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_CONSUME_FRONT, self->len);
+
+	if (n > self->len)
+		return -EINVAL;
+
+	if (n == 0)
+		return 0;
+
+	self->data += n;
+	self->head += n;
+	self->cap -= n;
+	self->len -= n;
+	self->dwidth = 0;
+
+	return 0;
+}
+
+
+/*
+ * str_pop_front() - Removes everything up to the first separator.
+ * @self: Pointer to the Str structure.
+ * @sep: Separator character to be removed.
+ *
+ * This function removes the first occurrence of @sep and everything before
+ * it from @self->data, mirroring str_pop_back(). It runs in time proportional
+ * to the removed part only.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self->data is empty or does not contain @sep
+ */
+int str_pop_front(str *self, char sep)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_POP_FRONT, self->len);
+
+	if (self->len == 0)
+		return -EINVAL;
+
+	char *p = (char *)memchr(self->data, sep, self->len);
+	if (!p)
+		return -EINVAL;
+
+	return str_consume_front(self, (size_t)(p - self->data) + 1);
+}
+
+
+/*
+ * str_substr() - Returns @len bytes of @self starting at @off, without copying.
+ * @self: Pointer to the Str structure.
+ * @off: Offset of the first byte.
+ * @len: Number of bytes.
+ *
+ * The new string shares the buffer of @self through a reference count, and
+ * both become read-only: whichever side is modified first gets its own copy.
+ * A substring keeps the whole parent buffer alive, so long-lived results
+ * should be passed to str_detach(). The caller is responsible for freeing
+ * the returned structure using str_free().
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL if @off and @len fall
+ *     outside @self, @self is a shared memory mapping, or memory
+ *     allocation fails
+ */
+str *str_substr(str *self, size_t off, size_t len)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_SUBSTR, self->len);
+
+	if (off > self->len || len > self->len - off || (self->flags & STR_F_MAPPED))
+		return NULL;
+
+	str *tmp = str_init();
+	if (!tmp || !self->data)
+		return tmp;
+
+	if (!self->share) {
+		struct str_share *sh = (struct str_share *)malloc(sizeof(*sh));
+		if (!sh) {
+			free(tmp);
+			return NULL;
+		}
+		sh->refs = 1;
+		sh->base = self->data - self->head;
+		sh->size = self->head + self->cap + 1;
+		self->share = sh;
+	}
+
+	self->share->refs++;
+	tmp->share = self->share;
+	tmp->data = self->data + off;
+	tmp->len = len;
+	tmp->cap = len;
+	return tmp;
+}
+
+
+/*
+ * str_detach() - Gives @self a private copy of a shared buffer.
+ *
+ * Use it on substrings that outlive their parent, so that the parent
+ * buffer can be released. Does nothing if @self is not shared.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -ENOMEM if memory allocation fails
+ */
+int str_detach(str *self)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_DETACH, self->len);
+
+	if (!self->share)
+		return 0;
+
+	return str_copy_out(self);
+}
+
+
+/*
+ * str_input() - Adds a string from the terminal to the data member of a Str structure.
+ * @self: Pointer to the Str structure.
+ *
+ * This function adds a string received from the terminal to the data member of the Str structure @self.
+ * If @self->data is not empty, the received value is appended with a space.
+ * 
+ * Returns:
+ *     0 on successful completion
+ */
+
+int str_input(str *self)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_INPUT, self->len);
+
+	char *buf = get_dyn_input(MAX_STRING_SIZE - self->len);
+	if (!buf)
+		return -EINVAL;
+
+	int ret = str_add_n(self, buf, strlen(buf));
+
+	free(buf);
+	return ret;
+}
+
+
+/*
+ * str_pop_back() - Removes the last character from the string in a Str structure.
+ * @self: Pointer to the Str structure.
+ * @sep: Separator character to be removed.
+ *
+ * This function removes the last occurrence of the separator character @sep 
+ * from the string in the Str structure @self->data. If @self->data is empty or 
+ * does not contain @sep, the function fails with -1.
+ * 
+ * Returns:
+ *     0 on successful completion
+ *    -1 if @self->data is NULL or empty, or if @sep is not found
+ */
+int str_pop_back(str *self, char sep)
+{
+	if (self->data == NULL || self->len == 0)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_POP_BACK, self->len);
+
+	int ret = str_unshare(self);
+	if (ret)
+		return ret;
+
+	char *p = strrchr(self->data, sep);
+	if (!p)
+		return -EINVAL;
+
+	*p = '\0';
+	self->len = (size_t)(p - self->data);
+
+	return 0;
+}
+
+/*
+ * If @self->data is not empty, it prints the value in it to the terminal.
+ */
+void str_print(const str *self)
+{
+	if (self->data) {
+		fwrite(self->data, 1, self->len, stdout);
+		fflush(stdout);
+	}
+}
+
+
+/*
+ * If @self->data is not empty, it returns the number of characters in it.
+ * @self: The struct that contains our return value.
+ */
+size_t str_get_size(const str *self)
+{
+    	return self->len;
+}
+
+
+/*
+ * If the 'data' member of the @self parameter is not empty,
+ * it returns the 'data' member as 'const char *'.
+ * Substrings from str_substr() are only NUL-terminated after str_detach().
+ */
+const char *str_get_data(const str *self)
+{
+    	return (const char *)self->data;
+}
+
+/*
+ * It only releases @self->data. It does not delete @self;
+ */
+void str_clear(str *self)
+{
+	STR_ALLOC_FORGET(self);
+
+#ifdef STR_HAVE_POSIX
+	if (self->flags & STR_F_MAPPED) {
+		munmap(self->data - self->head, self->head + self->cap + 1);
+		close(self->fd);
+		self->flags = 0;
+	} else
+#endif
+	if (self->share) {
+		if (--self->share->refs == 0) {
+			free(self->share->base);
+			free(self->share);
+		}
+		self->share = NULL;
+	} else if (self->data) {
+		free(self->data - self->head);
+	}
+	self->data = NULL;
+	self->len = self->cap = self->head = self->dwidth = 0;
+}
+
+
+/*
+ * It releases @str.
+ */
+void str_free(str *self)
+{
+	if (self) { // Check NULL
+		str_clear(self);
+		if (self->is_dynamic) {
+			free(self);
+			self = NULL;
+		}
+	}
+}
+
+
+/*
+ * get_dyn_input() - Dynamically reads input from the terminal.
+ * @max_str_size: Maximum size of the input string to be read.
+ *
+ * This function dynamically reads input from the terminal, allocating memory as needed.
+ * It continues reading characters until EOF or newline ('\n') is encountered, dynamically 
+ * resizing the memory buffer as necessary. The caller is responsible for freeing the 
+ * returned buffer.
+ * 
+ * Returns:
+ *     A dynamically allocated buffer containing the input string read from the terminal,
+ *     or NULL if memory allocation fails or EOF is encountered before any characters are read.
+ */
+static char* get_dyn_input(size_t max_str_size)
+{
+	const int CHUNK_SIZE = 10;
+	char* buffer = (char *)calloc(CHUNK_SIZE,  sizeof(char));
+
+	if (buffer == NULL) 
+		return NULL;
+
+	size_t current_size = CHUNK_SIZE; // Size of available memory.
+	size_t length = 0; // Length of current string
+
+	int c;
+	while ((c = getchar()) != EOF && c != '\n') {
+		if (length + 1 >= current_size) { // Expand memory
+			current_size += CHUNK_SIZE;			
+			char* tmp = realloc(buffer, current_size);
+
+			if (tmp == NULL) {
+				free(buffer);
+				return NULL;
+			}
+			buffer = tmp;
+		}
+
+		if (current_size >= (max_str_size - 1)) {
+			free(buffer);
+			return NULL;
+		}
+
+		buffer[length++] = (char)c;
+		buffer[length] = '\0'; // End the series
+	}
+
+	// Finally release the extra memory
+	char *result = (char *)malloc((length + 1) * sizeof(char));
+	if (result == NULL) {
+		free(buffer);
+		return NULL;
+	}
+	
+	strncpy(result, buffer, strlen(buffer));
+	result[strlen(buffer)] = '\0';
+
+	free(buffer);
+	return result;
+}
+
+/*
+ * str_rem_word() - Removes a specific word from the string.
+ * @self: Pointer to the Str structure.
+ * @needle: The word to be removed from @self->data.
+ *
+ * This function removes the specific word @needle from @self->data. 
+ * If @needle cannot be found, the function fails with -1.
+ * 
+ * Returns:
+ *     0 on successful completion
+ *    -1 if @self, @self->data, or @needle is NULL, or if @needle cannot be found
+ *
+ * Note: This function is designed to manage dynamic memory governed by the 
+ * @self->is_dynamic property. The caller is responsible for freeing 
+ * the returned data to continue accessing the modified data.
+ */
+int str_rem_word(str *self, const char *needle)
+{
+        if (!self || !self->data || !needle)
+        	return -EINVAL;
+
+	STR_TRACE(STR_M_REM_WORD, self->len);
+
+	int ret = str_unshare(self);
+	if (ret)
+		return ret;
+            
+        size_t self_data_size = self->len;
+        size_t needle_size = strlen(needle);
+        
+        if (needle_size > self_data_size)
+        	return -EINVAL;
+            
+        char *L = NULL;
+        L = strstr(self->data, needle);
+        if(!L)
+        	return -EINVAL;
+
+        memmove(L, L + needle_size, self_data_size - (L - self->data) - needle_size + 1);
+	self->len = self_data_size - needle_size;
+	self->data[self->len] = '\0';
+
+	return 0;
+}
+
+
+/*
+ * str_swap_word() - Replaces a specific word with another word.
+ * @self: Pointer to the Str structure.
+ * @word1: The word to be replaced.
+ * @word2: The new word to replace @word1.
+ *
+ * This function replaces the specific word @word1 found in @self->data 
+ * with @word2. If @word1 cannot be found, the function fails with -1.
+ * 
+ * Returns:
+ *     0 on successful completion
+ *    -1 if an error occurred
+ *
+ * Note: This function is designed to manage dynamic memory governed by the 
+ * @self->is_dynamic property. The caller is responsible for freeing 
+ * the returned data to continue accessing the modified data.
+ */
+int str_swap_word(str *self, const char *word1, const char *word2)
+{
+	if (!self || !self->data || !word1 || !word2)
+		return -1;
+
+	STR_TRACE(STR_M_SWAP_WORD, self->len);
+
+	if (str_unshare(self))
+		return -1;
+
+	size_t word1_size = strlen(word1);
+	size_t word2_size = strlen(word2);
+
+	char *L = strstr(self->data, word1);
+	if (!L)
+		return -1;
+
+	// @word2 may be part of @self, which is moved below
+	char *copy = NULL;
+	if (str_is_inner(self, word2)) {
+		copy = (char *)malloc(word2_size + 1);
+		if (!copy)
+			return -1;
+		word2 = (const char *)memcpy(copy, word2, word2_size);
+	}
+
+	size_t off = (size_t)(L - self->data);
+	size_t new_size = self->len - word1_size + word2_size;
+	if (str_grow(self, 0, new_size)) {
+		free(copy);
+		return -1;
+	}
+
+	// Move everything after word1, then copy word2 into the gap
+	L = self->data + off;
+	memmove(L + word2_size, L + word1_size, self->len - off - word1_size + 1);
+	memcpy(L, word2, word2_size);
+	self->len = new_size;
+	free(copy);
+
+	return 0;
+}
+
+
+/* str_swap_all() on words of known length that do not point into @self. */
+static int str_swap_all_n(str *self, const char *word1, size_t word1_size, const char *word2,
+			  size_t word2_size)
+{
+	size_t count = 0, skip = 0;
+	char *r, *w, *m, *end;
+	int ret;
+
+	// Search by length, not to the first NUL: loaded files may contain NUL bytes
+	if (word2_size > word1_size) {
+		end = self->data + self->len;
+		for (m = self->data; (m = (char *)str_find_n(m, (size_t)(end - m), word1, word1_size)) != NULL;
+		     m += word1_size)
+			count++;
+		if (count == 0)
+			return 0;
+		if (count > (MAX_STRING_SIZE - self->len) / (word2_size - word1_size))
+			return -EINVAL;
+
+		// Park the contents at the end; the rewrite then never overtakes the reader
+		skip = count * (word2_size - word1_size);
+		ret = str_grow(self, 0, self->len + skip);
+		if (ret)
+			return ret;
+		memmove(self->data + skip, self->data, self->len + 1);
+	}
+
+	r = self->data + skip;
+	w = self->data;
+	end = r + self->len;
+	count = 0;
+	while ((m = (char *)str_find_n(r, (size_t)(end - r), word1, word1_size)) != NULL) {
+		memmove(w, r, (size_t)(m - r));
+		w += m - r;
+		memcpy(w, word2, word2_size);
+		w += word2_size;
+		r = m + word1_size;
+		count++;
+	}
+
+	size_t rest = (size_t)(end - r);
+	memmove(w, r, rest);
+	self->len = (size_t)(w - self->data) + rest;
+	self->data[self->len] = '\0';
+
+	return count > INT_MAX ? INT_MAX : (int)count;
+}
+
+
+/*
+ * str_swap_all() - Replaces every occurrence of a word with another word.
+ * @self: Pointer to the Str structure.
+ * @word1: The word to be replaced.
+ * @word2: The new word to replace @word1, may be empty.
+ *
+ * Occurrences are found left to right without overlap, and text inserted
+ * from @word2 is never searched again. The string is rewritten in a single
+ * pass: in place when @word2 is not longer than @word1, otherwise after one
+ * counting pass and at most one reallocation.
+ *
+ * Returns:
+ *     The number of replacements made
+ *    -EINVAL if an argument is NULL, @word1 is empty or the result is too long
+ *    -ENOMEM if memory allocation fails
+ *    -EPERM if @self is read-only
+ */
+int str_swap_all(str *self, const char *word1, const char *word2)
+{
+	if (!self || !self->data || !word1 || !*word1 || !word2)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_SWAP_ALL, self->len);
+
+	int ret = str_unshare(self);
+	if (ret)
+		return ret;
+
+	size_t word1_size = strlen(word1);
+	size_t word2_size = strlen(word2);
+
+	// The words may be part of @self, which is rewritten in place
+	if (str_is_inner(self, word1) || str_is_inner(self, word2)) {
+		char *copy = (char *)malloc(word1_size + word2_size + 1);
+		if (!copy)
+			return -ENOMEM;
+		memcpy(copy, word1, word1_size);
+		memcpy(copy + word1_size, word2, word2_size);
+		ret = str_swap_all_n(self, copy, word1_size, copy + word1_size, word2_size);
+		free(copy);
+		return ret;
+	}
+	return str_swap_all_n(self, word1, word1_size, word2, word2_size);
+}
+
+
+int str_to_upper(str *self)
+{
+	if (!self || !self->data)
+		return -1;
+
+	STR_TRACE(STR_M_TO_UPPER, self->len);
+
+	if (str_unshare(self))
+		return -1;
+
+	char *p = self->data, *end = p + self->len;
+
+	while (p < end) {
+		*p = toupper((unsigned char)*p);
+		p++;
+	}
+
+	return 0;
+}
+
+
+int str_to_lower(str *self)
+{
+	if (!self || !self->data)
+		return -1;
+
+	STR_TRACE(STR_M_TO_LOWER, self->len);
+
+	if (str_unshare(self))
+		return -1;
+
+	char *p = self->data, *end = p + self->len;
+
+	while (p < end) {
+		*p = tolower((unsigned char)*p);
+		p++;
+	}
+
+	return 0;
+}
+
+
+/*
+ * str_to_sentence_case() - Capitalizes the first letter of every sentence.
+ * @self: Pointer to the Str structure.
+ * @sep: Text that ends a sentence, or NULL for UAX #29 sentence boundaries.
+ *
+ * With a NULL @sep the first ASCII letter of each sentence found by
+ * str_seg_next() is capitalized, unless a digit or a non-ASCII character
+ * comes first.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -1 if an error occurred
+ */
+int str_to_sentence_case(str *self, const char *sep)
+{
+	if (!self || !self->data || (sep && !*sep))
+		return -1;
+
+	STR_TRACE(STR_M_TO_SENTENCE_CASE, self->len);
+
+	if (str_unshare(self))
+		return -1;
+
+	if (!sep) {
+		str_seg it;
+		const char *seg;
+		size_t n;
+
+		str_seg_init(&it, self->data, self->len, STR_SEG_SENTENCE);
+		while (str_seg_next(&it, &seg, &n)) {
+			char *q = self->data + (seg - self->data), *end = q + n;
+
+			while (q < end && (unsigned char)*q < 0x80 && !isalnum((unsigned char)*q))
+				q++;
+			if (q < end)
+				*q = toupper((unsigned char)*q);
+		}
+		return 0;
+	}
+
+	size_t sep_len = strlen(sep);
+	char *p = self->data, *end = p + self->len;
+
+	if (p < end)
+		*p = toupper((unsigned char)*p);
+
+	// Resume each search right after the previous separator
+	while ((p = (char *)str_find_n(p, (size_t)(end - p), sep, sep_len)) != NULL) {
+		p += sep_len;
+		if (p == end)
+			break;
+		*p = toupper((unsigned char)*p);
+	}
+	return 0;
+}
+
+
+/*
+ * str_to_title_case() - Capitalizes the first letter of every word.
+ * @self: Pointer to the Str structure.
+ *
+ * Words are separated by whitespace. The first character of each word is
+ * converted to upper case and the rest to lower case.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -1 if an error occurred
+ */
+int str_to_title_case(str *self)
+{
+	if (!self || !self->data)
+		return -1;
+
+	STR_TRACE(STR_M_TO_TITLE_CASE, self->len);
+
+	if (str_unshare(self))
+		return -1;
+
+	int start = 1;
+	for (char *p = self->data, *end = p + self->len; p < end; p++) {
+		unsigned char c = (unsigned char)*p;
+
+		if (isspace(c)) {
+			start = 1;
+			continue;
+		}
+		*p = start ? toupper(c) : tolower(c);
+		start = 0;
+	}
+	return 0;
+}
+
+
+struct str_wrap_word {
+	size_t	off;	/* byte offset in the source */
+	size_t	len;	/* bytes */
+	size_t	width;	/* display columns */
+	uint8_t	para;	/* first word of a paragraph */
+	uint8_t	line;	/* first word of a line */
+};
+
+/* Greedy breaks for words [@a, @b): each line takes every word that still fits. */
+static void str_wrap_greedy(struct str_wrap_word *w, size_t a, size_t b, size_t width)
+{
+	size_t line = w[a].width;
+
+	w[a].line = 1;
+	for (size_t i = a + 1; i < b; i++) {
+		if (line + 1 + w[i].width <= width) {
+			line += 1 + w[i].width;
+		} else {
+			w[i].line = 1;
+			line = w[i].width;
+		}
+	}
+}
+
+/*
+ * Optimal breaks for words [@a, @b), minimizing the sum of squared free
+ * columns on every line but the last. Only words that fit on one line are
+ * candidates for each line start, so the work is linear in the number of
+ * words for a given width.
+ */
+static int str_wrap_optimal(struct str_wrap_word *w, size_t a, size_t b, size_t width)
+{
+	size_t n = b - a;
+	uint64_t *cost = (uint64_t *)malloc((n + 1) * sizeof(*cost));
+	size_t *from = (size_t *)malloc((n + 1) * sizeof(*from));
+
+	if (!cost || !from) {
+		free(cost);
+		free(from);
+		return -ENOMEM;
+	}
+
+	cost[0] = 0;
+	for (size_t k = 1; k <= n; k++) {
+		size_t line = 0;
+
+		cost[k] = UINT64_MAX;
+		for (size_t i = k; i-- > 0;) {
+			line += w[a + i].width + (i + 1 < k);
+			if (line > width && i + 1 < k)
+				break;
+
+			uint64_t slack = line < width ? width - line : 0;
+			uint64_t c = cost[i] + (k == n ? 0 : slack * slack);
+			if (c < cost[k]) {
+				cost[k] = c;
+				from[k] = i;
+			}
+		}
+	}
+
+	for (size_t k = n; k > 0; k = from[k])
+		w[a + from[k]].line = 1;
+
+	free(cost);
+	free(from);
+	return 0;
+}
+
+
+/*
+ * str_wrap() - Reflows the text of @self into lines of at most @width columns.
+ * @self: Pointer to the Str structure.
+ * @width: Line width in display columns, see str_display_width().
+ * @mode: STR_WRAP_GREEDY or STR_WRAP_OPTIMAL, optionally | STR_WRAP_JUSTIFY.
+ *
+ * Words are runs of non-whitespace; a blank line separates paragraphs. Lines
+ * are filled with words joined by single spaces, greedily or so that the sum
+ * of squared free columns is smallest, and with STR_WRAP_JUSTIFY padded to
+ * exactly @width by widening the gaps. A word wider than @width gets a line
+ * of its own. The result ends with a newline if the text did.
+ *
+ * The output size is computed before anything is written, and the result
+ * is written once into a buffer of exactly that size.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self is NULL or @width is 0
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -EPERM if @self is read-only
+ *    -ENOMEM if memory allocation fails
+ */
+int str_wrap(str *self, size_t width, int mode)
+{
+	if (!self || width == 0)
+		return -EINVAL;
+	if (self->flags & STR_F_RDONLY)
+		return -EPERM;
+	if (!self->data || self->len == 0)
+		return 0;
+
+	STR_TRACE(STR_M_WRAP, self->len);
+
+	const char *src = self->data;
+	size_t n = self->len, count = 0, cap = 64, newlines = 2;
+	struct str_wrap_word *w = (struct str_wrap_word *)malloc(cap * sizeof(*w));
+	int ret = 0;
+
+	if (!w)
+		return -ENOMEM;
+
+	// Split into words, noting where paragraphs start
+	for (size_t i = 0; i < n;) {
+		if (isspace((unsigned char)src[i])) {
+			newlines += src[i++] == '\n';
+			continue;
+		}
+
+		size_t start = i;
+		unsigned char high = 0;
+		while (i < n && !isspace((unsigned char)src[i]))
+			high |= (unsigned char)src[i++];
+
+		if (count == cap) {
+			struct str_wrap_word *tmp = (struct str_wrap_word *)realloc(w, 2 * cap * sizeof(*w));
+			if (!tmp) {
+				free(w);
+				return -ENOMEM;
+			}
+			w = tmp;
+			cap *= 2;
+		}
+		w[count].off = start;
+		w[count].len = i - start;
+		w[count].width = high & 0x80 ? str_display_width_n(src + start, i - start) : i - start;
+		w[count].para = newlines >= 2;
+		w[count].line = 0;
+		count++;
+		newlines = 0;
+	}
+
+	// Break each paragraph into lines
+	for (size_t a = 0; a < count && !ret;) {
+		size_t b = a + 1;
+		while (b < count && !w[b].para)
+			b++;
+
+		if (mode & STR_WRAP_OPTIMAL)
+			ret = str_wrap_optimal(w, a, b, width);
+		else
+			str_wrap_greedy(w, a, b, width);
+		a = b;
+	}
+	if (ret) {
+		free(w);
+		return ret;
+	}
+
+	// Size pass: words, gaps, justification padding and line breaks
+	size_t size = 0, i = 0;
+
+	while (i < count) {
+		size_t e = i + 1, line = w[i].width;
+
+		while (e < count && !w[e].line) {
+			size += 1;
+			line += 1 + w[e].width;
+			e++;
+		}
+		for (size_t k = i; k < e; k++)
+			size += w[k].len;
+		if ((mode & STR_WRAP_JUSTIFY) && e < count && !w[e].para && e - i > 1 && line < width)
+			size += width - line;
+		if (e < count)
+			size += w[e].para ? 2 : 1;
+		i = e;
+	}
+	if (count && src[n - 1] == '\n')
+		size++;
+
+	char *buf = (char *)malloc(size + 1), *out = buf;
+	if (!buf) {
+		free(w);
+		return -ENOMEM;
+	}
+
+	// Write pass
+	for (i = 0; i < count;) {
+		size_t e = i + 1, line = w[i].width;
+
+		while (e < count && !w[e].line)
+			line += 1 + w[e++].width;
+
+		size_t gaps = e - i - 1, extra = 0;
+		if ((mode & STR_WRAP_JUSTIFY) && e < count && !w[e].para && gaps && line < width)
+			extra = width - line;
+
+		for (size_t k = i; k < e; k++) {
+			if (k > i) {
+				size_t pad = 1 + extra / gaps + (k - i - 1 < extra % gaps);
+				memset(out, ' ', pad);
+				out += pad;
+			}
+			memcpy(out, src + w[k].off, w[k].len);
+			out += w[k].len;
+		}
+		if (e < count) {
+			*out++ = '\n';
+			if (w[e].para)
+				*out++ = '\n';
+		}
+		i = e;
+	}
+	if (count && src[n - 1] == '\n')
+		*out++ = '\n';
+	*out = '\0';
+	assert((size_t)(out - buf) == size);
+	free(w);
+
+	if (self->flags & STR_F_MAPPED) {
+		if (size > self->head + self->cap) {
+			free(buf);
+			return -ENOSPC;
+		}
+		memcpy(self->data - self->head, buf, size + 1);
+		self->cap += self->head;
+		self->data -= self->head;
+		self->head = 0;
+		self->len = size;
+		free(buf);
+		return 0;
+	}
+
+	str_clear(self);
+	self->data = buf;
+	self->len = self->cap = size;
+	STR_ALLOC_NOTE(self, size + 1);
+	return 0;
+}
+
+
+/*
+ * str_ref_init() - Builds a 16-byte header for @n bytes at @s.
+ * @ref: Header to fill in.
+ * @s: Bytes to reference. Copied when @n <= STR_REF_INLINE, borrowed otherwise.
+ * @n: Number of bytes.
+ *
+ * Unused inline bytes are zeroed so that headers can be compared word-wise.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @s is NULL with a non-zero @n, or @n does not fit in 32 bits
+ */
+int str_ref_init(str_ref *ref, const char *s, size_t n)
+{
+	assert(ref != NULL);
+
+	if ((s == NULL && n) || n > UINT32_MAX)
+		return -EINVAL;
+
+	memset(ref, 0, sizeof(*ref));
+	ref->len = (uint32_t)n;
+
+	if (n <= STR_REF_INLINE) {
+		if (n)
+			memcpy(ref->buf, s, n);
+	} else {
+		memcpy(ref->buf, s, STR_REF_PREFIX);
+		memcpy(ref->buf + STR_REF_PREFIX, &s, sizeof(s));
+	}
+
+	return 0;
+}
+
+
+/*
+ * str_ref_from_str() - Builds a header referencing the contents of @self.
+ */
+int str_ref_from_str(str_ref *ref, const str *self)
+{
+	assert(self != NULL);
+
+	return str_ref_init(ref, self->data, str_get_size(self));
+}
+
+
+/*
+ * Returns a pointer to the @ref->len bytes described by @ref.
+ * The bytes are not NUL-terminated.
+ */
+const char *str_ref_data(const str_ref *ref)
+{
+	const char *p;
+
+	if (ref->len <= STR_REF_INLINE)
+		return ref->buf;
+
+	memcpy(&p, ref->buf + STR_REF_PREFIX, sizeof(p));
+	return p;
+}
+
+
+/*
+ * str_ref_eq() - Compares two headers for equality.
+ *
+ * Length and prefix are checked as a single 64-bit word; inline strings are
+ * then settled by the second word. Only long strings with matching length
+ * and prefix dereference their data.
+ *
+ * Returns:
+ *     1 if @a and @b hold the same bytes, 0 otherwise
+ */
+int str_ref_eq(const str_ref *a, const str_ref *b)
+{
+	uint64_t wa, wb;
+
+	memcpy(&wa, a, sizeof(wa));
+	memcpy(&wb, b, sizeof(wb));
+	if (wa != wb)
+		return 0;
+
+	if (a->len <= STR_REF_INLINE) {
+		memcpy(&wa, a->buf + STR_REF_PREFIX, sizeof(wa));
+		memcpy(&wb, b->buf + STR_REF_PREFIX, sizeof(wb));
+		return wa == wb;
+	}
+
+	const char *da = str_ref_data(a);
+	const char *db = str_ref_data(b);
+	if (da == db)
+		return 1;
+
+	return memcmp(da + STR_REF_PREFIX, db + STR_REF_PREFIX,
+		      a->len - STR_REF_PREFIX) == 0;
+}
+
+
+/*
+ * str_ref_cmp() - Orders two headers bytewise, shorter strings first on ties.
+ *
+ * Because padding bytes are zero, a difference within the four-byte prefixes
+ * is always the final answer; the data is only read when the prefixes match.
+ *
+ * Returns:
+ *     <0, 0 or >0 like memcmp()
+ */
+int str_ref_cmp(const str_ref *a, const str_ref *b)
+{
+	int r = memcmp(a->buf, b->buf, STR_REF_PREFIX);
+	if (r)
+		return r;
+
+	uint32_t n = a->len < b->len ? a->len : b->len;
+	if (n > STR_REF_PREFIX) {
+		r = memcmp(str_ref_data(a) + STR_REF_PREFIX,
+			   str_ref_data(b) + STR_REF_PREFIX, n - STR_REF_PREFIX);
+		if (r)
+			return r;
+	}
+
+	return (a->len > b->len) - (a->len < b->len);
+}
+
+
+/*
+ * str_ref_starts_with() - Checks whether @self begins with @prefix.
+ *
+ * Returns:
+ *     1 if it does, 0 otherwise
+ */
+int str_ref_starts_with(const str_ref *self, const str_ref *prefix)
+{
+	if (prefix->len > self->len)
+		return 0;
+
+	uint32_t n = prefix->len < STR_REF_PREFIX ? prefix->len : STR_REF_PREFIX;
+	if (memcmp(self->buf, prefix->buf, n))
+		return 0;
+
+	if (prefix->len <= STR_REF_PREFIX)
+		return 1;
+
+	return memcmp(str_ref_data(self) + STR_REF_PREFIX,
+		      str_ref_data(prefix) + STR_REF_PREFIX,
+		      prefix->len - STR_REF_PREFIX) == 0;
+}
+
+
+/*
+ * str_vec_init() - Allocates an empty vector of str_ref headers.
+ * The caller is responsible for freeing it using str_vec_free().
+ */
+str_vec *str_vec_init(void)
+{
+	return (str_vec *)calloc(1, sizeof(str_vec));
+}
+
+
+/*
+ * str_vec_push() - Appends a header for @n bytes at @s.
+ *
+ * Long strings are borrowed, see str_ref_init().
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if the header cannot be built
+ *    -ENOMEM if memory allocation fails
+ */
+int str_vec_push(str_vec *self, const char *s, size_t n)
+{
+	assert(self != NULL);
+
+	if (self->len == self->cap) {
+		size_t cap = self->cap ? self->cap * 2 : 16;
+		str_ref *items = (str_ref *)realloc(self->items, cap * sizeof(str_ref));
+		if (!items)
+			return -ENOMEM;
+
+		self->items = items;
+		self->cap = cap;
+	}
+
+	int ret = str_ref_init(&self->items[self->len], s, n);
+	if (ret)
+		return ret;
+
+	self->len++;
+	return 0;
+}
+
+
+static int str_ref_qsort_cmp(const void *a, const void *b)
+{
+	return str_ref_cmp((const str_ref *)a, (const str_ref *)b);
+}
+
+
+/*
+ * str_vec_sort() - Sorts the headers in @self with str_ref_cmp().
+ */
+void str_vec_sort(str_vec *self)
+{
+	if (self->len > 1)
+		qsort(self->items, self->len, sizeof(str_ref), str_ref_qsort_cmp);
+}
+
+
+/*
+ * It releases @self and its header array. Borrowed data is not touched.
+ */
+void str_vec_free(str_vec *self)
+{
+	if (self) {
+		free(self->items);
+		free(self);
+	}
+}
+
+
+static const uint32_t str_crc32c_table[256] = {
+	0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c,
+	0x26a1e7e8, 0xd4ca64eb, 0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+	0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24, 0x105ec76f, 0xe235446c,
+	0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+	0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc,
+	0xbc267848, 0x4e4dfb4b, 0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+	0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35, 0xaa64d611, 0x580f5512,
+	0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+	0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad,
+	0x1642ae59, 0xe4292d5a, 0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+	0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595, 0x417b1dbc, 0xb3109ebf,
+	0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+	0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f,
+	0xed03a29b, 0x1f682198, 0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+	0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38, 0xdbfc821c, 0x2997011f,
+	0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+	0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e,
+	0x4767748a, 0xb50cf789, 0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859,
+	0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46, 0x7198540d, 0x83f3d70e,
+	0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+	0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de,
+	0xdde0eb2a, 0x2f8b6829, 0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+	0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93, 0x082f63b7, 0xfa44e0b4,
+	0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+	0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b,
+	0xb4091bff, 0x466298fc, 0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c,
+	0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033, 0xa24bb5a6, 0x502036a5,
+	0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+	0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975,
+	0x0e330a81, 0xfc588982, 0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+	0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622, 0x38cc2a06, 0xcaa7a905,
+	0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+	0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8,
+	0xe52cc12c, 0x1747422f, 0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+	0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0, 0xd3d3e1ab, 0x21b862a8,
+	0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+	0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78,
+	0x7fab5e8c, 0x8dc0dd8f, 0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee,
+	0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1, 0x69e9f0d5, 0x9b8273d6,
+	0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+	0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69,
+	0xd5cf889d, 0x27a40b9e, 0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+	0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351
+};
+
+/*
+ * str_crc32c() - Updates a CRC32C (Castagnoli) checksum with @n bytes.
+ * @crc: Previous value, 0 for the first block.
+ *
+ * Uses the SSE4.2 crc32 instruction eight bytes at a time when the build
+ * targets it, and a byte-wise table otherwise.
+ */
+uint32_t str_crc32c(uint32_t crc, const void *buf, size_t n)
+{
+	const unsigned char *p = (const unsigned char *)buf;
+
+	crc = ~crc;
+#if defined(__SSE4_2__) && defined(__x86_64__)
+	uint64_t c = crc;
+	for (; n >= 8; n -= 8, p += 8) {
+		uint64_t v;
+		memcpy(&v, p, sizeof(v));
+		c = _mm_crc32_u64(c, v);
+	}
+	crc = (uint32_t)c;
+	for (; n; n--)
+		crc = _mm_crc32_u8(crc, *p++);
+#else
+	for (; n; n--)
+		crc = str_crc32c_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+#endif
+	return ~crc;
+}
+
+
+
+/*
+ * Byte-parallel helpers: STR_SIMD_BYTES bytes per step with AVX2 or SSE2,
+ * undefined when the build targets neither.
+ */
+#if defined(__AVX2__)
+  #define STR_SIMD_BYTES 32
+typedef __m256i str_simd;
+
+static inline str_simd str_simd_splat(char c) { return _mm256_set1_epi8(c); }
+static inline str_simd str_simd_load(const char *p) { return _mm256_loadu_si256((const __m256i *)p); }
+/* One bit per byte: set where @a and @b are equal. */
+static inline uint32_t str_simd_eq(str_simd a, str_simd b)
+{
+	return (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b));
+}
+/* One bit per byte: set where the byte is not ASCII. */
+static inline uint32_t str_simd_high(str_simd a) { return (uint32_t)_mm256_movemask_epi8(a); }
+/* One bit per byte: set where @a is below @b, comparing as signed bytes. */
+static inline uint32_t str_simd_lt(str_simd a, str_simd b)
+{
+	return (uint32_t)_mm256_movemask_epi8(_mm256_cmpgt_epi8(b, a));
+}
+#elif defined(__SSE2__)
+  #define STR_SIMD_BYTES 16
+typedef __m128i str_simd;
+
+static inline str_simd str_simd_splat(char c) { return _mm_set1_epi8(c); }
+static inline str_simd str_simd_load(const char *p) { return _mm_loadu_si128((const __m128i *)p); }
+static inline uint32_t str_simd_eq(str_simd a, str_simd b)
+{
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b));
+}
+static inline uint32_t str_simd_high(str_simd a) { return (uint32_t)_mm_movemask_epi8(a); }
+static inline uint32_t str_simd_lt(str_simd a, str_simd b)
+{
+	return (uint32_t)_mm_movemask_epi8(_mm_cmpgt_epi8(b, a));
+}
+#endif
+
+
+/* UNICODE TABLES -> */
+/* Generated by tools/gen_unicode.py from Unicode 14.0.0, do not edit. */
+#define STR_WIDTH_SHIFT	7
+#define STR_WIDTH_LIMIT	0x40000
+
+/* Block in str_width_stage2 for each 1 << STR_WIDTH_SHIFT code points. */
+static const uint8_t str_width_stage1[2048] = {
+	  0,   1,   2,   2,   2,   2,   3,   2,   2,   4,   2,   5,   6,   7,   8,   9,
+	 10,  11,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,
+	 26,  27,  28,  29,   2,   2,  30,   2,   2,   2,   2,   2,   2,   2,  31,  32,
+	 33,  34,  35,   2,  36,  37,  38,  39,  40,  41,   2,  42,   2,   2,   2,   2,
+	 43,  44,   2,   2,   2,   2,  45,  46,   2,   2,   2,  47,  48,  49,  50,  51,
+	  2,   2,   2,   2,   2,   2,  52,   2,   2,  53,  54,  55,   2,  56,  57,  58,
+	 59,  60,  61,  62,  63,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  64,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  65,   2,   2,  66,  67,   2,   2,
+	 68,  69,  70,  71,  72,  73,   2,  74,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  75,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,  57,  57,  76,  77,  78,   2,   2,   2,   2,   2,  79,  54,  80,  81,
+	  2,   2,   2,  82,   2,  83,  84,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,  85,  86,   2,   2,   2,   2,  87,   2,   2,  88,  89,  90,
+	 91,  92,  93,  94,  95,  96,  97,   2,  98,  99,   2, 100, 101, 102, 103,   2,
+	104,   2, 105, 106, 107, 108,   2,   2, 109, 110, 111, 112,   2, 113,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2, 114,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2, 115, 116,   2,   2,   2,   2,   2,   2,   2, 117, 118,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57, 119,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57, 120, 121,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 122,
+	 57,  57, 123,  57,  57, 124,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2, 125,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2, 126,   2,
+	  2,   2, 127, 128, 129,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2,   2,   2,   2, 130, 131,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	132,   2, 116,   2,   2, 133,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	  2, 134, 135,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	136, 137,   2, 138, 139,   2, 140, 141, 142, 143, 144, 145, 146, 147,   2, 148,
+	  2,   2, 149,  57, 150, 151,   2,   2,   2,   2,   2,   2,   2,   2,   2,   2,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57, 152,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,
+	 57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57,  57, 152,
+};
+
+/*
+ * Widths packed four to a byte, lowest code point in the low bits, in
+ * blocks of (1 << STR_WIDTH_SHIFT) / 4 bytes.
+ */
+static const uint8_t str_width_stage2[4896] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+	0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+	0x41, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x14, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x51,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+	0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+	0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45,
+	0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+	0x41, 0x15, 0x14, 0x50, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x51, 0x55, 0x55,
+	0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+	0x01, 0x10, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+	0x01, 0x54, 0x55, 0x51, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x54, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x54, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04,
+	0x54, 0x05, 0x04, 0x50, 0x55, 0x41, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14,
+	0x55, 0x45, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+	0x01, 0x54, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x45, 0x55, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x40, 0x55,
+	0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x00, 0x54,
+	0x55, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x00, 0x00, 0x40,
+	0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+	0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+	0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+	0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15, 0x54, 0x55, 0x45, 0x55, 0x01, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x40, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x14,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+	0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x55,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x50, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x04, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x56, 0x96, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+	0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x69,
+	0x55, 0x5a, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xa5, 0x59, 0x65, 0x59,
+	0x55, 0x59, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x66, 0x95, 0x9a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x0a, 0xa0, 0xaa, 0xaa, 0xaa, 0x6a,
+	0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x81, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0x55, 0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55,
+	0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x15, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56,
+	0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x41, 0x55, 0x55,
+	0x15, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x45, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0x51, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0x5a, 0x55, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xa9, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55,
+	0x01, 0x41, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x40, 0x15,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+	0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0x54, 0x55, 0x15,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x55,
+	0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x54, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+	0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x45,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+	0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x54, 0x00, 0x54, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+	0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+	0x04, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x10,
+	0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+	0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x05, 0x10, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x44,
+	0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x05, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+	0x55, 0x15, 0x55, 0x55, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x00, 0x10,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x41, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x45, 0x10,
+	0x00, 0x10, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x50, 0x11, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x54, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x54, 0x55, 0x55, 0x5a, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xa9, 0xaa, 0x69,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+	0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+	0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x10, 0x04, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x65, 0xa9, 0xaa, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x6a, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55,
+	0xaa, 0xaa, 0x56, 0x55, 0x5a, 0x55, 0x55, 0x55, 0xaa, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0xa9, 0xaa, 0x9a, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xa6,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0x6a, 0x95, 0xaa, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0x56, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a,
+	0xa6, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x96,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a,
+	0x55, 0x55, 0x95, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0x5a, 0x55, 0x56, 0x6a, 0xa9, 0x55, 0xa9, 0x55, 0x55, 0x95, 0x56, 0x55, 0xaa, 0xaa, 0x56,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x55, 0x56, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x6a, 0xaa,
+	0xaa, 0x9a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xaa, 0x56, 0xaa, 0x56,
+	0xaa, 0x6a, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x56, 0xaa, 0xaa, 0x6a, 0x55,
+	0xaa, 0x5a, 0x55, 0x55, 0xaa, 0xaa, 0x5a, 0x55, 0xaa, 0xaa, 0x55, 0x55, 0xaa, 0x6a, 0x55, 0x55,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa,
+	0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x5a,
+};
+
+/* Zero-width ranges at or above STR_WIDTH_LIMIT. */
+static const uint32_t str_width_zero_high[3][2] = {
+	{ 0xE0001, 0xE0001 },
+	{ 0xE0020, 0xE007F },
+	{ 0xE0100, 0xE01EF },
+};
+
+#define STR_NORM_SHIFT	6
+#define STR_NORM_LIMIT	0x30000
+#define STR_NORM_NFD_NO	0x01	/* has a canonical decomposition */
+#define STR_NORM_NFC_NO	0x02	/* cannot appear in NFC */
+#define STR_NORM_NFC_MAYBE	0x04	/* may compose with the previous character */
+
+/* Canonical combining class and STR_NORM_* flags, by property index. */
+static const uint8_t str_norm_props[67][2] = {
+	{   0, 0 }, {   0, 1 }, { 230, 4 }, { 230, 0 }, { 232, 0 }, { 220, 0 },
+	{ 216, 4 }, { 202, 0 }, { 220, 4 }, { 202, 4 }, {   1, 0 }, {   1, 4 },
+	{ 230, 3 }, { 240, 4 }, { 233, 0 }, { 234, 0 }, {   0, 3 }, { 222, 0 },
+	{ 228, 0 }, {  10, 0 }, {  11, 0 }, {  12, 0 }, {  13, 0 }, {  14, 0 },
+	{  15, 0 }, {  16, 0 }, {  17, 0 }, {  18, 0 }, {  19, 0 }, {  20, 0 },
+	{  21, 0 }, {  22, 0 }, {  23, 0 }, {  24, 0 }, {  25, 0 }, {  30, 0 },
+	{  31, 0 }, {  32, 0 }, {  27, 0 }, {  28, 0 }, {  29, 0 }, {  33, 0 },
+	{  34, 0 }, {  35, 0 }, {  36, 0 }, {   7, 4 }, {   9, 0 }, {   7, 0 },
+	{   0, 4 }, {  84, 0 }, {  91, 4 }, {   9, 4 }, { 103, 0 }, { 107, 0 },
+	{ 118, 0 }, { 122, 0 }, { 216, 0 }, { 129, 0 }, { 130, 0 }, { 132, 0 },
+	{ 214, 0 }, { 218, 0 }, { 224, 0 }, {   8, 4 }, {  26, 0 }, {   6, 0 },
+	{ 226, 0 },
+};
+
+/* Block in str_norm_stage2 for each 1 << STR_NORM_SHIFT code points. */
+static const uint8_t str_norm_stage1[3072] = {
+	  0,   0,   0,   1,   2,   3,   4,   5,   6,   0,   0,   0,   7,   8,   9,  10,
+	 11,  12,  13,  14,   0,   0,  15,  16,  17,  18,   0,  19,  20,  21,   0,  22,
+	 23,  24,  25,  26,  27,  28,  29,  30,  31,  32,  33,  34,  29,  35,  36,  37,
+	 33,  38,  33,  39,  40,  37,   0,  41,  42,  43,  44,  45,  46,  47,  48,  49,
+	 50,   0,  51,   0,   0,  52,  53,  54,   0,   0,   0,   0,   0,  55,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  56,   0,   0,  57,
+	  0,   0,  58,   0,  59,   0,   0,   0,  60,  61,  62,  63,  64,  65,  66,  67,
+	 68,   0,   0,  69,   0,   0,   0,  70,  71,  71,  72,  73,  74,  75,  76,  77,
+	 78,   0,   0,  79,  80,   0,  81,  82,  83,  84,  85,  86,  87,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  88,   0,   0,   0,   0,
+	  0,   0,   0,  89,   0,  90,   0,  91,   0,   0,   0,   0,   0,   0,   0,   0,
+	 92,  93,  94,  95,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,  96,  97,  98,   0,   0,   0,   0,
+	 99,   0,   0, 100, 101, 102, 103, 104,   0,   0, 105, 106,   0,   0,   0, 107,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,
+	 71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71,  71, 108,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0, 109, 109, 109, 109, 110, 111, 109, 112, 113, 114,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0, 115,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0, 116,   0,   0,   0, 117,   0, 118,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0, 119,   0,   0, 120,   0,   0,   0,   0,
+	  0,   0,   0,   0, 121,   0,   0,   0,   0,   0, 122,   0,   0, 123, 124,   0,
+	  0, 125, 126,   0, 127, 103,   0, 128, 129,   0,   0, 130, 131, 132,   0,   0,
+	  0, 133, 134, 135,   0,   0, 136, 137,  90,   0, 138,   0, 139,   0,   0,   0,
+	140,   0,   0,   0, 141, 142,   0, 143, 144, 145, 146,   0,   0,   0,   0,   0,
+	 90,   0,   0,   0,   0, 147, 148,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 149, 150,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 151,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0, 152,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0, 153, 154, 155,   0, 156,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	157,   0,   0,   0, 150,   0,   0,   0,   0,   0, 158, 159,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0, 160,   0, 161,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+	109, 109, 109, 109, 109, 109, 109, 109, 162,   0,   0,   0,   0,   0,   0,   0,
+	  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+/* Property index of each code point, in blocks of 1 << STR_NORM_SHIFT. */
+static const uint8_t str_norm_stage2[10432] = {
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 0,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  0,  0,
+	 1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 0,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  0,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  0,  0,  0,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  0,
+	 0,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,  0,  1,  1,  1,  1,
+	 1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+	 1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  1,
+	 1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  0,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,
+	 0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 2,  2,  2,  2,  2,  3,  2,  2,  2,  2,  2,  2,  2,  3,  3,  2,
+	 3,  2,  3,  2,  2,  4,  5,  5,  5,  5,  4,  6,  5,  5,  5,  5,
+	 5,  7,  7,  8,  8,  8,  8,  9,  9,  5,  5,  5,  5,  8,  8,  5,
+	 8,  8,  5,  5, 10, 10, 10, 10, 11,  5,  5,  5,  5,  3,  3,  3,
+	12, 12,  2, 12, 12, 13,  3,  5,  5,  5,  3,  3,  3,  5,  5,  0,
+	 3,  3,  3,  5,  5,  5,  5,  3,  4,  5,  5,  3, 14, 15, 15, 14,
+	15, 15, 14,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,
+	 0,  0,  0,  0,  0,  1,  1, 16,  1,  1,  1,  0,  1,  0,  1,  1,
+	 1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,
+	 1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  0,
+	 0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  1,  0,  0,  0,  1,  0,  0,  0,  0,  1,  1,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  3,  3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,
+	 0,  0,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  5,  3,  3,  3,  3,  5,  3,  3,  3, 17,  5,  3,  3,  3,  3,
+	 3,  3,  5,  5,  5,  5,  5,  5,  3,  3,  5,  3,  3, 17, 18,  3,
+	19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 28, 29, 30, 31,  0, 32,
+	 0, 33, 34,  0,  3,  5,  0, 27,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  3, 35, 36, 37,  0,  0,  0,  0,  0,
+	 0,  0,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 38, 39, 40, 35, 36,
+	37, 41, 42,  2,  2,  8,  5,  3,  3,  3,  3,  3,  5,  3,  3,  5,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  1,  0,  0,  3,  3,  3,  3,  3,  3,  3,  0,  0,  3,
+	 3,  3,  3,  5,  3,  0,  0,  3,  3,  0,  5,  3,  3,  5,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  5,  3,  3,  5,  3,  3,  5,  5,  5,  3,  5,  5,  3,  5,  3,
+	 3,  3,  5,  3,  5,  3,  5,  3,  5,  3,  3,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,
+	 3,  3,  5,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  0,  3,  3,  3,  3,  3,
+	 3,  3,  3,  3,  0,  3,  3,  3,  0,  3,  3,  3,  3,  3,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  5,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  3,  5,  5,  5,  3,  3,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  5,
+	 5,  5,  5,  5,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  0,  5,  3,  3,  5,  3,  3,  5,  3,  3,  3,  5,  5,  5,
+	38, 39, 40,  3,  3,  3,  5,  3,  3,  5,  5,  3,  3,  3,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,
+	 0,  1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 45,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,
+	 0,  3,  5,  3,  3,  0,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0, 48,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  0, 16, 16,  0, 16,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 16,  0,  0, 16,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16,  0,  0, 16,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  1,  1, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0, 48, 48,  0,  0,  0,  0, 16, 16,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0, 46,  0,  0,
+	 0,  0,  0,  0,  0, 49, 50,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  0, 48,  0,  0,  0,  0,  1,  1,  0,  1,  1,  0, 46,  0,  0,
+	 0,  0,  0,  0,  0, 48, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46, 46,  0, 48,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 51,  0,  0,  0,  0, 48,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  1,  1, 48,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 52, 52, 46,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 53, 53, 53, 53,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 54, 54, 46,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 55, 55, 55, 55,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  5,  0,  5,  0, 56,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,
+	 0,  0, 16,  0,  0,  0,  0, 16,  0,  0,  0,  0, 16,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+	 0, 57, 58, 16, 59, 16, 16,  0, 16,  0, 58, 58, 58, 58,  0,  0,
+	58, 16,  3,  3, 46,  0,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,
+	 0,  0, 16,  0,  0,  0,  0, 16,  0,  0,  0,  0, 16,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0, 48,  0,
+	 0,  0,  0,  0,  0,  0,  0, 47,  0, 46, 46,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+	48, 48, 48,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 46, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  3,  5,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  3,  5,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  3,  3,  3,  0,  0,  5,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  5,  5,  5,  5,  5,  5,  3,  3,  5,  0,  5,
+	 5,  3,  3,  5,  5,  3,  3,  3,  3,  3,  5,  3,  3,  3,  3,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	 0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 47, 48,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,
+	 1,  1,  0,  1, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  5,  3,  3,  3,
+	 3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46, 46,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 46, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  0, 10,  5,  5,  5,  5,  5,  3,  3,  5,  5,  5,  5,
+	 3,  0, 10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  5,  0,  0,
+	 0,  0,  0,  0,  3,  0,  0,  0,  3,  3,  0,  0,  0,  0,  0,  0,
+	 3,  3,  5,  3,  3,  3,  3,  3,  3,  3,  5,  3,  3, 15, 60,  5,
+	 7,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  3,  3,  3,  3,  4, 18, 18,  5, 61,  3, 14,  5,  3,  5,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,  0,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  0,  1,  0,  1,  0,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1, 16,  1, 16,  1, 16,  1, 16,  1, 16,  1, 16,  1, 16,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1, 16,  1,  0, 16,  0,
+	 0,  1,  1,  1,  1,  0,  1,  1,  1, 16,  1, 16,  1,  1,  1,  1,
+	 1,  1,  1, 16,  0,  0,  1,  1,  1,  1,  1, 16,  0,  1,  1,  1,
+	 1,  1,  1, 16,  1,  1,  1,  1,  1,  1,  1, 16,  1,  1, 16, 16,
+	 0,  0,  1,  1,  1,  0,  1,  1,  1, 16,  1, 16,  1, 16,  0,  0,
+	16, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3, 10, 10,  3,  3,  3,  3, 10, 10, 10,  3,  3,  0,  0,  0,
+	 0,  3,  0,  0,  0, 10, 10,  3,  5,  3, 10, 10,  5,  5,  5,  5,
+	 3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 16,  0,  0,  0, 16, 16,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  1,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  1,  0,  0,  1,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,
+	 1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 16,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+	 3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 61, 18,  4, 17, 62, 62,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,
+	 1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	 1,  0,  1,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  1,  1,  0,  1,  1,  0,  1,  1,  0,  1,  1,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  1,  0,  0,  0,  0, 63, 63,  0,  0,  0,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,
+	 1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,
+	 1,  0,  1,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,
+	 1,  1,  0,  1,  1,  0,  1,  1,  0,  1,  1,  0,  1,  1,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  1,  0,  0,  1,  1,  1,  1,  0,  0,  0,  1,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,
+	 0,  0,  0,  0,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  5,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  0,  3,  3,  5,  0,  0,  3,  3,  0,  0,  0,  0,  0,  3,  3,
+	 0,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+	 1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,
+	16,  0, 16,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,
+	16,  0, 16,  0,  0, 16, 16,  0,  0,  0, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 64, 16,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16,  0, 16, 16, 16, 16, 16,  0, 16,  0,
+	16, 16,  0, 16, 16,  0, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  5,  5,  5,  5,  5,  5,  5,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  3, 10,  5,  0,  0,  0,  0, 46,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  3,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  5,  5,  3,  3,  3,  5,  3,  5,  5,  5,
+	 5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  3,  5,  3,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 46, 45,  0,  0,  0,  0,  0,
+	 3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  0,  0,  0,  1,  1,
+	 0,  0,  0, 46, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	46,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0, 46, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 47, 46,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 47, 47,  0, 48,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1, 46,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 48,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  3,  3,  3,  0,  0,  0,
+	 3,  3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 46,  0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	48,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,  1,  1, 48,  1,  0,
+	 0,  0, 46, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 48,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0, 46,
+	47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 46, 47,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 46, 47,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	48,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0, 46, 46,  0,
+	 0,  0,  0, 47,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 47,  0, 46, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	65, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 10,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 16,
+	16, 16, 16, 16, 16, 56, 56, 10, 10, 10,  0,  0,  0, 66, 56, 56,
+	56, 56, 56,  0,  0,  0,  0,  0,  0,  0,  0,  5,  5,  5,  5,  5,
+	 5,  5,  5,  0,  0,  3,  3,  3,  3,  3,  5,  5,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,  3,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16,
+	16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  3,  3,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 3,  3,  3,  3,  3,  3,  3,  0,  3,  3,  3,  3,  3,  3,  3,  3,
+	 3,  3,  3,  3,  3,  3,  3,  3,  3,  0,  0,  3,  3,  3,  3,  3,
+	 3,  3,  0,  3,  3,  0,  3,  3,  3,  3,  3,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  3,  3,  3,  3,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 5,  5,  5,  5,  5,  5,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  3,  3,  3,  3,  3,  3, 47,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+/* Code points with a full canonical decomposition, Hangul excepted. */
+static const uint32_t str_nfd_cps[2061] = {
+	0x000C0, 0x000C1, 0x000C2, 0x000C3, 0x000C4, 0x000C5, 0x000C7, 0x000C8,
+	0x000C9, 0x000CA, 0x000CB, 0x000CC, 0x000CD, 0x000CE, 0x000CF, 0x000D1,
+	0x000D2, 0x000D3, 0x000D4, 0x000D5, 0x000D6, 0x000D9, 0x000DA, 0x000DB,
+	0x000DC, 0x000DD, 0x000E0, 0x000E1, 0x000E2, 0x000E3, 0x000E4, 0x000E5,
+	0x000E7, 0x000E8, 0x000E9, 0x000EA, 0x000EB, 0x000EC, 0x000ED, 0x000EE,
+	0x000EF, 0x000F1, 0x000F2, 0x000F3, 0x000F4, 0x000F5, 0x000F6, 0x000F9,
+	0x000FA, 0x000FB, 0x000FC, 0x000FD, 0x000FF, 0x00100, 0x00101, 0x00102,
+	0x00103, 0x00104, 0x00105, 0x00106, 0x00107, 0x00108, 0x00109, 0x0010A,
+	0x0010B, 0x0010C, 0x0010D, 0x0010E, 0x0010F, 0x00112, 0x00113, 0x00114,
+	0x00115, 0x00116, 0x00117, 0x00118, 0x00119, 0x0011A, 0x0011B, 0x0011C,
+	0x0011D, 0x0011E, 0x0011F, 0x00120, 0x00121, 0x00122, 0x00123, 0x00124,
+	0x00125, 0x00128, 0x00129, 0x0012A, 0x0012B, 0x0012C, 0x0012D, 0x0012E,
+	0x0012F, 0x00130, 0x00134, 0x00135, 0x00136, 0x00137, 0x00139, 0x0013A,
+	0x0013B, 0x0013C, 0x0013D, 0x0013E, 0x00143, 0x00144, 0x00145, 0x00146,
+	0x00147, 0x00148, 0x0014C, 0x0014D, 0x0014E, 0x0014F, 0x00150, 0x00151,
+	0x00154, 0x00155, 0x00156, 0x00157, 0x00158, 0x00159, 0x0015A, 0x0015B,
+	0x0015C, 0x0015D, 0x0015E, 0x0015F, 0x00160, 0x00161, 0x00162, 0x00163,
+	0x00164, 0x00165, 0x00168, 0x00169, 0x0016A, 0x0016B, 0x0016C, 0x0016D,
+	0x0016E, 0x0016F, 0x00170, 0x00171, 0x00172, 0x00173, 0x00174, 0x00175,
+	0x00176, 0x00177, 0x00178, 0x00179, 0x0017A, 0x0017B, 0x0017C, 0x0017D,
+	0x0017E, 0x001A0, 0x001A1, 0x001AF, 0x001B0, 0x001CD, 0x001CE, 0x001CF,
+	0x001D0, 0x001D1, 0x001D2, 0x001D3, 0x001D4, 0x001D5, 0x001D6, 0x001D7,
+	0x001D8, 0x001D9, 0x001DA, 0x001DB, 0x001DC, 0x001DE, 0x001DF, 0x001E0,
+	0x001E1, 0x001E2, 0x001E3, 0x001E6, 0x001E7, 0x001E8, 0x001E9, 0x001EA,
+	0x001EB, 0x001EC, 0x001ED, 0x001EE, 0x001EF, 0x001F0, 0x001F4, 0x001F5,
+	0x001F8, 0x001F9, 0x001FA, 0x001FB, 0x001FC, 0x001FD, 0x001FE, 0x001FF,
+	0x00200, 0x00201, 0x00202, 0x00203, 0x00204, 0x00205, 0x00206, 0x00207,
+	0x00208, 0x00209, 0x0020A, 0x0020B, 0x0020C, 0x0020D, 0x0020E, 0x0020F,
+	0x00210, 0x00211, 0x00212, 0x00213, 0x00214, 0x00215, 0x00216, 0x00217,
+	0x00218, 0x00219, 0x0021A, 0x0021B, 0x0021E, 0x0021F, 0x00226, 0x00227,
+	0x00228, 0x00229, 0x0022A, 0x0022B, 0x0022C, 0x0022D, 0x0022E, 0x0022F,
+	0x00230, 0x00231, 0x00232, 0x00233, 0x00340, 0x00341, 0x00343, 0x00344,
+	0x00374, 0x0037E, 0x00385, 0x00386, 0x00387, 0x00388, 0x00389, 0x0038A,
+	0x0038C, 0x0038E, 0x0038F, 0x00390, 0x003AA, 0x003AB, 0x003AC, 0x003AD,
+	0x003AE, 0x003AF, 0x003B0, 0x003CA, 0x003CB, 0x003CC, 0x003CD, 0x003CE,
+	0x003D3, 0x003D4, 0x00400, 0x00401, 0x00403, 0x00407, 0x0040C, 0x0040D,
+	0x0040E, 0x00419, 0x00439, 0x00450, 0x00451, 0x00453, 0x00457, 0x0045C,
+	0x0045D, 0x0045E, 0x00476, 0x00477, 0x004C1, 0x004C2, 0x004D0, 0x004D1,
+	0x004D2, 0x004D3, 0x004D6, 0x004D7, 0x004DA, 0x004DB, 0x004DC, 0x004DD,
+	0x004DE, 0x004DF, 0x004E2, 0x004E3, 0x004E4, 0x004E5, 0x004E6, 0x004E7,
+	0x004EA, 0x004EB, 0x004EC, 0x004ED, 0x004EE, 0x004EF, 0x004F0, 0x004F1,
+	0x004F2, 0x004F3, 0x004F4, 0x004F5, 0x004F8, 0x004F9, 0x00622, 0x00623,
+	0x00624, 0x00625, 0x00626, 0x006C0, 0x006C2, 0x006D3, 0x00929, 0x00931,
+	0x00934, 0x00958, 0x00959, 0x0095A, 0x0095B, 0x0095C, 0x0095D, 0x0095E,
+	0x0095F, 0x009CB, 0x009CC, 0x009DC, 0x009DD, 0x009DF, 0x00A33, 0x00A36,
+	0x00A59, 0x00A5A, 0x00A5B, 0x00A5E, 0x00B48, 0x00B4B, 0x00B4C, 0x00B5C,
+	0x00B5D, 0x00B94, 0x00BCA, 0x00BCB, 0x00BCC, 0x00C48, 0x00CC0, 0x00CC7,
+	0x00CC8, 0x00CCA, 0x00CCB, 0x00D4A, 0x00D4B, 0x00D4C, 0x00DDA, 0x00DDC,
+	0x00DDD, 0x00DDE, 0x00F43, 0x00F4D, 0x00F52, 0x00F57, 0x00F5C, 0x00F69,
+	0x00F73, 0x00F75, 0x00F76, 0x00F78, 0x00F81, 0x00F93, 0x00F9D, 0x00FA2,
+	0x00FA7, 0x00FAC, 0x00FB9, 0x01026, 0x01B06, 0x01B08, 0x01B0A, 0x01B0C,
+	0x01B0E, 0x01B12, 0x01B3B, 0x01B3D, 0x01B40, 0x01B41, 0x01B43, 0x01E00,
+	0x01E01, 0x01E02, 0x01E03, 0x01E04, 0x01E05, 0x01E06, 0x01E07, 0x01E08,
+	0x01E09, 0x01E0A, 0x01E0B, 0x01E0C, 0x01E0D, 0x01E0E, 0x01E0F, 0x01E10,
+	0x01E11, 0x01E12, 0x01E13, 0x01E14, 0x01E15, 0x01E16, 0x01E17, 0x01E18,
+	0x01E19, 0x01E1A, 0x01E1B, 0x01E1C, 0x01E1D, 0x01E1E, 0x01E1F, 0x01E20,
+	0x01E21, 0x01E22, 0x01E23, 0x01E24, 0x01E25, 0x01E26, 0x01E27, 0x01E28,
+	0x01E29, 0x01E2A, 0x01E2B, 0x01E2C, 0x01E2D, 0x01E2E, 0x01E2F, 0x01E30,
+	0x01E31, 0x01E32, 0x01E33, 0x01E34, 0x01E35, 0x01E36, 0x01E37, 0x01E38,
+	0x01E39, 0x01E3A, 0x01E3B, 0x01E3C, 0x01E3D, 0x01E3E, 0x01E3F, 0x01E40,
+	0x01E41, 0x01E42, 0x01E43, 0x01E44, 0x01E45, 0x01E46, 0x01E47, 0x01E48,
+	0x01E49, 0x01E4A, 0x01E4B, 0x01E4C, 0x01E4D, 0x01E4E, 0x01E4F, 0x01E50,
+	0x01E51, 0x01E52, 0x01E53, 0x01E54, 0x01E55, 0x01E56, 0x01E57, 0x01E58,
+	0x01E59, 0x01E5A, 0x01E5B, 0x01E5C, 0x01E5D, 0x01E5E, 0x01E5F, 0x01E60,
+	0x01E61, 0x01E62, 0x01E63, 0x01E64, 0x01E65, 0x01E66, 0x01E67, 0x01E68,
+	0x01E69, 0x01E6A, 0x01E6B, 0x01E6C, 0x01E6D, 0x01E6E, 0x01E6F, 0x01E70,
+	0x01E71, 0x01E72, 0x01E73, 0x01E74, 0x01E75, 0x01E76, 0x01E77, 0x01E78,
+	0x01E79, 0x01E7A, 0x01E7B, 0x01E7C, 0x01E7D, 0x01E7E, 0x01E7F, 0x01E80,
+	0x01E81, 0x01E82, 0x01E83, 0x01E84, 0x01E85, 0x01E86, 0x01E87, 0x01E88,
+	0x01E89, 0x01E8A, 0x01E8B, 0x01E8C, 0x01E8D, 0x01E8E, 0x01E8F, 0x01E90,
+	0x01E91, 0x01E92, 0x01E93, 0x01E94, 0x01E95, 0x01E96, 0x01E97, 0x01E98,
+	0x01E99, 0x01E9B, 0x01EA0, 0x01EA1, 0x01EA2, 0x01EA3, 0x01EA4, 0x01EA5,
+	0x01EA6, 0x01EA7, 0x01EA8, 0x01EA9, 0x01EAA, 0x01EAB, 0x01EAC, 0x01EAD,
+	0x01EAE, 0x01EAF, 0x01EB0, 0x01EB1, 0x01EB2, 0x01EB3, 0x01EB4, 0x01EB5,
+	0x01EB6, 0x01EB7, 0x01EB8, 0x01EB9, 0x01EBA, 0x01EBB, 0x01EBC, 0x01EBD,
+	0x01EBE, 0x01EBF, 0x01EC0, 0x01EC1, 0x01EC2, 0x01EC3, 0x01EC4, 0x01EC5,
+	0x01EC6, 0x01EC7, 0x01EC8, 0x01EC9, 0x01ECA, 0x01ECB, 0x01ECC, 0x01ECD,
+	0x01ECE, 0x01ECF, 0x01ED0, 0x01ED1, 0x01ED2, 0x01ED3, 0x01ED4, 0x01ED5,
+	0x01ED6, 0x01ED7, 0x01ED8, 0x01ED9, 0x01EDA, 0x01EDB, 0x01EDC, 0x01EDD,
+	0x01EDE, 0x01EDF, 0x01EE0, 0x01EE1, 0x01EE2, 0x01EE3, 0x01EE4, 0x01EE5,
+	0x01EE6, 0x01EE7, 0x01EE8, 0x01EE9, 0x01EEA, 0x01EEB, 0x01EEC, 0x01EED,
+	0x01EEE, 0x01EEF, 0x01EF0, 0x01EF1, 0x01EF2, 0x01EF3, 0x01EF4, 0x01EF5,
+	0x01EF6, 0x01EF7, 0x01EF8, 0x01EF9, 0x01F00, 0x01F01, 0x01F02, 0x01F03,
+	0x01F04, 0x01F05, 0x01F06, 0x01F07, 0x01F08, 0x01F09, 0x01F0A, 0x01F0B,
+	0x01F0C, 0x01F0D, 0x01F0E, 0x01F0F, 0x01F10, 0x01F11, 0x01F12, 0x01F13,
+	0x01F14, 0x01F15, 0x01F18, 0x01F19, 0x01F1A, 0x01F1B, 0x01F1C, 0x01F1D,
+	0x01F20, 0x01F21, 0x01F22, 0x01F23, 0x01F24, 0x01F25, 0x01F26, 0x01F27,
+	0x01F28, 0x01F29, 0x01F2A, 0x01F2B, 0x01F2C, 0x01F2D, 0x01F2E, 0x01F2F,
+	0x01F30, 0x01F31, 0x01F32, 0x01F33, 0x01F34, 0x01F35, 0x01F36, 0x01F37,
+	0x01F38, 0x01F39, 0x01F3A, 0x01F3B, 0x01F3C, 0x01F3D, 0x01F3E, 0x01F3F,
+	0x01F40, 0x01F41, 0x01F42, 0x01F43, 0x01F44, 0x01F45, 0x01F48, 0x01F49,
+	0x01F4A, 0x01F4B, 0x01F4C, 0x01F4D, 0x01F50, 0x01F51, 0x01F52, 0x01F53,
+	0x01F54, 0x01F55, 0x01F56, 0x01F57, 0x01F59, 0x01F5B, 0x01F5D, 0x01F5F,
+	0x01F60, 0x01F61, 0x01F62, 0x01F63, 0x01F64, 0x01F65, 0x01F66, 0x01F67,
+	0x01F68, 0x01F69, 0x01F6A, 0x01F6B, 0x01F6C, 0x01F6D, 0x01F6E, 0x01F6F,
+	0x01F70, 0x01F71, 0x01F72, 0x01F73, 0x01F74, 0x01F75, 0x01F76, 0x01F77,
+	0x01F78, 0x01F79, 0x01F7A, 0x01F7B, 0x01F7C, 0x01F7D, 0x01F80, 0x01F81,
+	0x01F82, 0x01F83, 0x01F84, 0x01F85, 0x01F86, 0x01F87, 0x01F88, 0x01F89,
+	0x01F8A, 0x01F8B, 0x01F8C, 0x01F8D, 0x01F8E, 0x01F8F, 0x01F90, 0x01F91,
+	0x01F92, 0x01F93, 0x01F94, 0x01F95, 0x01F96, 0x01F97, 0x01F98, 0x01F99,
+	0x01F9A, 0x01F9B, 0x01F9C, 0x01F9D, 0x01F9E, 0x01F9F, 0x01FA0, 0x01FA1,
+	0x01FA2, 0x01FA3, 0x01FA4, 0x01FA5, 0x01FA6, 0x01FA7, 0x01FA8, 0x01FA9,
+	0x01FAA, 0x01FAB, 0x01FAC, 0x01FAD, 0x01FAE, 0x01FAF, 0x01FB0, 0x01FB1,
+	0x01FB2, 0x01FB3, 0x01FB4, 0x01FB6, 0x01FB7, 0x01FB8, 0x01FB9, 0x01FBA,
+	0x01FBB, 0x01FBC, 0x01FBE, 0x01FC1, 0x01FC2, 0x01FC3, 0x01FC4, 0x01FC6,
+	0x01FC7, 0x01FC8, 0x01FC9, 0x01FCA, 0x01FCB, 0x01FCC, 0x01FCD, 0x01FCE,
+	0x01FCF, 0x01FD0, 0x01FD1, 0x01FD2, 0x01FD3, 0x01FD6, 0x01FD7, 0x01FD8,
+	0x01FD9, 0x01FDA, 0x01FDB, 0x01FDD, 0x01FDE, 0x01FDF, 0x01FE0, 0x01FE1,
+	0x01FE2, 0x01FE3, 0x01FE4, 0x01FE5, 0x01FE6, 0x01FE7, 0x01FE8, 0x01FE9,
+	0x01FEA, 0x01FEB, 0x01FEC, 0x01FED, 0x01FEE, 0x01FEF, 0x01FF2, 0x01FF3,
+	0x01FF4, 0x01FF6, 0x01FF7, 0x01FF8, 0x01FF9, 0x01FFA, 0x01FFB, 0x01FFC,
+	0x01FFD, 0x02000, 0x02001, 0x02126, 0x0212A, 0x0212B, 0x0219A, 0x0219B,
+	0x021AE, 0x021CD, 0x021CE, 0x021CF, 0x02204, 0x02209, 0x0220C, 0x02224,
+	0x02226, 0x02241, 0x02244, 0x02247, 0x02249, 0x02260, 0x02262, 0x0226D,
+	0x0226E, 0x0226F, 0x02270, 0x02271, 0x02274, 0x02275, 0x02278, 0x02279,
+	0x02280, 0x02281, 0x02284, 0x02285, 0x02288, 0x02289, 0x022AC, 0x022AD,
+	0x022AE, 0x022AF, 0x022E0, 0x022E1, 0x022E2, 0x022E3, 0x022EA, 0x022EB,
+	0x022EC, 0x022ED, 0x02329, 0x0232A, 0x02ADC, 0x0304C, 0x0304E, 0x03050,
+	0x03052, 0x03054, 0x03056, 0x03058, 0x0305A, 0x0305C, 0x0305E, 0x03060,
+	0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071, 0x03073, 0x03074,
+	0x03076, 0x03077, 0x03079, 0x0307A, 0x0307C, 0x0307D, 0x03094, 0x0309E,
+	0x030AC, 0x030AE, 0x030B0, 0x030B2, 0x030B4, 0x030B6, 0x030B8, 0x030BA,
+	0x030BC, 0x030BE, 0x030C0, 0x030C2, 0x030C5, 0x030C7, 0x030C9, 0x030D0,
+	0x030D1, 0x030D3, 0x030D4, 0x030D6, 0x030D7, 0x030D9, 0x030DA, 0x030DC,
+	0x030DD, 0x030F4, 0x030F7, 0x030F8, 0x030F9, 0x030FA, 0x030FE, 0x0F900,
+	0x0F901, 0x0F902, 0x0F903, 0x0F904, 0x0F905, 0x0F906, 0x0F907, 0x0F908,
+	0x0F909, 0x0F90A, 0x0F90B, 0x0F90C, 0x0F90D, 0x0F90E, 0x0F90F, 0x0F910,
+	0x0F911, 0x0F912, 0x0F913, 0x0F914, 0x0F915, 0x0F916, 0x0F917, 0x0F918,
+	0x0F919, 0x0F91A, 0x0F91B, 0x0F91C, 0x0F91D, 0x0F91E, 0x0F91F, 0x0F920,
+	0x0F921, 0x0F922, 0x0F923, 0x0F924, 0x0F925, 0x0F926, 0x0F927, 0x0F928,
+	0x0F929, 0x0F92A, 0x0F92B, 0x0F92C, 0x0F92D, 0x0F92E, 0x0F92F, 0x0F930,
+	0x0F931, 0x0F932, 0x0F933, 0x0F934, 0x0F935, 0x0F936, 0x0F937, 0x0F938,
+	0x0F939, 0x0F93A, 0x0F93B, 0x0F93C, 0x0F93D, 0x0F93E, 0x0F93F, 0x0F940,
+	0x0F941, 0x0F942, 0x0F943, 0x0F944, 0x0F945, 0x0F946, 0x0F947, 0x0F948,
+	0x0F949, 0x0F94A, 0x0F94B, 0x0F94C, 0x0F94D, 0x0F94E, 0x0F94F, 0x0F950,
+	0x0F951, 0x0F952, 0x0F953, 0x0F954, 0x0F955, 0x0F956, 0x0F957, 0x0F958,
+	0x0F959, 0x0F95A, 0x0F95B, 0x0F95C, 0x0F95D, 0x0F95E, 0x0F95F, 0x0F960,
+	0x0F961, 0x0F962, 0x0F963, 0x0F964, 0x0F965, 0x0F966, 0x0F967, 0x0F968,
+	0x0F969, 0x0F96A, 0x0F96B, 0x0F96C, 0x0F96D, 0x0F96E, 0x0F96F, 0x0F970,
+	0x0F971, 0x0F972, 0x0F973, 0x0F974, 0x0F975, 0x0F976, 0x0F977, 0x0F978,
+	0x0F979, 0x0F97A, 0x0F97B, 0x0F97C, 0x0F97D, 0x0F97E, 0x0F97F, 0x0F980,
+	0x0F981, 0x0F982, 0x0F983, 0x0F984, 0x0F985, 0x0F986, 0x0F987, 0x0F988,
+	0x0F989, 0x0F98A, 0x0F98B, 0x0F98C, 0x0F98D, 0x0F98E, 0x0F98F, 0x0F990,
+	0x0F991, 0x0F992, 0x0F993, 0x0F994, 0x0F995, 0x0F996, 0x0F997, 0x0F998,
+	0x0F999, 0x0F99A, 0x0F99B, 0x0F99C, 0x0F99D, 0x0F99E, 0x0F99F, 0x0F9A0,
+	0x0F9A1, 0x0F9A2, 0x0F9A3, 0x0F9A4, 0x0F9A5, 0x0F9A6, 0x0F9A7, 0x0F9A8,
+	0x0F9A9, 0x0F9AA, 0x0F9AB, 0x0F9AC, 0x0F9AD, 0x0F9AE, 0x0F9AF, 0x0F9B0,
+	0x0F9B1, 0x0F9B2, 0x0F9B3, 0x0F9B4, 0x0F9B5, 0x0F9B6, 0x0F9B7, 0x0F9B8,
+	0x0F9B9, 0x0F9BA, 0x0F9BB, 0x0F9BC, 0x0F9BD, 0x0F9BE, 0x0F9BF, 0x0F9C0,
+	0x0F9C1, 0x0F9C2, 0x0F9C3, 0x0F9C4, 0x0F9C5, 0x0F9C6, 0x0F9C7, 0x0F9C8,
+	0x0F9C9, 0x0F9CA, 0x0F9CB, 0x0F9CC, 0x0F9CD, 0x0F9CE, 0x0F9CF, 0x0F9D0,
+	0x0F9D1, 0x0F9D2, 0x0F9D3, 0x0F9D4, 0x0F9D5, 0x0F9D6, 0x0F9D7, 0x0F9D8,
+	0x0F9D9, 0x0F9DA, 0x0F9DB, 0x0F9DC, 0x0F9DD, 0x0F9DE, 0x0F9DF, 0x0F9E0,
+	0x0F9E1, 0x0F9E2, 0x0F9E3, 0x0F9E4, 0x0F9E5, 0x0F9E6, 0x0F9E7, 0x0F9E8,
+	0x0F9E9, 0x0F9EA, 0x0F9EB, 0x0F9EC, 0x0F9ED, 0x0F9EE, 0x0F9EF, 0x0F9F0,
+	0x0F9F1, 0x0F9F2, 0x0F9F3, 0x0F9F4, 0x0F9F5, 0x0F9F6, 0x0F9F7, 0x0F9F8,
+	0x0F9F9, 0x0F9FA, 0x0F9FB, 0x0F9FC, 0x0F9FD, 0x0F9FE, 0x0F9FF, 0x0FA00,
+	0x0FA01, 0x0FA02, 0x0FA03, 0x0FA04, 0x0FA05, 0x0FA06, 0x0FA07, 0x0FA08,
+	0x0FA09, 0x0FA0A, 0x0FA0B, 0x0FA0C, 0x0FA0D, 0x0FA10, 0x0FA12, 0x0FA15,
+	0x0FA16, 0x0FA17, 0x0FA18, 0x0FA19, 0x0FA1A, 0x0FA1B, 0x0FA1C, 0x0FA1D,
+	0x0FA1E, 0x0FA20, 0x0FA22, 0x0FA25, 0x0FA26, 0x0FA2A, 0x0FA2B, 0x0FA2C,
+	0x0FA2D, 0x0FA2E, 0x0FA2F, 0x0FA30, 0x0FA31, 0x0FA32, 0x0FA33, 0x0FA34,
+	0x0FA35, 0x0FA36, 0x0FA37, 0x0FA38, 0x0FA39, 0x0FA3A, 0x0FA3B, 0x0FA3C,
+	0x0FA3D, 0x0FA3E, 0x0FA3F, 0x0FA40, 0x0FA41, 0x0FA42, 0x0FA43, 0x0FA44,
+	0x0FA45, 0x0FA46, 0x0FA47, 0x0FA48, 0x0FA49, 0x0FA4A, 0x0FA4B, 0x0FA4C,
+	0x0FA4D, 0x0FA4E, 0x0FA4F, 0x0FA50, 0x0FA51, 0x0FA52, 0x0FA53, 0x0FA54,
+	0x0FA55, 0x0FA56, 0x0FA57, 0x0FA58, 0x0FA59, 0x0FA5A, 0x0FA5B, 0x0FA5C,
+	0x0FA5D, 0x0FA5E, 0x0FA5F, 0x0FA60, 0x0FA61, 0x0FA62, 0x0FA63, 0x0FA64,
+	0x0FA65, 0x0FA66, 0x0FA67, 0x0FA68, 0x0FA69, 0x0FA6A, 0x0FA6B, 0x0FA6C,
+	0x0FA6D, 0x0FA70, 0x0FA71, 0x0FA72, 0x0FA73, 0x0FA74, 0x0FA75, 0x0FA76,
+	0x0FA77, 0x0FA78, 0x0FA79, 0x0FA7A, 0x0FA7B, 0x0FA7C, 0x0FA7D, 0x0FA7E,
+	0x0FA7F, 0x0FA80, 0x0FA81, 0x0FA82, 0x0FA83, 0x0FA84, 0x0FA85, 0x0FA86,
+	0x0FA87, 0x0FA88, 0x0FA89, 0x0FA8A, 0x0FA8B, 0x0FA8C, 0x0FA8D, 0x0FA8E,
+	0x0FA8F, 0x0FA90, 0x0FA91, 0x0FA92, 0x0FA93, 0x0FA94, 0x0FA95, 0x0FA96,
+	0x0FA97, 0x0FA98, 0x0FA99, 0x0FA9A, 0x0FA9B, 0x0FA9C, 0x0FA9D, 0x0FA9E,
+	0x0FA9F, 0x0FAA0, 0x0FAA1, 0x0FAA2, 0x0FAA3, 0x0FAA4, 0x0FAA5, 0x0FAA6,
+	0x0FAA7, 0x0FAA8, 0x0FAA9, 0x0FAAA, 0x0FAAB, 0x0FAAC, 0x0FAAD, 0x0FAAE,
+	0x0FAAF, 0x0FAB0, 0x0FAB1, 0x0FAB2, 0x0FAB3, 0x0FAB4, 0x0FAB5, 0x0FAB6,
+	0x0FAB7, 0x0FAB8, 0x0FAB9, 0x0FABA, 0x0FABB, 0x0FABC, 0x0FABD, 0x0FABE,
+	0x0FABF, 0x0FAC0, 0x0FAC1, 0x0FAC2, 0x0FAC3, 0x0FAC4, 0x0FAC5, 0x0FAC6,
+	0x0FAC7, 0x0FAC8, 0x0FAC9, 0x0FACA, 0x0FACB, 0x0FACC, 0x0FACD, 0x0FACE,
+	0x0FACF, 0x0FAD0, 0x0FAD1, 0x0FAD2, 0x0FAD3, 0x0FAD4, 0x0FAD5, 0x0FAD6,
+	0x0FAD7, 0x0FAD8, 0x0FAD9, 0x0FB1D, 0x0FB1F, 0x0FB2A, 0x0FB2B, 0x0FB2C,
+	0x0FB2D, 0x0FB2E, 0x0FB2F, 0x0FB30, 0x0FB31, 0x0FB32, 0x0FB33, 0x0FB34,
+	0x0FB35, 0x0FB36, 0x0FB38, 0x0FB39, 0x0FB3A, 0x0FB3B, 0x0FB3C, 0x0FB3E,
+	0x0FB40, 0x0FB41, 0x0FB43, 0x0FB44, 0x0FB46, 0x0FB47, 0x0FB48, 0x0FB49,
+	0x0FB4A, 0x0FB4B, 0x0FB4C, 0x0FB4D, 0x0FB4E, 0x1109A, 0x1109C, 0x110AB,
+	0x1112E, 0x1112F, 0x1134B, 0x1134C, 0x114BB, 0x114BC, 0x114BE, 0x115BA,
+	0x115BB, 0x11938, 0x1D15E, 0x1D15F, 0x1D160, 0x1D161, 0x1D162, 0x1D163,
+	0x1D164, 0x1D1BB, 0x1D1BC, 0x1D1BD, 0x1D1BE, 0x1D1BF, 0x1D1C0, 0x2F800,
+	0x2F801, 0x2F802, 0x2F803, 0x2F804, 0x2F805, 0x2F806, 0x2F807, 0x2F808,
+	0x2F809, 0x2F80A, 0x2F80B, 0x2F80C, 0x2F80D, 0x2F80E, 0x2F80F, 0x2F810,
+	0x2F811, 0x2F812, 0x2F813, 0x2F814, 0x2F815, 0x2F816, 0x2F817, 0x2F818,
+	0x2F819, 0x2F81A, 0x2F81B, 0x2F81C, 0x2F81D, 0x2F81E, 0x2F81F, 0x2F820,
+	0x2F821, 0x2F822, 0x2F823, 0x2F824, 0x2F825, 0x2F826, 0x2F827, 0x2F828,
+	0x2F829, 0x2F82A, 0x2F82B, 0x2F82C, 0x2F82D, 0x2F82E, 0x2F82F, 0x2F830,
+	0x2F831, 0x2F832, 0x2F833, 0x2F834, 0x2F835, 0x2F836, 0x2F837, 0x2F838,
+	0x2F839, 0x2F83A, 0x2F83B, 0x2F83C, 0x2F83D, 0x2F83E, 0x2F83F, 0x2F840,
+	0x2F841, 0x2F842, 0x2F843, 0x2F844, 0x2F845, 0x2F846, 0x2F847, 0x2F848,
+	0x2F849, 0x2F84A, 0x2F84B, 0x2F84C, 0x2F84D, 0x2F84E, 0x2F84F, 0x2F850,
+	0x2F851, 0x2F852, 0x2F853, 0x2F854, 0x2F855, 0x2F856, 0x2F857, 0x2F858,
+	0x2F859, 0x2F85A, 0x2F85B, 0x2F85C, 0x2F85D, 0x2F85E, 0x2F85F, 0x2F860,
+	0x2F861, 0x2F862, 0x2F863, 0x2F864, 0x2F865, 0x2F866, 0x2F867, 0x2F868,
+	0x2F869, 0x2F86A, 0x2F86B, 0x2F86C, 0x2F86D, 0x2F86E, 0x2F86F, 0x2F870,
+	0x2F871, 0x2F872, 0x2F873, 0x2F874, 0x2F875, 0x2F876, 0x2F877, 0x2F878,
+	0x2F879, 0x2F87A, 0x2F87B, 0x2F87C, 0x2F87D, 0x2F87E, 0x2F87F, 0x2F880,
+	0x2F881, 0x2F882, 0x2F883, 0x2F884, 0x2F885, 0x2F886, 0x2F887, 0x2F888,
+	0x2F889, 0x2F88A, 0x2F88B, 0x2F88C, 0x2F88D, 0x2F88E, 0x2F88F, 0x2F890,
+	0x2F891, 0x2F892, 0x2F893, 0x2F894, 0x2F895, 0x2F896, 0x2F897, 0x2F898,
+	0x2F899, 0x2F89A, 0x2F89B, 0x2F89C, 0x2F89D, 0x2F89E, 0x2F89F, 0x2F8A0,
+	0x2F8A1, 0x2F8A2, 0x2F8A3, 0x2F8A4, 0x2F8A5, 0x2F8A6, 0x2F8A7, 0x2F8A8,
+	0x2F8A9, 0x2F8AA, 0x2F8AB, 0x2F8AC, 0x2F8AD, 0x2F8AE, 0x2F8AF, 0x2F8B0,
+	0x2F8B1, 0x2F8B2, 0x2F8B3, 0x2F8B4, 0x2F8B5, 0x2F8B6, 0x2F8B7, 0x2F8B8,
+	0x2F8B9, 0x2F8BA, 0x2F8BB, 0x2F8BC, 0x2F8BD, 0x2F8BE, 0x2F8BF, 0x2F8C0,
+	0x2F8C1, 0x2F8C2, 0x2F8C3, 0x2F8C4, 0x2F8C5, 0x2F8C6, 0x2F8C7, 0x2F8C8,
+	0x2F8C9, 0x2F8CA, 0x2F8CB, 0x2F8CC, 0x2F8CD, 0x2F8CE, 0x2F8CF, 0x2F8D0,
+	0x2F8D1, 0x2F8D2, 0x2F8D3, 0x2F8D4, 0x2F8D5, 0x2F8D6, 0x2F8D7, 0x2F8D8,
+	0x2F8D9, 0x2F8DA, 0x2F8DB, 0x2F8DC, 0x2F8DD, 0x2F8DE, 0x2F8DF, 0x2F8E0,
+	0x2F8E1, 0x2F8E2, 0x2F8E3, 0x2F8E4, 0x2F8E5, 0x2F8E6, 0x2F8E7, 0x2F8E8,
+	0x2F8E9, 0x2F8EA, 0x2F8EB, 0x2F8EC, 0x2F8ED, 0x2F8EE, 0x2F8EF, 0x2F8F0,
+	0x2F8F1, 0x2F8F2, 0x2F8F3, 0x2F8F4, 0x2F8F5, 0x2F8F6, 0x2F8F7, 0x2F8F8,
+	0x2F8F9, 0x2F8FA, 0x2F8FB, 0x2F8FC, 0x2F8FD, 0x2F8FE, 0x2F8FF, 0x2F900,
+	0x2F901, 0x2F902, 0x2F903, 0x2F904, 0x2F905, 0x2F906, 0x2F907, 0x2F908,
+	0x2F909, 0x2F90A, 0x2F90B, 0x2F90C, 0x2F90D, 0x2F90E, 0x2F90F, 0x2F910,
+	0x2F911, 0x2F912, 0x2F913, 0x2F914, 0x2F915, 0x2F916, 0x2F917, 0x2F918,
+	0x2F919, 0x2F91A, 0x2F91B, 0x2F91C, 0x2F91D, 0x2F91E, 0x2F91F, 0x2F920,
+	0x2F921, 0x2F922, 0x2F923, 0x2F924, 0x2F925, 0x2F926, 0x2F927, 0x2F928,
+	0x2F929, 0x2F92A, 0x2F92B, 0x2F92C, 0x2F92D, 0x2F92E, 0x2F92F, 0x2F930,
+	0x2F931, 0x2F932, 0x2F933, 0x2F934, 0x2F935, 0x2F936, 0x2F937, 0x2F938,
+	0x2F939, 0x2F93A, 0x2F93B, 0x2F93C, 0x2F93D, 0x2F93E, 0x2F93F, 0x2F940,
+	0x2F941, 0x2F942, 0x2F943, 0x2F944, 0x2F945, 0x2F946, 0x2F947, 0x2F948,
+	0x2F949, 0x2F94A, 0x2F94B, 0x2F94C, 0x2F94D, 0x2F94E, 0x2F94F, 0x2F950,
+	0x2F951, 0x2F952, 0x2F953, 0x2F954, 0x2F955, 0x2F956, 0x2F957, 0x2F958,
+	0x2F959, 0x2F95A, 0x2F95B, 0x2F95C, 0x2F95D, 0x2F95E, 0x2F95F, 0x2F960,
+	0x2F961, 0x2F962, 0x2F963, 0x2F964, 0x2F965, 0x2F966, 0x2F967, 0x2F968,
+	0x2F969, 0x2F96A, 0x2F96B, 0x2F96C, 0x2F96D, 0x2F96E, 0x2F96F, 0x2F970,
+	0x2F971, 0x2F972, 0x2F973, 0x2F974, 0x2F975, 0x2F976, 0x2F977, 0x2F978,
+	0x2F979, 0x2F97A, 0x2F97B, 0x2F97C, 0x2F97D, 0x2F97E, 0x2F97F, 0x2F980,
+	0x2F981, 0x2F982, 0x2F983, 0x2F984, 0x2F985, 0x2F986, 0x2F987, 0x2F988,
+	0x2F989, 0x2F98A, 0x2F98B, 0x2F98C, 0x2F98D, 0x2F98E, 0x2F98F, 0x2F990,
+	0x2F991, 0x2F992, 0x2F993, 0x2F994, 0x2F995, 0x2F996, 0x2F997, 0x2F998,
+	0x2F999, 0x2F99A, 0x2F99B, 0x2F99C, 0x2F99D, 0x2F99E, 0x2F99F, 0x2F9A0,
+	0x2F9A1, 0x2F9A2, 0x2F9A3, 0x2F9A4, 0x2F9A5, 0x2F9A6, 0x2F9A7, 0x2F9A8,
+	0x2F9A9, 0x2F9AA, 0x2F9AB, 0x2F9AC, 0x2F9AD, 0x2F9AE, 0x2F9AF, 0x2F9B0,
+	0x2F9B1, 0x2F9B2, 0x2F9B3, 0x2F9B4, 0x2F9B5, 0x2F9B6, 0x2F9B7, 0x2F9B8,
+	0x2F9B9, 0x2F9BA, 0x2F9BB, 0x2F9BC, 0x2F9BD, 0x2F9BE, 0x2F9BF, 0x2F9C0,
+	0x2F9C1, 0x2F9C2, 0x2F9C3, 0x2F9C4, 0x2F9C5, 0x2F9C6, 0x2F9C7, 0x2F9C8,
+	0x2F9C9, 0x2F9CA, 0x2F9CB, 0x2F9CC, 0x2F9CD, 0x2F9CE, 0x2F9CF, 0x2F9D0,
+	0x2F9D1, 0x2F9D2, 0x2F9D3, 0x2F9D4, 0x2F9D5, 0x2F9D6, 0x2F9D7, 0x2F9D8,
+	0x2F9D9, 0x2F9DA, 0x2F9DB, 0x2F9DC, 0x2F9DD, 0x2F9DE, 0x2F9DF, 0x2F9E0,
+	0x2F9E1, 0x2F9E2, 0x2F9E3, 0x2F9E4, 0x2F9E5, 0x2F9E6, 0x2F9E7, 0x2F9E8,
+	0x2F9E9, 0x2F9EA, 0x2F9EB, 0x2F9EC, 0x2F9ED, 0x2F9EE, 0x2F9EF, 0x2F9F0,
+	0x2F9F1, 0x2F9F2, 0x2F9F3, 0x2F9F4, 0x2F9F5, 0x2F9F6, 0x2F9F7, 0x2F9F8,
+	0x2F9F9, 0x2F9FA, 0x2F9FB, 0x2F9FC, 0x2F9FD, 0x2F9FE, 0x2F9FF, 0x2FA00,
+	0x2FA01, 0x2FA02, 0x2FA03, 0x2FA04, 0x2FA05, 0x2FA06, 0x2FA07, 0x2FA08,
+	0x2FA09, 0x2FA0A, 0x2FA0B, 0x2FA0C, 0x2FA0D, 0x2FA0E, 0x2FA0F, 0x2FA10,
+	0x2FA11, 0x2FA12, 0x2FA13, 0x2FA14, 0x2FA15, 0x2FA16, 0x2FA17, 0x2FA18,
+	0x2FA19, 0x2FA1A, 0x2FA1B, 0x2FA1C, 0x2FA1D,
+};
+
+/* Per str_nfd_cps entry: offset into str_nfd_data << 2 | (length - 1). */
+static const uint16_t str_nfd_index[2061] = {
+	0x0001, 0x0009, 0x0011, 0x0019, 0x0021, 0x0029, 0x0031, 0x0039,
+	0x0041, 0x0049, 0x0051, 0x0059, 0x0061, 0x0069, 0x0071, 0x0079,
+	0x0081, 0x0089, 0x0091, 0x0099, 0x00a1, 0x00a9, 0x00b1, 0x00b9,
+	0x00c1, 0x00c9, 0x00d1, 0x00d9, 0x00e1, 0x00e9, 0x00f1, 0x00f9,
+	0x0101, 0x0109, 0x0111, 0x0119, 0x0121, 0x0129, 0x0131, 0x0139,
+	0x0141, 0x0149, 0x0151, 0x0159, 0x0161, 0x0169, 0x0171, 0x0179,
+	0x0181, 0x0189, 0x0191, 0x0199, 0x01a1, 0x01a9, 0x01b1, 0x01b9,
+	0x01c1, 0x01c9, 0x01d1, 0x01d9, 0x01e1, 0x01e9, 0x01f1, 0x01f9,
+	0x0201, 0x0209, 0x0211, 0x0219, 0x0221, 0x0229, 0x0231, 0x0239,
+	0x0241, 0x0249, 0x0251, 0x0259, 0x0261, 0x0269, 0x0271, 0x0279,
+	0x0281, 0x0289, 0x0291, 0x0299, 0x02a1, 0x02a9, 0x02b1, 0x02b9,
+	0x02c1, 0x02c9, 0x02d1, 0x02d9, 0x02e1, 0x02e9, 0x02f1, 0x02f9,
+	0x0301, 0x0309, 0x0311, 0x0319, 0x0321, 0x0329, 0x0331, 0x0339,
+	0x0341, 0x0349, 0x0351, 0x0359, 0x0361, 0x0369, 0x0371, 0x0379,
+	0x0381, 0x0389, 0x0391, 0x0399, 0x03a1, 0x03a9, 0x03b1, 0x03b9,
+	0x03c1, 0x03c9, 0x03d1, 0x03d9, 0x03e1, 0x03e9, 0x03f1, 0x03f9,
+	0x0401, 0x0409, 0x0411, 0x0419, 0x0421, 0x0429, 0x0431, 0x0439,
+	0x0441, 0x0449, 0x0451, 0x0459, 0x0461, 0x0469, 0x0471, 0x0479,
+	0x0481, 0x0489, 0x0491, 0x0499, 0x04a1, 0x04a9, 0x04b1, 0x04b9,
+	0x04c1, 0x04c9, 0x04d1, 0x04d9, 0x04e1, 0x04e9, 0x04f1, 0x04f9,
+	0x0501, 0x0509, 0x0511, 0x0519, 0x0521, 0x0529, 0x0531, 0x0539,
+	0x0541, 0x0549, 0x0551, 0x0559, 0x0561, 0x056a, 0x0576, 0x0582,
+	0x058e, 0x059a, 0x05a6, 0x05b2, 0x05be, 0x05ca, 0x05d6, 0x05e2,
+	0x05ee, 0x05f9, 0x0601, 0x0609, 0x0611, 0x0619, 0x0621, 0x0629,
+	0x0631, 0x063a, 0x0646, 0x0651, 0x0659, 0x0661, 0x0669, 0x0671,
+	0x0679, 0x0681, 0x068a, 0x0696, 0x06a1, 0x06a9, 0x06b1, 0x06b9,
+	0x06c1, 0x06c9, 0x06d1, 0x06d9, 0x06e1, 0x06e9, 0x06f1, 0x06f9,
+	0x0701, 0x0709, 0x0711, 0x0719, 0x0721, 0x0729, 0x0731, 0x0739,
+	0x0741, 0x0749, 0x0751, 0x0759, 0x0761, 0x0769, 0x0771, 0x0779,
+	0x0781, 0x0789, 0x0791, 0x0799, 0x07a1, 0x07a9, 0x07b1, 0x07b9,
+	0x07c1, 0x07c9, 0x07d2, 0x07de, 0x07ea, 0x07f6, 0x0801, 0x0809,
+	0x0812, 0x081e, 0x0829, 0x0831, 0x0838, 0x083c, 0x0840, 0x0845,
+	0x084c, 0x0850, 0x0855, 0x085d, 0x0864, 0x0869, 0x0871, 0x0879,
+	0x0881, 0x0889, 0x0891, 0x089a, 0x08a5, 0x08ad, 0x08b5, 0x08bd,
+	0x08c5, 0x08cd, 0x08d6, 0x08e1, 0x08e9, 0x08f1, 0x08f9, 0x0901,
+	0x0909, 0x0911, 0x0919, 0x0921, 0x0929, 0x0931, 0x0939, 0x0941,
+	0x0949, 0x0951, 0x0959, 0x0961, 0x0969, 0x0971, 0x0979, 0x0981,
+	0x0989, 0x0991, 0x0999, 0x09a1, 0x09a9, 0x09b1, 0x09b9, 0x09c1,
+	0x09c9, 0x09d1, 0x09d9, 0x09e1, 0x09e9, 0x09f1, 0x09f9, 0x0a01,
+	0x0a09, 0x0a11, 0x0a19, 0x0a21, 0x0a29, 0x0a31, 0x0a39, 0x0a41,
+	0x0a49, 0x0a51, 0x0a59, 0x0a61, 0x0a69, 0x0a71, 0x0a79, 0x0a81,
+	0x0a89, 0x0a91, 0x0a99, 0x0aa1, 0x0aa9, 0x0ab1, 0x0ab9, 0x0ac1,
+	0x0ac9, 0x0ad1, 0x0ad9, 0x0ae1, 0x0ae9, 0x0af1, 0x0af9, 0x0b01,
+	0x0b09, 0x0b11, 0x0b19, 0x0b21, 0x0b29, 0x0b31, 0x0b39, 0x0b41,
+	0x0b49, 0x0b51, 0x0b59, 0x0b61, 0x0b69, 0x0b71, 0x0b79, 0x0b81,
+	0x0b89, 0x0b91, 0x0b99, 0x0ba1, 0x0ba9, 0x0bb1, 0x0bb9, 0x0bc1,
+	0x0bc9, 0x0bd1, 0x0bd9, 0x0be1, 0x0be9, 0x0bf1, 0x0bf9, 0x0c01,
+	0x0c09, 0x0c11, 0x0c1a, 0x0c25, 0x0c2d, 0x0c35, 0x0c3d, 0x0c45,
+	0x0c4e, 0x0c59, 0x0c61, 0x0c69, 0x0c71, 0x0c79, 0x0c81, 0x0c89,
+	0x0c91, 0x0c99, 0x0ca1, 0x0ca9, 0x0cb1, 0x0cb9, 0x0cc1, 0x0cc9,
+	0x0cd1, 0x0cd9, 0x0ce1, 0x0ce9, 0x0cf1, 0x0cf9, 0x0d01, 0x0d09,
+	0x0d11, 0x0d19, 0x0d21, 0x0d29, 0x0d31, 0x0d39, 0x0d41, 0x0d49,
+	0x0d51, 0x0d59, 0x0d61, 0x0d69, 0x0d71, 0x0d79, 0x0d81, 0x0d8a,
+	0x0d96, 0x0da1, 0x0da9, 0x0db1, 0x0db9, 0x0dc1, 0x0dc9, 0x0dd1,
+	0x0dd9, 0x0de1, 0x0de9, 0x0df2, 0x0dfe, 0x0e0a, 0x0e16, 0x0e21,
+	0x0e29, 0x0e31, 0x0e39, 0x0e42, 0x0e4e, 0x0e59, 0x0e61, 0x0e69,
+	0x0e71, 0x0e79, 0x0e81, 0x0e89, 0x0e91, 0x0e99, 0x0ea1, 0x0ea9,
+	0x0eb1, 0x0eb9, 0x0ec1, 0x0ec9, 0x0ed1, 0x0eda, 0x0ee6, 0x0ef1,
+	0x0ef9, 0x0f01, 0x0f09, 0x0f11, 0x0f19, 0x0f21, 0x0f29, 0x0f32,
+	0x0f3e, 0x0f49, 0x0f51, 0x0f59, 0x0f61, 0x0f69, 0x0f71, 0x0f79,
+	0x0f81, 0x0f89, 0x0f91, 0x0f99, 0x0fa1, 0x0fa9, 0x0fb1, 0x0fb9,
+	0x0fc1, 0x0fc9, 0x0fd1, 0x0fda, 0x0fe6, 0x0ff2, 0x0ffe, 0x100a,
+	0x1016, 0x1022, 0x102e, 0x1039, 0x1041, 0x1049, 0x1051, 0x1059,
+	0x1061, 0x1069, 0x1071, 0x107a, 0x1086, 0x1091, 0x1099, 0x10a1,
+	0x10a9, 0x10b1, 0x10b9, 0x10c2, 0x10ce, 0x10da, 0x10e6, 0x10f2,
+	0x10fe, 0x1109, 0x1111, 0x1119, 0x1121, 0x1129, 0x1131, 0x1139,
+	0x1141, 0x1149, 0x1151, 0x1159, 0x1161, 0x1169, 0x1171, 0x117a,
+	0x1186, 0x1192, 0x119e, 0x11a9, 0x11b1, 0x11b9, 0x11c1, 0x11c9,
+	0x11d1, 0x11d9, 0x11e1, 0x11e9, 0x11f1, 0x11f9, 0x1201, 0x1209,
+	0x1211, 0x1219, 0x1221, 0x1229, 0x1231, 0x1239, 0x1241, 0x1249,
+	0x1251, 0x1259, 0x1261, 0x1269, 0x1271, 0x1279, 0x1281, 0x1289,
+	0x1291, 0x1299, 0x12a1, 0x12a9, 0x12b1, 0x12b9, 0x12c2, 0x12ce,
+	0x12da, 0x12e6, 0x12f2, 0x12fe, 0x130a, 0x1316, 0x1322, 0x132e,
+	0x133a, 0x1346, 0x1352, 0x135e, 0x136a, 0x1376, 0x1382, 0x138e,
+	0x139a, 0x13a6, 0x13b1, 0x13b9, 0x13c1, 0x13c9, 0x13d1, 0x13d9,
+	0x13e2, 0x13ee, 0x13fa, 0x1406, 0x1412, 0x141e, 0x142a, 0x1436,
+	0x1442, 0x144e, 0x1459, 0x1461, 0x1469, 0x1471, 0x1479, 0x1481,
+	0x1489, 0x1491, 0x149a, 0x14a6, 0x14b2, 0x14be, 0x14ca, 0x14d6,
+	0x14e2, 0x14ee, 0x14fa, 0x1506, 0x1512, 0x151e, 0x152a, 0x1536,
+	0x1542, 0x154e, 0x155a, 0x1566, 0x1572, 0x157e, 0x1589, 0x1591,
+	0x1599, 0x15a1, 0x15aa, 0x15b6, 0x15c2, 0x15ce, 0x15da, 0x15e6,
+	0x15f2, 0x15fe, 0x160a, 0x1616, 0x1621, 0x1629, 0x1631, 0x1639,
+	0x1641, 0x1649, 0x1651, 0x1659, 0x1661, 0x1669, 0x1672, 0x167e,
+	0x168a, 0x1696, 0x16a2, 0x16ae, 0x16b9, 0x16c1, 0x16ca, 0x16d6,
+	0x16e2, 0x16ee, 0x16fa, 0x1706, 0x1711, 0x1719, 0x1722, 0x172e,
+	0x173a, 0x1746, 0x1751, 0x1759, 0x1762, 0x176e, 0x177a, 0x1786,
+	0x1791, 0x1799, 0x17a2, 0x17ae, 0x17ba, 0x17c6, 0x17d2, 0x17de,
+	0x17e9, 0x17f1, 0x17fa, 0x1806, 0x1812, 0x181e, 0x182a, 0x1836,
+	0x1841, 0x1849, 0x1852, 0x185e, 0x186a, 0x1876, 0x1882, 0x188e,
+	0x1899, 0x18a1, 0x18aa, 0x18b6, 0x18c2, 0x18ce, 0x18da, 0x18e6,
+	0x18f1, 0x18f9, 0x1902, 0x190e, 0x191a, 0x1926, 0x1931, 0x1939,
+	0x1942, 0x194e, 0x195a, 0x1966, 0x1971, 0x1979, 0x1982, 0x198e,
+	0x199a, 0x19a6, 0x19b2, 0x19be, 0x19c9, 0x19d2, 0x19de, 0x19ea,
+	0x19f5, 0x19fd, 0x1a06, 0x1a12, 0x1a1e, 0x1a2a, 0x1a36, 0x1a42,
+	0x1a4d, 0x1a55, 0x1a5e, 0x1a6a, 0x1a76, 0x1a82, 0x1a8e, 0x1a9a,
+	0x1aa5, 0x1aad, 0x1ab5, 0x1abd, 0x1ac5, 0x1acd, 0x1ad5, 0x1add,
+	0x1ae5, 0x1aed, 0x1af5, 0x1afd, 0x1b05, 0x1b0d, 0x1b16, 0x1b22,
+	0x1b2f, 0x1b3f, 0x1b4f, 0x1b5f, 0x1b6f, 0x1b7f, 0x1b8e, 0x1b9a,
+	0x1ba7, 0x1bb7, 0x1bc7, 0x1bd7, 0x1be7, 0x1bf7, 0x1c06, 0x1c12,
+	0x1c1f, 0x1c2f, 0x1c3f, 0x1c4f, 0x1c5f, 0x1c6f, 0x1c7e, 0x1c8a,
+	0x1c97, 0x1ca7, 0x1cb7, 0x1cc7, 0x1cd7, 0x1ce7, 0x1cf6, 0x1d02,
+	0x1d0f, 0x1d1f, 0x1d2f, 0x1d3f, 0x1d4f, 0x1d5f, 0x1d6e, 0x1d7a,
+	0x1d87, 0x1d97, 0x1da7, 0x1db7, 0x1dc7, 0x1dd7, 0x1de5, 0x1ded,
+	0x1df6, 0x1e01, 0x1e0a, 0x1e15, 0x1e1e, 0x1e29, 0x1e31, 0x1e39,
+	0x1e41, 0x1e49, 0x1e50, 0x1e55, 0x1e5e, 0x1e69, 0x1e72, 0x1e7d,
+	0x1e86, 0x1e91, 0x1e99, 0x1ea1, 0x1ea9, 0x1eb1, 0x1eb9, 0x1ec1,
+	0x1ec9, 0x1ed1, 0x1ed9, 0x1ee2, 0x1eee, 0x1ef9, 0x1f02, 0x1f0d,
+	0x1f15, 0x1f1d, 0x1f25, 0x1f2d, 0x1f35, 0x1f3d, 0x1f45, 0x1f4d,
+	0x1f56, 0x1f62, 0x1f6d, 0x1f75, 0x1f7d, 0x1f86, 0x1f91, 0x1f99,
+	0x1fa1, 0x1fa9, 0x1fb1, 0x1fb9, 0x1fc1, 0x1fc8, 0x1fce, 0x1fd9,
+	0x1fe2, 0x1fed, 0x1ff6, 0x2001, 0x2009, 0x2011, 0x2019, 0x2021,
+	0x2028, 0x202c, 0x2030, 0x2034, 0x2038, 0x203d, 0x2045, 0x204d,
+	0x2055, 0x205d, 0x2065, 0x206d, 0x2075, 0x207d, 0x2085, 0x208d,
+	0x2095, 0x209d, 0x20a5, 0x20ad, 0x20b5, 0x20bd, 0x20c5, 0x20cd,
+	0x20d5, 0x20dd, 0x20e5, 0x20ed, 0x20f5, 0x20fd, 0x2105, 0x210d,
+	0x2115, 0x211d, 0x2125, 0x212d, 0x2135, 0x213d, 0x2145, 0x214d,
+	0x2155, 0x215d, 0x2165, 0x216d, 0x2175, 0x217d, 0x2185, 0x218d,
+	0x2195, 0x219d, 0x21a4, 0x21a8, 0x21ad, 0x21b5, 0x21bd, 0x21c5,
+	0x21cd, 0x21d5, 0x21dd, 0x21e5, 0x21ed, 0x21f5, 0x21fd, 0x2205,
+	0x220d, 0x2215, 0x221d, 0x2225, 0x222d, 0x2235, 0x223d, 0x2245,
+	0x224d, 0x2255, 0x225d, 0x2265, 0x226d, 0x2275, 0x227d, 0x2285,
+	0x228d, 0x2295, 0x229d, 0x22a5, 0x22ad, 0x22b5, 0x22bd, 0x22c5,
+	0x22cd, 0x22d5, 0x22dd, 0x22e5, 0x22ed, 0x22f5, 0x22fd, 0x2305,
+	0x230d, 0x2315, 0x231d, 0x2325, 0x232d, 0x2335, 0x233d, 0x2345,
+	0x234d, 0x2355, 0x235d, 0x2365, 0x236d, 0x2375, 0x237d, 0x2384,
+	0x2388, 0x238c, 0x2390, 0x2394, 0x2398, 0x239c, 0x23a0, 0x23a4,
+	0x23a8, 0x23ac, 0x23b0, 0x23b4, 0x23b8, 0x23bc, 0x23c0, 0x23c4,
+	0x23c8, 0x23cc, 0x23d0, 0x23d4, 0x23d8, 0x23dc, 0x23e0, 0x23e4,
+	0x23e8, 0x23ec, 0x23f0, 0x23f4, 0x23f8, 0x23fc, 0x2400, 0x2404,
+	0x2408, 0x240c, 0x2410, 0x2414, 0x2418, 0x241c, 0x2420, 0x2424,
+	0x2428, 0x242c, 0x2430, 0x2434, 0x2438, 0x243c, 0x2440, 0x2444,
+	0x2448, 0x244c, 0x2450, 0x2454, 0x2458, 0x245c, 0x2460, 0x2464,
+	0x2468, 0x246c, 0x2470, 0x2474, 0x2478, 0x247c, 0x2480, 0x2484,
+	0x2488, 0x248c, 0x2490, 0x2494, 0x2498, 0x249c, 0x24a0, 0x24a4,
+	0x24a8, 0x24ac, 0x24b0, 0x24b4, 0x24b8, 0x24bc, 0x24c0, 0x24c4,
+	0x24c8, 0x24cc, 0x24d0, 0x24d4, 0x24d8, 0x24dc, 0x24e0, 0x24e4,
+	0x24e8, 0x24ec, 0x24f0, 0x24f4, 0x24f8, 0x24fc, 0x2500, 0x2504,
+	0x2508, 0x250c, 0x2510, 0x2514, 0x2518, 0x251c, 0x2520, 0x2524,
+	0x2528, 0x252c, 0x2530, 0x2534, 0x2538, 0x253c, 0x2540, 0x2544,
+	0x2548, 0x254c, 0x2550, 0x2554, 0x2558, 0x255c, 0x2560, 0x2564,
+	0x2568, 0x256c, 0x2570, 0x2574, 0x2578, 0x257c, 0x2580, 0x2584,
+	0x2588, 0x258c, 0x2590, 0x2594, 0x2598, 0x259c, 0x25a0, 0x25a4,
+	0x25a8, 0x25ac, 0x25b0, 0x25b4, 0x25b8, 0x25bc, 0x25c0, 0x25c4,
+	0x25c8, 0x25cc, 0x25d0, 0x25d4, 0x25d8, 0x25dc, 0x25e0, 0x25e4,
+	0x25e8, 0x25ec, 0x25f0, 0x25f4, 0x25f8, 0x25fc, 0x2600, 0x2604,
+	0x2608, 0x260c, 0x2610, 0x2614, 0x2618, 0x261c, 0x2620, 0x2624,
+	0x2628, 0x262c, 0x2630, 0x2634, 0x2638, 0x263c, 0x2640, 0x2644,
+	0x2648, 0x264c, 0x2650, 0x2654, 0x2658, 0x265c, 0x2660, 0x2664,
+	0x2668, 0x266c, 0x2670, 0x2674, 0x2678, 0x267c, 0x2680, 0x2684,
+	0x2688, 0x268c, 0x2690, 0x2694, 0x2698, 0x269c, 0x26a0, 0x26a4,
+	0x26a8, 0x26ac, 0x26b0, 0x26b4, 0x26b8, 0x26bc, 0x26c0, 0x26c4,
+	0x26c8, 0x26cc, 0x26d0, 0x26d4, 0x26d8, 0x26dc, 0x26e0, 0x26e4,
+	0x26e8, 0x26ec, 0x26f0, 0x26f4, 0x26f8, 0x26fc, 0x2700, 0x2704,
+	0x2708, 0x270c, 0x2710, 0x2714, 0x2718, 0x271c, 0x2720, 0x2724,
+	0x2728, 0x272c, 0x2730, 0x2734, 0x2738, 0x273c, 0x2740, 0x2744,
+	0x2748, 0x274c, 0x2750, 0x2754, 0x2758, 0x275c, 0x2760, 0x2764,
+	0x2768, 0x276c, 0x2770, 0x2774, 0x2778, 0x277c, 0x2780, 0x2784,
+	0x2788, 0x278c, 0x2790, 0x2794, 0x2798, 0x279c, 0x27a0, 0x27a4,
+	0x27a8, 0x27ac, 0x27b0, 0x27b4, 0x27b8, 0x27bc, 0x27c0, 0x27c4,
+	0x27c8, 0x27cc, 0x27d0, 0x27d4, 0x27d8, 0x27dc, 0x27e0, 0x27e4,
+	0x27e8, 0x27ec, 0x27f0, 0x27f4, 0x27f8, 0x27fc, 0x2800, 0x2804,
+	0x2808, 0x280c, 0x2810, 0x2814, 0x2818, 0x281c, 0x2820, 0x2824,
+	0x2828, 0x282c, 0x2830, 0x2834, 0x2838, 0x283c, 0x2840, 0x2844,
+	0x2848, 0x284c, 0x2850, 0x2854, 0x2858, 0x285c, 0x2860, 0x2864,
+	0x2868, 0x286c, 0x2870, 0x2874, 0x2878, 0x287c, 0x2880, 0x2884,
+	0x2888, 0x288c, 0x2890, 0x2894, 0x2898, 0x289c, 0x28a0, 0x28a4,
+	0x28a8, 0x28ac, 0x28b0, 0x28b4, 0x28b8, 0x28bc, 0x28c0, 0x28c4,
+	0x28c8, 0x28cc, 0x28d0, 0x28d4, 0x28d8, 0x28dc, 0x28e0, 0x28e4,
+	0x28e8, 0x28ec, 0x28f0, 0x28f4, 0x28f8, 0x28fc, 0x2900, 0x2904,
+	0x2908, 0x290c, 0x2910, 0x2914, 0x2918, 0x291c, 0x2920, 0x2924,
+	0x2928, 0x292c, 0x2930, 0x2934, 0x2938, 0x293c, 0x2940, 0x2944,
+	0x2948, 0x294c, 0x2950, 0x2954, 0x2958, 0x295c, 0x2960, 0x2964,
+	0x2968, 0x296c, 0x2970, 0x2974, 0x2978, 0x297c, 0x2980, 0x2984,
+	0x2988, 0x298c, 0x2990, 0x2994, 0x2998, 0x299c, 0x29a0, 0x29a4,
+	0x29a8, 0x29ac, 0x29b0, 0x29b4, 0x29b8, 0x29bc, 0x29c0, 0x29c4,
+	0x29c8, 0x29cc, 0x29d0, 0x29d4, 0x29d8, 0x29dc, 0x29e0, 0x29e4,
+	0x29e8, 0x29ec, 0x29f0, 0x29f4, 0x29f8, 0x29fc, 0x2a00, 0x2a04,
+	0x2a08, 0x2a0c, 0x2a10, 0x2a14, 0x2a18, 0x2a1c, 0x2a20, 0x2a24,
+	0x2a28, 0x2a2c, 0x2a30, 0x2a34, 0x2a38, 0x2a3c, 0x2a40, 0x2a44,
+	0x2a48, 0x2a4c, 0x2a50, 0x2a54, 0x2a58, 0x2a5c, 0x2a60, 0x2a64,
+	0x2a68, 0x2a6c, 0x2a70, 0x2a74, 0x2a78, 0x2a7c, 0x2a80, 0x2a84,
+	0x2a88, 0x2a8c, 0x2a90, 0x2a94, 0x2a98, 0x2a9c, 0x2aa0, 0x2aa4,
+	0x2aa8, 0x2aac, 0x2ab0, 0x2ab5, 0x2abd, 0x2ac5, 0x2acd, 0x2ad6,
+	0x2ae2, 0x2aed, 0x2af5, 0x2afd, 0x2b05, 0x2b0d, 0x2b15, 0x2b1d,
+	0x2b25, 0x2b2d, 0x2b35, 0x2b3d, 0x2b45, 0x2b4d, 0x2b55, 0x2b5d,
+	0x2b65, 0x2b6d, 0x2b75, 0x2b7d, 0x2b85, 0x2b8d, 0x2b95, 0x2b9d,
+	0x2ba5, 0x2bad, 0x2bb5, 0x2bbd, 0x2bc5, 0x2bcd, 0x2bd5, 0x2bdd,
+	0x2be5, 0x2bed, 0x2bf5, 0x2bfd, 0x2c05, 0x2c0d, 0x2c15, 0x2c1d,
+	0x2c25, 0x2c2d, 0x2c35, 0x2c3d, 0x2c46, 0x2c52, 0x2c5e, 0x2c6a,
+	0x2c76, 0x2c81, 0x2c89, 0x2c92, 0x2c9e, 0x2caa, 0x2cb6, 0x2cc0,
+	0x2cc4, 0x2cc8, 0x2ccc, 0x2cd0, 0x2cd4, 0x2cd8, 0x2cdc, 0x2ce0,
+	0x2ce4, 0x2ce8, 0x2cec, 0x2cf0, 0x2cf4, 0x2cf8, 0x2cfc, 0x2d00,
+	0x2d04, 0x2d08, 0x2d0c, 0x2d10, 0x2d14, 0x2d18, 0x2d1c, 0x2d20,
+	0x2d24, 0x2d28, 0x2d2c, 0x2d30, 0x2d34, 0x2d38, 0x2d3c, 0x2d40,
+	0x2d44, 0x2d48, 0x2d4c, 0x2d50, 0x2d54, 0x2d58, 0x2d5c, 0x2d60,
+	0x2d64, 0x2d68, 0x2d6c, 0x2d70, 0x2d74, 0x2d78, 0x2d7c, 0x2d80,
+	0x2d84, 0x2d88, 0x2d8c, 0x2d90, 0x2d94, 0x2d98, 0x2d9c, 0x2da0,
+	0x2da4, 0x2da8, 0x2dac, 0x2db0, 0x2db4, 0x2db8, 0x2dbc, 0x2dc0,
+	0x2dc4, 0x2dc8, 0x2dcc, 0x2dd0, 0x2dd4, 0x2dd8, 0x2ddc, 0x2de0,
+	0x2de4, 0x2de8, 0x2dec, 0x2df0, 0x2df4, 0x2df8, 0x2dfc, 0x2e00,
+	0x2e04, 0x2e08, 0x2e0c, 0x2e10, 0x2e14, 0x2e18, 0x2e1c, 0x2e20,
+	0x2e24, 0x2e28, 0x2e2c, 0x2e30, 0x2e34, 0x2e38, 0x2e3c, 0x2e40,
+	0x2e44, 0x2e48, 0x2e4c, 0x2e50, 0x2e54, 0x2e58, 0x2e5c, 0x2e60,
+	0x2e64, 0x2e68, 0x2e6c, 0x2e70, 0x2e74, 0x2e78, 0x2e7c, 0x2e80,
+	0x2e84, 0x2e88, 0x2e8c, 0x2e90, 0x2e94, 0x2e98, 0x2e9c, 0x2ea0,
+	0x2ea4, 0x2ea8, 0x2eac, 0x2eb0, 0x2eb4, 0x2eb8, 0x2ebc, 0x2ec0,
+	0x2ec4, 0x2ec8, 0x2ecc, 0x2ed0, 0x2ed4, 0x2ed8, 0x2edc, 0x2ee0,
+	0x2ee4, 0x2ee8, 0x2eec, 0x2ef0, 0x2ef4, 0x2ef8, 0x2efc, 0x2f00,
+	0x2f04, 0x2f08, 0x2f0c, 0x2f10, 0x2f14, 0x2f18, 0x2f1c, 0x2f20,
+	0x2f24, 0x2f28, 0x2f2c, 0x2f30, 0x2f34, 0x2f38, 0x2f3c, 0x2f40,
+	0x2f44, 0x2f48, 0x2f4c, 0x2f50, 0x2f54, 0x2f58, 0x2f5c, 0x2f60,
+	0x2f64, 0x2f68, 0x2f6c, 0x2f70, 0x2f74, 0x2f78, 0x2f7c, 0x2f80,
+	0x2f84, 0x2f88, 0x2f8c, 0x2f90, 0x2f94, 0x2f98, 0x2f9c, 0x2fa0,
+	0x2fa4, 0x2fa8, 0x2fac, 0x2fb0, 0x2fb4, 0x2fb8, 0x2fbc, 0x2fc0,
+	0x2fc4, 0x2fc8, 0x2fcc, 0x2fd0, 0x2fd4, 0x2fd8, 0x2fdc, 0x2fe0,
+	0x2fe4, 0x2fe8, 0x2fec, 0x2ff0, 0x2ff4, 0x2ff8, 0x2ffc, 0x3000,
+	0x3004, 0x3008, 0x300c, 0x3010, 0x3014, 0x3018, 0x301c, 0x3020,
+	0x3024, 0x3028, 0x302c, 0x3030, 0x3034, 0x3038, 0x303c, 0x3040,
+	0x3044, 0x3048, 0x304c, 0x3050, 0x3054, 0x3058, 0x305c, 0x3060,
+	0x3064, 0x3068, 0x306c, 0x3070, 0x3074, 0x3078, 0x307c, 0x3080,
+	0x3084, 0x3088, 0x308c, 0x3090, 0x3094, 0x3098, 0x309c, 0x30a0,
+	0x30a4, 0x30a8, 0x30ac, 0x30b0, 0x30b4, 0x30b8, 0x30bc, 0x30c0,
+	0x30c4, 0x30c8, 0x30cc, 0x30d0, 0x30d4, 0x30d8, 0x30dc, 0x30e0,
+	0x30e4, 0x30e8, 0x30ec, 0x30f0, 0x30f4, 0x30f8, 0x30fc, 0x3100,
+	0x3104, 0x3108, 0x310c, 0x3110, 0x3114, 0x3118, 0x311c, 0x3120,
+	0x3124, 0x3128, 0x312c, 0x3130, 0x3134, 0x3138, 0x313c, 0x3140,
+	0x3144, 0x3148, 0x314c, 0x3150, 0x3154, 0x3158, 0x315c, 0x3160,
+	0x3164, 0x3168, 0x316c, 0x3170, 0x3174, 0x3178, 0x317c, 0x3180,
+	0x3184, 0x3188, 0x318c, 0x3190, 0x3194, 0x3198, 0x319c, 0x31a0,
+	0x31a4, 0x31a8, 0x31ac, 0x31b0, 0x31b4, 0x31b8, 0x31bc, 0x31c0,
+	0x31c4, 0x31c8, 0x31cc, 0x31d0, 0x31d4, 0x31d8, 0x31dc, 0x31e0,
+	0x31e4, 0x31e8, 0x31ec, 0x31f0, 0x31f4, 0x31f8, 0x31fc, 0x3200,
+	0x3204, 0x3208, 0x320c, 0x3210, 0x3214, 0x3218, 0x321c, 0x3220,
+	0x3224, 0x3228, 0x322c, 0x3230, 0x3234, 0x3238, 0x323c, 0x3240,
+	0x3244, 0x3248, 0x324c, 0x3250, 0x3254, 0x3258, 0x325c, 0x3260,
+	0x3264, 0x3268, 0x326c, 0x3270, 0x3274, 0x3278, 0x327c, 0x3280,
+	0x3284, 0x3288, 0x328c, 0x3290, 0x3294, 0x3298, 0x329c, 0x32a0,
+	0x32a4, 0x32a8, 0x32ac, 0x32b0, 0x32b4, 0x32b8, 0x32bc, 0x32c0,
+	0x32c4, 0x32c8, 0x32cc, 0x32d0, 0x32d4, 0x32d8, 0x32dc, 0x32e0,
+	0x32e4, 0x32e8, 0x32ec, 0x32f0, 0x32f4, 0x32f8, 0x32fc, 0x3300,
+	0x3304, 0x3308, 0x330c, 0x3310, 0x3314, 0x3318, 0x331c, 0x3320,
+	0x3324, 0x3328, 0x332c, 0x3330, 0x3334, 0x3338, 0x333c, 0x3340,
+	0x3344, 0x3348, 0x334c, 0x3350, 0x3354, 0x3358, 0x335c, 0x3360,
+	0x3364, 0x3368, 0x336c, 0x3370, 0x3374, 0x3378, 0x337c, 0x3380,
+	0x3384, 0x3388, 0x338c, 0x3390, 0x3394, 0x3398, 0x339c, 0x33a0,
+	0x33a4, 0x33a8, 0x33ac, 0x33b0, 0x33b4, 0x33b8, 0x33bc, 0x33c0,
+	0x33c4, 0x33c8, 0x33cc, 0x33d0, 0x33d4, 0x33d8, 0x33dc, 0x33e0,
+	0x33e4, 0x33e8, 0x33ec, 0x33f0, 0x33f4, 0x33f8, 0x33fc, 0x3400,
+	0x3404, 0x3408, 0x340c, 0x3410, 0x3414, 0x3418, 0x341c, 0x3420,
+	0x3424, 0x3428, 0x342c, 0x3430, 0x3434, 0x3438, 0x343c, 0x3440,
+	0x3444, 0x3448, 0x344c, 0x3450, 0x3454, 0x3458, 0x345c, 0x3460,
+	0x3464, 0x3468, 0x346c, 0x3470, 0x3474, 0x3478, 0x347c, 0x3480,
+	0x3484, 0x3488, 0x348c, 0x3490, 0x3494, 0x3498, 0x349c, 0x34a0,
+	0x34a4, 0x34a8, 0x34ac, 0x34b0, 0x34b4, 0x34b8, 0x34bc, 0x34c0,
+	0x34c4, 0x34c8, 0x34cc, 0x34d0, 0x34d4, 0x34d8, 0x34dc, 0x34e0,
+	0x34e4, 0x34e8, 0x34ec, 0x34f0, 0x34f4, 0x34f8, 0x34fc, 0x3500,
+	0x3504, 0x3508, 0x350c, 0x3510, 0x3514, 0x3518, 0x351c, 0x3520,
+	0x3524, 0x3528, 0x352c, 0x3530, 0x3534,
+};
+
+static const uint32_t str_nfd_data[3406] = {
+	0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+	0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+	0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+	0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+	0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+	0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+	0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+	0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+	0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+	0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+	0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+	0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+	0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+	0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+	0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+	0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+	0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+	0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+	0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+	0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+	0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+	0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+	0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+	0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+	0x00069, 0x00328, 0x00049, 0x00307, 0x0004A, 0x00302, 0x0006A, 0x00302,
+	0x0004B, 0x00327, 0x0006B, 0x00327, 0x0004C, 0x00301, 0x0006C, 0x00301,
+	0x0004C, 0x00327, 0x0006C, 0x00327, 0x0004C, 0x0030C, 0x0006C, 0x0030C,
+	0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+	0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x0004F, 0x00304, 0x0006F, 0x00304,
+	0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B, 0x0006F, 0x0030B,
+	0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+	0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301, 0x00073, 0x00301,
+	0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+	0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327, 0x00074, 0x00327,
+	0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303, 0x00075, 0x00303,
+	0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+	0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B, 0x00075, 0x0030B,
+	0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+	0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005A, 0x00301,
+	0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307, 0x0005A, 0x0030C,
+	0x0007A, 0x0030C, 0x0004F, 0x0031B, 0x0006F, 0x0031B, 0x00055, 0x0031B,
+	0x00075, 0x0031B, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+	0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+	0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+	0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+	0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+	0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+	0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+	0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+	0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+	0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+	0x0006A, 0x0030C, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300,
+	0x0006E, 0x00300, 0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301,
+	0x000C6, 0x00301, 0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301,
+	0x00041, 0x0030F, 0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311,
+	0x00045, 0x0030F, 0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311,
+	0x00049, 0x0030F, 0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311,
+	0x0004F, 0x0030F, 0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311,
+	0x00052, 0x0030F, 0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311,
+	0x00055, 0x0030F, 0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311,
+	0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+	0x00048, 0x0030C, 0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307,
+	0x00045, 0x00327, 0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F,
+	0x00308, 0x00304, 0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304,
+	0x0004F, 0x00307, 0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F,
+	0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+	0x00313, 0x00308, 0x00301, 0x002B9, 0x0003B, 0x000A8, 0x00301, 0x00391,
+	0x00301, 0x000B7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+	0x0039F, 0x00301, 0x003A5, 0x00301, 0x003A9, 0x00301, 0x003B9, 0x00308,
+	0x00301, 0x00399, 0x00308, 0x003A5, 0x00308, 0x003B1, 0x00301, 0x003B5,
+	0x00301, 0x003B7, 0x00301, 0x003B9, 0x00301, 0x003C5, 0x00308, 0x00301,
+	0x003B9, 0x00308, 0x003C5, 0x00308, 0x003BF, 0x00301, 0x003C5, 0x00301,
+	0x003C9, 0x00301, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x00415, 0x00300,
+	0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301,
+	0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+	0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+	0x0043A, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F,
+	0x00475, 0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+	0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+	0x00435, 0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308,
+	0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+	0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308,
+	0x0043E, 0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308,
+	0x0044D, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+	0x00443, 0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308,
+	0x00447, 0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00627, 0x00653,
+	0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A, 0x00654,
+	0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928, 0x0093C,
+	0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916, 0x0093C,
+	0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922, 0x0093C,
+	0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7, 0x009D7,
+	0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32, 0x00A3C,
+	0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C, 0x00A3C,
+	0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47, 0x00B57,
+	0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6, 0x00BBE,
+	0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF, 0x00CD5,
+	0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6, 0x00CC2,
+	0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57, 0x00DD9,
+	0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9, 0x00DDF,
+	0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7, 0x00F56, 0x00FB7,
+	0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72, 0x00F71, 0x00F74,
+	0x00FB2, 0x00F80, 0x00FB3, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+	0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+	0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x01B05, 0x01B35, 0x01B07, 0x01B35,
+	0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11, 0x01B35,
+	0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F, 0x01B35,
+	0x01B42, 0x01B35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+	0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+	0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+	0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+	0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+	0x00044, 0x0032D, 0x00064, 0x0032D, 0x00045, 0x00304, 0x00300, 0x00065,
+	0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+	0x00045, 0x0032D, 0x00065, 0x0032D, 0x00045, 0x00330, 0x00065, 0x00330,
+	0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+	0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+	0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+	0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032E,
+	0x00068, 0x0032E, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+	0x00301, 0x00069, 0x00308, 0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301,
+	0x0004B, 0x00323, 0x0006B, 0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331,
+	0x0004C, 0x00323, 0x0006C, 0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C,
+	0x00323, 0x00304, 0x0004C, 0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D,
+	0x0006C, 0x0032D, 0x0004D, 0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307,
+	0x0006D, 0x00307, 0x0004D, 0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307,
+	0x0006E, 0x00307, 0x0004E, 0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331,
+	0x0006E, 0x00331, 0x0004E, 0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303,
+	0x00301, 0x0006F, 0x00303, 0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F,
+	0x00303, 0x00308, 0x0004F, 0x00304, 0x00300, 0x0006F, 0x00304, 0x00300,
+	0x0004F, 0x00304, 0x00301, 0x0006F, 0x00304, 0x00301, 0x00050, 0x00301,
+	0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+	0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+	0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+	0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+	0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030C,
+	0x00307, 0x00073, 0x0030C, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+	0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+	0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032D,
+	0x00074, 0x0032D, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+	0x00075, 0x00330, 0x00055, 0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303,
+	0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+	0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+	0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+	0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+	0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+	0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+	0x00079, 0x00307, 0x0005A, 0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323,
+	0x0007A, 0x00323, 0x0005A, 0x00331, 0x0007A, 0x00331, 0x00068, 0x00331,
+	0x00074, 0x00308, 0x00077, 0x0030A, 0x00079, 0x0030A, 0x0017F, 0x00307,
+	0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+	0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+	0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+	0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+	0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+	0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+	0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+	0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+	0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+	0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+	0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+	0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+	0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+	0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+	0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323,
+	0x0006F, 0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302,
+	0x00301, 0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F,
+	0x00302, 0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309,
+	0x0004F, 0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323,
+	0x00302, 0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F,
+	0x0031B, 0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300,
+	0x0004F, 0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B,
+	0x00303, 0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F,
+	0x0031B, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+	0x00075, 0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301,
+	0x00055, 0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B,
+	0x00309, 0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075,
+	0x0031B, 0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323,
+	0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+	0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+	0x003B1, 0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1,
+	0x00314, 0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301,
+	0x003B1, 0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313,
+	0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+	0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+	0x00342, 0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314,
+	0x003B5, 0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313,
+	0x00301, 0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+	0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+	0x00301, 0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314,
+	0x003B7, 0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313,
+	0x00301, 0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7,
+	0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+	0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+	0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+	0x003B9, 0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9,
+	0x00314, 0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301,
+	0x003B9, 0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313,
+	0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+	0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+	0x00342, 0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314,
+	0x003BF, 0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313,
+	0x00301, 0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314,
+	0x0039F, 0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313,
+	0x00301, 0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314,
+	0x003C5, 0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313,
+	0x00301, 0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5,
+	0x00314, 0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5,
+	0x00314, 0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9,
+	0x00314, 0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9,
+	0x00313, 0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342,
+	0x003C9, 0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9,
+	0x00313, 0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301,
+	0x003A9, 0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314,
+	0x00342, 0x003B1, 0x00300, 0x003B1, 0x00301, 0x003B5, 0x00300, 0x003B5,
+	0x00301, 0x003B7, 0x00300, 0x003B7, 0x00301, 0x003B9, 0x00300, 0x003B9,
+	0x00301, 0x003BF, 0x00300, 0x003BF, 0x00301, 0x003C5, 0x00300, 0x003C5,
+	0x00301, 0x003C9, 0x00300, 0x003C9, 0x00301, 0x003B1, 0x00313, 0x00345,
+	0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300, 0x00345, 0x003B1,
+	0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345, 0x003B1,
+	0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345, 0x003B1,
+	0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391, 0x00314,
+	0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314, 0x00300,
+	0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314, 0x00301,
+	0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314, 0x00342,
+	0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345, 0x003B7,
+	0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345, 0x003B7,
+	0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301, 0x00345, 0x003B7,
+	0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345, 0x00397,
+	0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300,
+	0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313, 0x00301,
+	0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342,
+	0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313, 0x00345,
+	0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300, 0x00345, 0x003C9,
+	0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345, 0x003C9,
+	0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345, 0x003C9,
+	0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345, 0x003A9, 0x00314,
+	0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314, 0x00300,
+	0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314, 0x00301,
+	0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9, 0x00314, 0x00342,
+	0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300, 0x00345,
+	0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342, 0x003B1,
+	0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391, 0x00300,
+	0x00391, 0x00301, 0x00391, 0x00345, 0x003B9, 0x000A8, 0x00342, 0x003B7,
+	0x00300, 0x00345, 0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7,
+	0x00342, 0x003B7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00395, 0x00301,
+	0x00397, 0x00300, 0x00397, 0x00301, 0x00397, 0x00345, 0x01FBF, 0x00300,
+	0x01FBF, 0x00301, 0x01FBF, 0x00342, 0x003B9, 0x00306, 0x003B9, 0x00304,
+	0x003B9, 0x00308, 0x00300, 0x003B9, 0x00308, 0x00301, 0x003B9, 0x00342,
+	0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+	0x00300, 0x00399, 0x00301, 0x01FFE, 0x00300, 0x01FFE, 0x00301, 0x01FFE,
+	0x00342, 0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300,
+	0x003C5, 0x00308, 0x00301, 0x003C1, 0x00313, 0x003C1, 0x00314, 0x003C5,
+	0x00342, 0x003C5, 0x00308, 0x00342, 0x003A5, 0x00306, 0x003A5, 0x00304,
+	0x003A5, 0x00300, 0x003A5, 0x00301, 0x003A1, 0x00314, 0x000A8, 0x00300,
+	0x000A8, 0x00301, 0x00060, 0x003C9, 0x00300, 0x00345, 0x003C9, 0x00345,
+	0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342, 0x003C9, 0x00342, 0x00345,
+	0x0039F, 0x00300, 0x0039F, 0x00301, 0x003A9, 0x00300, 0x003A9, 0x00301,
+	0x003A9, 0x00345, 0x000B4, 0x02002, 0x02003, 0x003A9, 0x0004B, 0x00041,
+	0x0030A, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021D0,
+	0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203, 0x00338, 0x02208,
+	0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225, 0x00338, 0x0223C,
+	0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003D,
+	0x00338, 0x02261, 0x00338, 0x0224D, 0x00338, 0x0003C, 0x00338, 0x0003E,
+	0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273,
+	0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227A, 0x00338, 0x0227B,
+	0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286, 0x00338, 0x02287,
+	0x00338, 0x022A2, 0x00338, 0x022A8, 0x00338, 0x022A9, 0x00338, 0x022AB,
+	0x00338, 0x0227C, 0x00338, 0x0227D, 0x00338, 0x02291, 0x00338, 0x02292,
+	0x00338, 0x022B2, 0x00338, 0x022B3, 0x00338, 0x022B4, 0x00338, 0x022B5,
+	0x00338, 0x03008, 0x03009, 0x02ADD, 0x00338, 0x0304B, 0x03099, 0x0304D,
+	0x03099, 0x0304F, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055,
+	0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D,
+	0x03099, 0x0305F, 0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066,
+	0x03099, 0x03068, 0x03099, 0x0306F, 0x03099, 0x0306F, 0x0309A, 0x03072,
+	0x03099, 0x03072, 0x0309A, 0x03075, 0x03099, 0x03075, 0x0309A, 0x03078,
+	0x03099, 0x03078, 0x0309A, 0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046,
+	0x03099, 0x0309D, 0x03099, 0x030AB, 0x03099, 0x030AD, 0x03099, 0x030AF,
+	0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099, 0x030B5, 0x03099, 0x030B7,
+	0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099, 0x030BD, 0x03099, 0x030BF,
+	0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099, 0x030C6, 0x03099, 0x030C8,
+	0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A, 0x030D2, 0x03099, 0x030D2,
+	0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A, 0x030D8, 0x03099, 0x030D8,
+	0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A, 0x030A6, 0x03099, 0x030EF,
+	0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099, 0x030F2, 0x03099, 0x030FD,
+	0x03099, 0x08C48, 0x066F4, 0x08ECA, 0x08CC8, 0x06ED1, 0x04E32, 0x053E5,
+	0x09F9C, 0x09F9C, 0x05951, 0x091D1, 0x05587, 0x05948, 0x061F6, 0x07669,
+	0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B, 0x070D9,
+	0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04, 0x0721B,
+	0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9, 0x081D8,
+	0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86, 0x051B7,
+	0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08001, 0x08606, 0x0865C,
+	0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9,
+	0x09304, 0x09E7F, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262,
+	0x078CA, 0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F,
+	0x07D2F, 0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C,
+	0x07DBE, 0x083F1, 0x09675, 0x08B80, 0x062CF, 0x06A02, 0x08AFE, 0x04E39,
+	0x05BE7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9,
+	0x04E0D, 0x06CCC, 0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449,
+	0x08AAA, 0x06BBA, 0x08FB0, 0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565,
+	0x04EAE, 0x05169, 0x051C9, 0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF,
+	0x052F5, 0x05442, 0x05973, 0x05EEC, 0x065C5, 0x06FFE, 0x0792A, 0x095AD,
+	0x09A6A, 0x09E97, 0x09ECE, 0x0529B, 0x066C6, 0x06B77, 0x08F62, 0x05E74,
+	0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149, 0x07489, 0x079CA, 0x07DF4,
+	0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A, 0x05217, 0x052A3, 0x054BD,
+	0x070C8, 0x088C2, 0x08AAA, 0x05EC9, 0x05FF5, 0x0637B, 0x06BAE, 0x07C3E,
+	0x07375, 0x04EE4, 0x056F9, 0x05BE7, 0x05DBA, 0x0601C, 0x073B2, 0x07469,
+	0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B, 0x079AE,
+	0x091B4, 0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F, 0x06599,
+	0x06A02, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x09F8D, 0x06688, 0x0962E,
+	0x05289, 0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B,
+	0x07D10, 0x0985E, 0x0516D, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA,
+	0x08F2A, 0x05F8B, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540F,
+	0x05C65, 0x06613, 0x0674E, 0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79,
+	0x088CF, 0x088E1, 0x091CC, 0x096E2, 0x0533F, 0x06EBA, 0x0541D, 0x071D0,
+	0x07498, 0x085FA, 0x096A3, 0x09C57, 0x09E9F, 0x06797, 0x06DCB, 0x081E8,
+	0x07ACB, 0x07B20, 0x07C92, 0x072C0, 0x07099, 0x08B58, 0x04EC0, 0x08336,
+	0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6, 0x05B85, 0x06D1E, 0x066B4,
+	0x08F3B, 0x0884C, 0x0964D, 0x0898B, 0x05ED3, 0x05140, 0x055C0, 0x0585A,
+	0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965, 0x0798F,
+	0x09756, 0x07CBE, 0x07FBD, 0x08612, 0x08AF8, 0x09038, 0x090FD, 0x098EF,
+	0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7, 0x0514D,
+	0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8,
+	0x05C64, 0x05C6E, 0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2,
+	0x06691, 0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422,
+	0x07891, 0x0793E, 0x07949, 0x07948, 0x07950, 0x07956, 0x0795D, 0x0798D,
+	0x0798E, 0x07A40, 0x07A81, 0x07BC0, 0x07DF4, 0x07E09, 0x07E41, 0x07F72,
+	0x08005, 0x081ED, 0x08279, 0x08279, 0x08457, 0x08910, 0x08996, 0x08B01,
+	0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x09038, 0x096E3, 0x097FF, 0x0983B,
+	0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168, 0x04F80, 0x05145,
+	0x05180, 0x052C7, 0x052FA, 0x0559D, 0x05555, 0x05599, 0x055E2, 0x0585A,
+	0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69,
+	0x05FAD, 0x060D8, 0x0614E, 0x06108, 0x0618E, 0x06160, 0x061F2, 0x06234,
+	0x063C4, 0x0641C, 0x06452, 0x06556, 0x06674, 0x06717, 0x0671B, 0x06756,
+	0x06B79, 0x06BBA, 0x06D41, 0x06EDB, 0x06ECB, 0x06F22, 0x0701E, 0x0716E,
+	0x077A7, 0x07235, 0x072AF, 0x0732A, 0x07471, 0x07506, 0x0753B, 0x0761D,
+	0x0761F, 0x076CA, 0x076DB, 0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1,
+	0x07BC0, 0x07C7B, 0x07D5B, 0x07DF4, 0x07F3E, 0x08005, 0x08352, 0x083EF,
+	0x08779, 0x08941, 0x08986, 0x08996, 0x08ABF, 0x08AF8, 0x08ACB, 0x08B01,
+	0x08AFE, 0x08AED, 0x08B39, 0x08B8A, 0x08D08, 0x08F38, 0x09072, 0x09199,
+	0x09276, 0x0967C, 0x096E3, 0x09756, 0x097DB, 0x097FF, 0x0980B, 0x0983B,
+	0x09B12, 0x09F9C, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039,
+	0x25249, 0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x005D9, 0x005B4, 0x005F2,
+	0x005B7, 0x005E9, 0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1,
+	0x005E9, 0x005BC, 0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0,
+	0x005BC, 0x005D1, 0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4,
+	0x005BC, 0x005D5, 0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9,
+	0x005BC, 0x005DA, 0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE,
+	0x005BC, 0x005E0, 0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4,
+	0x005BC, 0x005E6, 0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9,
+	0x005BC, 0x005EA, 0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB,
+	0x005BF, 0x005E4, 0x005BF, 0x11099, 0x110BA, 0x1109B, 0x110BA, 0x110A5,
+	0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133E, 0x11347,
+	0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9, 0x114BD, 0x115B8,
+	0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157, 0x1D165, 0x1D158,
+	0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165, 0x1D16F, 0x1D158,
+	0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158, 0x1D165, 0x1D172,
+	0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165, 0x1D16E, 0x1D1BA,
+	0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA, 0x1D165, 0x1D16F,
+	0x04E3D, 0x04E38, 0x04E41, 0x20122, 0x04F60, 0x04FAE, 0x04FBB, 0x05002,
+	0x0507A, 0x05099, 0x050E7, 0x050CF, 0x0349E, 0x2063A, 0x0514D, 0x05154,
+	0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x0518D, 0x2054B, 0x05197,
+	0x051A4, 0x04ECC, 0x051AC, 0x051B5, 0x291DF, 0x051F5, 0x05203, 0x034DF,
+	0x0523B, 0x05246, 0x05272, 0x05277, 0x03515, 0x052C7, 0x052C9, 0x052E4,
+	0x052FA, 0x05305, 0x05306, 0x05317, 0x05349, 0x05351, 0x0535A, 0x05373,
+	0x0537D, 0x0537F, 0x0537F, 0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF,
+	0x20B63, 0x053EB, 0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468,
+	0x054A2, 0x054F6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599,
+	0x055AB, 0x055B3, 0x055C2, 0x05716, 0x05606, 0x05717, 0x05651, 0x05674,
+	0x05207, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B, 0x05832, 0x05831,
+	0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x0591A, 0x05922, 0x05962,
+	0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66, 0x036EE,
+	0x036FC, 0x05B08, 0x05B3E, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BE7,
+	0x05BF3, 0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x05C22, 0x03781, 0x05C60,
+	0x05C6E, 0x05CC0, 0x05C8D, 0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B,
+	0x05D7C, 0x05DE1, 0x05DE2, 0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69,
+	0x03862, 0x22183, 0x0387C, 0x05EB0, 0x05EB3, 0x05EB6, 0x05ECA, 0x2A392,
+	0x05EFE, 0x22331, 0x22331, 0x08201, 0x05F22, 0x05F22, 0x038C7, 0x232B8,
+	0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7, 0x05FF9,
+	0x06081, 0x0393A, 0x0391C, 0x06094, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+	0x0614E, 0x0614C, 0x0617A, 0x0618E, 0x061B2, 0x061A4, 0x061AF, 0x061DE,
+	0x061F2, 0x061F6, 0x06210, 0x0621B, 0x0625D, 0x062B1, 0x062D4, 0x06350,
+	0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383, 0x063E4, 0x22BF1, 0x06422,
+	0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E, 0x0649D, 0x06477, 0x03A6C,
+	0x0654F, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649, 0x03B19, 0x06691,
+	0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD, 0x043D9,
+	0x06717, 0x0671B, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA,
+	0x06785, 0x06852, 0x06885, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x03B9D,
+	0x06942, 0x069A3, 0x069EA, 0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21,
+	0x238A7, 0x06B54, 0x03C4E, 0x06B72, 0x06B9F, 0x06BBA, 0x06BBB, 0x23A8D,
+	0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC, 0x06CBF, 0x06CCD, 0x06C67, 0x06D16,
+	0x06D3E, 0x06D77, 0x06D41, 0x06D69, 0x06D78, 0x06D85, 0x23D1E, 0x06D34,
+	0x06E2F, 0x06E6E, 0x03D33, 0x06ECB, 0x06EC7, 0x23ED1, 0x06DF9, 0x06F6E,
+	0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701E, 0x0701B, 0x03D96, 0x0704A,
+	0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+	0x07228, 0x07235, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814,
+	0x0737A, 0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x03EB8, 0x07447, 0x0745C,
+	0x07471, 0x07485, 0x074CA, 0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92,
+	0x07570, 0x2219F, 0x07610, 0x24FA1, 0x24FB8, 0x25044, 0x03FFC, 0x04008,
+	0x076F4, 0x250F3, 0x250F2, 0x25119, 0x25133, 0x0771E, 0x0771F, 0x0771F,
+	0x0774A, 0x04039, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x0788C,
+	0x078CC, 0x040E3, 0x25626, 0x07956, 0x2569A, 0x256C5, 0x0798F, 0x079EB,
+	0x0412F, 0x07A40, 0x07A4A, 0x07A4F, 0x2597C, 0x25AA7, 0x25AA7, 0x07AEE,
+	0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80, 0x07CD2, 0x042A0,
+	0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301, 0x07DC7, 0x07E02,
+	0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9, 0x07F7A, 0x2633E,
+	0x07F95, 0x07FFA, 0x08005, 0x264DA, 0x26523, 0x08060, 0x265A8, 0x08070,
+	0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5, 0x267A7,
+	0x267B5, 0x23393, 0x2339C, 0x08201, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+	0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+	0x082E5, 0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08457,
+	0x08353, 0x083CA, 0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B,
+	0x084F1, 0x084F3, 0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561,
+	0x26FB1, 0x270D2, 0x0456B, 0x08650, 0x0865C, 0x08667, 0x08669, 0x086A9,
+	0x08688, 0x0870E, 0x086E2, 0x08779, 0x08728, 0x0876B, 0x08786, 0x045D7,
+	0x087E1, 0x08801, 0x045F9, 0x08860, 0x08863, 0x27667, 0x088D7, 0x088DE,
+	0x04635, 0x088FA, 0x034BB, 0x278AE, 0x27966, 0x046BE, 0x046C7, 0x08AA0,
+	0x08AED, 0x08B8A, 0x08C55, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77,
+	0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x08F38,
+	0x285D2, 0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238,
+	0x092D7, 0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995,
+	0x095B7, 0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A,
+	0x04A6E, 0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x0980B, 0x0980B,
+	0x09829, 0x295B6, 0x098E2, 0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE,
+	0x04BCE, 0x29B30, 0x09B12, 0x09C40, 0x09CFD, 0x04CCE, 0x04CED, 0x09D67,
+	0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E, 0x2A291, 0x09EBB, 0x04D56, 0x09EF9,
+	0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x09F3B, 0x2A600,
+};
+
+/* Primary composites as { first, second, composite }, sorted. */
+static const uint32_t str_nfc_pairs[941][3] = {
+	{ 0x0003C, 0x00338, 0x0226E }, { 0x0003D, 0x00338, 0x02260 }, { 0x0003E, 0x00338, 0x0226F },
+	{ 0x00041, 0x00300, 0x000C0 }, { 0x00041, 0x00301, 0x000C1 }, { 0x00041, 0x00302, 0x000C2 },
+	{ 0x00041, 0x00303, 0x000C3 }, { 0x00041, 0x00304, 0x00100 }, { 0x00041, 0x00306, 0x00102 },
+	{ 0x00041, 0x00307, 0x00226 }, { 0x00041, 0x00308, 0x000C4 }, { 0x00041, 0x00309, 0x01EA2 },
+	{ 0x00041, 0x0030A, 0x000C5 }, { 0x00041, 0x0030C, 0x001CD }, { 0x00041, 0x0030F, 0x00200 },
+	{ 0x00041, 0x00311, 0x00202 }, { 0x00041, 0x00323, 0x01EA0 }, { 0x00041, 0x00325, 0x01E00 },
+	{ 0x00041, 0x00328, 0x00104 }, { 0x00042, 0x00307, 0x01E02 }, { 0x00042, 0x00323, 0x01E04 },
+	{ 0x00042, 0x00331, 0x01E06 }, { 0x00043, 0x00301, 0x00106 }, { 0x00043, 0x00302, 0x00108 },
+	{ 0x00043, 0x00307, 0x0010A }, { 0x00043, 0x0030C, 0x0010C }, { 0x00043, 0x00327, 0x000C7 },
+	{ 0x00044, 0x00307, 0x01E0A }, { 0x00044, 0x0030C, 0x0010E }, { 0x00044, 0x00323, 0x01E0C },
+	{ 0x00044, 0x00327, 0x01E10 }, { 0x00044, 0x0032D, 0x01E12 }, { 0x00044, 0x00331, 0x01E0E },
+	{ 0x00045, 0x00300, 0x000C8 }, { 0x00045, 0x00301, 0x000C9 }, { 0x00045, 0x00302, 0x000CA },
+	{ 0x00045, 0x00303, 0x01EBC }, { 0x00045, 0x00304, 0x00112 }, { 0x00045, 0x00306, 0x00114 },
+	{ 0x00045, 0x00307, 0x00116 }, { 0x00045, 0x00308, 0x000CB }, { 0x00045, 0x00309, 0x01EBA },
+	{ 0x00045, 0x0030C, 0x0011A }, { 0x00045, 0x0030F, 0x00204 }, { 0x00045, 0x00311, 0x00206 },
+	{ 0x00045, 0x00323, 0x01EB8 }, { 0x00045, 0x00327, 0x00228 }, { 0x00045, 0x00328, 0x00118 },
+	{ 0x00045, 0x0032D, 0x01E18 }, { 0x00045, 0x00330, 0x01E1A }, { 0x00046, 0x00307, 0x01E1E },
+	{ 0x00047, 0x00301, 0x001F4 }, { 0x00047, 0x00302, 0x0011C }, { 0x00047, 0x00304, 0x01E20 },
+	{ 0x00047, 0x00306, 0x0011E }, { 0x00047, 0x00307, 0x00120 }, { 0x00047, 0x0030C, 0x001E6 },
+	{ 0x00047, 0x00327, 0x00122 }, { 0x00048, 0x00302, 0x00124 }, { 0x00048, 0x00307, 0x01E22 },
+	{ 0x00048, 0x00308, 0x01E26 }, { 0x00048, 0x0030C, 0x0021E }, { 0x00048, 0x00323, 0x01E24 },
+	{ 0x00048, 0x00327, 0x01E28 }, { 0x00048, 0x0032E, 0x01E2A }, { 0x00049, 0x00300, 0x000CC },
+	{ 0x00049, 0x00301, 0x000CD }, { 0x00049, 0x00302, 0x000CE }, { 0x00049, 0x00303, 0x00128 },
+	{ 0x00049, 0x00304, 0x0012A }, { 0x00049, 0x00306, 0x0012C }, { 0x00049, 0x00307, 0x00130 },
+	{ 0x00049, 0x00308, 0x000CF }, { 0x00049, 0x00309, 0x01EC8 }, { 0x00049, 0x0030C, 0x001CF },
+	{ 0x00049, 0x0030F, 0x00208 }, { 0x00049, 0x00311, 0x0020A }, { 0x00049, 0x00323, 0x01ECA },
+	{ 0x00049, 0x00328, 0x0012E }, { 0x00049, 0x00330, 0x01E2C }, { 0x0004A, 0x00302, 0x00134 },
+	{ 0x0004B, 0x00301, 0x01E30 }, { 0x0004B, 0x0030C, 0x001E8 }, { 0x0004B, 0x00323, 0x01E32 },
+	{ 0x0004B, 0x00327, 0x00136 }, { 0x0004B, 0x00331, 0x01E34 }, { 0x0004C, 0x00301, 0x00139 },
+	{ 0x0004C, 0x0030C, 0x0013D }, { 0x0004C, 0x00323, 0x01E36 }, { 0x0004C, 0x00327, 0x0013B },
+	{ 0x0004C, 0x0032D, 0x01E3C }, { 0x0004C, 0x00331, 0x01E3A }, { 0x0004D, 0x00301, 0x01E3E },
+	{ 0x0004D, 0x00307, 0x01E40 }, { 0x0004D, 0x00323, 0x01E42 }, { 0x0004E, 0x00300, 0x001F8 },
+	{ 0x0004E, 0x00301, 0x00143 }, { 0x0004E, 0x00303, 0x000D1 }, { 0x0004E, 0x00307, 0x01E44 },
+	{ 0x0004E, 0x0030C, 0x00147 }, { 0x0004E, 0x00323, 0x01E46 }, { 0x0004E, 0x00327, 0x00145 },
+	{ 0x0004E, 0x0032D, 0x01E4A }, { 0x0004E, 0x00331, 0x01E48 }, { 0x0004F, 0x00300, 0x000D2 },
+	{ 0x0004F, 0x00301, 0x000D3 }, { 0x0004F, 0x00302, 0x000D4 }, { 0x0004F, 0x00303, 0x000D5 },
+	{ 0x0004F, 0x00304, 0x0014C }, { 0x0004F, 0x00306, 0x0014E }, { 0x0004F, 0x00307, 0x0022E },
+	{ 0x0004F, 0x00308, 0x000D6 }, { 0x0004F, 0x00309, 0x01ECE }, { 0x0004F, 0x0030B, 0x00150 },
+	{ 0x0004F, 0x0030C, 0x001D1 }, { 0x0004F, 0x0030F, 0x0020C }, { 0x0004F, 0x00311, 0x0020E },
+	{ 0x0004F, 0x0031B, 0x001A0 }, { 0x0004F, 0x00323, 0x01ECC }, { 0x0004F, 0x00328, 0x001EA },
+	{ 0x00050, 0x00301, 0x01E54 }, { 0x00050, 0x00307, 0x01E56 }, { 0x00052, 0x00301, 0x00154 },
+	{ 0x00052, 0x00307, 0x01E58 }, { 0x00052, 0x0030C, 0x00158 }, { 0x00052, 0x0030F, 0x00210 },
+	{ 0x00052, 0x00311, 0x00212 }, { 0x00052, 0x00323, 0x01E5A }, { 0x00052, 0x00327, 0x00156 },
+	{ 0x00052, 0x00331, 0x01E5E }, { 0x00053, 0x00301, 0x0015A }, { 0x00053, 0x00302, 0x0015C },
+	{ 0x00053, 0x00307, 0x01E60 }, { 0x00053, 0x0030C, 0x00160 }, { 0x00053, 0x00323, 0x01E62 },
+	{ 0x00053, 0x00326, 0x00218 }, { 0x00053, 0x00327, 0x0015E }, { 0x00054, 0x00307, 0x01E6A },
+	{ 0x00054, 0x0030C, 0x00164 }, { 0x00054, 0x00323, 0x01E6C }, { 0x00054, 0x00326, 0x0021A },
+	{ 0x00054, 0x00327, 0x00162 }, { 0x00054, 0x0032D, 0x01E70 }, { 0x00054, 0x00331, 0x01E6E },
+	{ 0x00055, 0x00300, 0x000D9 }, { 0x00055, 0x00301, 0x000DA }, { 0x00055, 0x00302, 0x000DB },
+	{ 0x00055, 0x00303, 0x00168 }, { 0x00055, 0x00304, 0x0016A }, { 0x00055, 0x00306, 0x0016C },
+	{ 0x00055, 0x00308, 0x000DC }, { 0x00055, 0x00309, 0x01EE6 }, { 0x00055, 0x0030A, 0x0016E },
+	{ 0x00055, 0x0030B, 0x00170 }, { 0x00055, 0x0030C, 0x001D3 }, { 0x00055, 0x0030F, 0x00214 },
+	{ 0x00055, 0x00311, 0x00216 }, { 0x00055, 0x0031B, 0x001AF }, { 0x00055, 0x00323, 0x01EE4 },
+	{ 0x00055, 0x00324, 0x01E72 }, { 0x00055, 0x00328, 0x00172 }, { 0x00055, 0x0032D, 0x01E76 },
+	{ 0x00055, 0x00330, 0x01E74 }, { 0x00056, 0x00303, 0x01E7C }, { 0x00056, 0x00323, 0x01E7E },
+	{ 0x00057, 0x00300, 0x01E80 }, { 0x00057, 0x00301, 0x01E82 }, { 0x00057, 0x00302, 0x00174 },
+	{ 0x00057, 0x00307, 0x01E86 }, { 0x00057, 0x00308, 0x01E84 }, { 0x00057, 0x00323, 0x01E88 },
+	{ 0x00058, 0x00307, 0x01E8A }, { 0x00058, 0x00308, 0x01E8C }, { 0x00059, 0x00300, 0x01EF2 },
+	{ 0x00059, 0x00301, 0x000DD }, { 0x00059, 0x00302, 0x00176 }, { 0x00059, 0x00303, 0x01EF8 },
+	{ 0x00059, 0x00304, 0x00232 }, { 0x00059, 0x00307, 0x01E8E }, { 0x00059, 0x00308, 0x00178 },
+	{ 0x00059, 0x00309, 0x01EF6 }, { 0x00059, 0x00323, 0x01EF4 }, { 0x0005A, 0x00301, 0x00179 },
+	{ 0x0005A, 0x00302, 0x01E90 }, { 0x0005A, 0x00307, 0x0017B }, { 0x0005A, 0x0030C, 0x0017D },
+	{ 0x0005A, 0x00323, 0x01E92 }, { 0x0005A, 0x00331, 0x01E94 }, { 0x00061, 0x00300, 0x000E0 },
+	{ 0x00061, 0x00301, 0x000E1 }, { 0x00061, 0x00302, 0x000E2 }, { 0x00061, 0x00303, 0x000E3 },
+	{ 0x00061, 0x00304, 0x00101 }, { 0x00061, 0x00306, 0x00103 }, { 0x00061, 0x00307, 0x00227 },
+	{ 0x00061, 0x00308, 0x000E4 }, { 0x00061, 0x00309, 0x01EA3 }, { 0x00061, 0x0030A, 0x000E5 },
+	{ 0x00061, 0x0030C, 0x001CE }, { 0x00061, 0x0030F, 0x00201 }, { 0x00061, 0x00311, 0x00203 },
+	{ 0x00061, 0x00323, 0x01EA1 }, { 0x00061, 0x00325, 0x01E01 }, { 0x00061, 0x00328, 0x00105 },
+	{ 0x00062, 0x00307, 0x01E03 }, { 0x00062, 0x00323, 0x01E05 }, { 0x00062, 0x00331, 0x01E07 },
+	{ 0x00063, 0x00301, 0x00107 }, { 0x00063, 0x00302, 0x00109 }, { 0x00063, 0x00307, 0x0010B },
+	{ 0x00063, 0x0030C, 0x0010D }, { 0x00063, 0x00327, 0x000E7 }, { 0x00064, 0x00307, 0x01E0B },
+	{ 0x00064, 0x0030C, 0x0010F }, { 0x00064, 0x00323, 0x01E0D }, { 0x00064, 0x00327, 0x01E11 },
+	{ 0x00064, 0x0032D, 0x01E13 }, { 0x00064, 0x00331, 0x01E0F }, { 0x00065, 0x00300, 0x000E8 },
+	{ 0x00065, 0x00301, 0x000E9 }, { 0x00065, 0x00302, 0x000EA }, { 0x00065, 0x00303, 0x01EBD },
+	{ 0x00065, 0x00304, 0x00113 }, { 0x00065, 0x00306, 0x00115 }, { 0x00065, 0x00307, 0x00117 },
+	{ 0x00065, 0x00308, 0x000EB }, { 0x00065, 0x00309, 0x01EBB }, { 0x00065, 0x0030C, 0x0011B },
+	{ 0x00065, 0x0030F, 0x00205 }, { 0x00065, 0x00311, 0x00207 }, { 0x00065, 0x00323, 0x01EB9 },
+	{ 0x00065, 0x00327, 0x00229 }, { 0x00065, 0x00328, 0x00119 }, { 0x00065, 0x0032D, 0x01E19 },
+	{ 0x00065, 0x00330, 0x01E1B }, { 0x00066, 0x00307, 0x01E1F }, { 0x00067, 0x00301, 0x001F5 },
+	{ 0x00067, 0x00302, 0x0011D }, { 0x00067, 0x00304, 0x01E21 }, { 0x00067, 0x00306, 0x0011F },
+	{ 0x00067, 0x00307, 0x00121 }, { 0x00067, 0x0030C, 0x001E7 }, { 0x00067, 0x00327, 0x00123 },
+	{ 0x00068, 0x00302, 0x00125 }, { 0x00068, 0x00307, 0x01E23 }, { 0x00068, 0x00308, 0x01E27 },
+	{ 0x00068, 0x0030C, 0x0021F }, { 0x00068, 0x00323, 0x01E25 }, { 0x00068, 0x00327, 0x01E29 },
+	{ 0x00068, 0x0032E, 0x01E2B }, { 0x00068, 0x00331, 0x01E96 }, { 0x00069, 0x00300, 0x000EC },
+	{ 0x00069, 0x00301, 0x000ED }, { 0x00069, 0x00302, 0x000EE }, { 0x00069, 0x00303, 0x00129 },
+	{ 0x00069, 0x00304, 0x0012B }, { 0x00069, 0x00306, 0x0012D }, { 0x00069, 0x00308, 0x000EF },
+	{ 0x00069, 0x00309, 0x01EC9 }, { 0x00069, 0x0030C, 0x001D0 }, { 0x00069, 0x0030F, 0x00209 },
+	{ 0x00069, 0x00311, 0x0020B }, { 0x00069, 0x00323, 0x01ECB }, { 0x00069, 0x00328, 0x0012F },
+	{ 0x00069, 0x00330, 0x01E2D }, { 0x0006A, 0x00302, 0x00135 }, { 0x0006A, 0x0030C, 0x001F0 },
+	{ 0x0006B, 0x00301, 0x01E31 }, { 0x0006B, 0x0030C, 0x001E9 }, { 0x0006B, 0x00323, 0x01E33 },
+	{ 0x0006B, 0x00327, 0x00137 }, { 0x0006B, 0x00331, 0x01E35 }, { 0x0006C, 0x00301, 0x0013A },
+	{ 0x0006C, 0x0030C, 0x0013E }, { 0x0006C, 0x00323, 0x01E37 }, { 0x0006C, 0x00327, 0x0013C },
+	{ 0x0006C, 0x0032D, 0x01E3D }, { 0x0006C, 0x00331, 0x01E3B }, { 0x0006D, 0x00301, 0x01E3F },
+	{ 0x0006D, 0x00307, 0x01E41 }, { 0x0006D, 0x00323, 0x01E43 }, { 0x0006E, 0x00300, 0x001F9 },
+	{ 0x0006E, 0x00301, 0x00144 }, { 0x0006E, 0x00303, 0x000F1 }, { 0x0006E, 0x00307, 0x01E45 },
+	{ 0x0006E, 0x0030C, 0x00148 }, { 0x0006E, 0x00323, 0x01E47 }, { 0x0006E, 0x00327, 0x00146 },
+	{ 0x0006E, 0x0032D, 0x01E4B }, { 0x0006E, 0x00331, 0x01E49 }, { 0x0006F, 0x00300, 0x000F2 },
+	{ 0x0006F, 0x00301, 0x000F3 }, { 0x0006F, 0x00302, 0x000F4 }, { 0x0006F, 0x00303, 0x000F5 },
+	{ 0x0006F, 0x00304, 0x0014D }, { 0x0006F, 0x00306, 0x0014F }, { 0x0006F, 0x00307, 0x0022F },
+	{ 0x0006F, 0x00308, 0x000F6 }, { 0x0006F, 0x00309, 0x01ECF }, { 0x0006F, 0x0030B, 0x00151 },
+	{ 0x0006F, 0x0030C, 0x001D2 }, { 0x0006F, 0x0030F, 0x0020D }, { 0x0006F, 0x00311, 0x0020F },
+	{ 0x0006F, 0x0031B, 0x001A1 }, { 0x0006F, 0x00323, 0x01ECD }, { 0x0006F, 0x00328, 0x001EB },
+	{ 0x00070, 0x00301, 0x01E55 }, { 0x00070, 0x00307, 0x01E57 }, { 0x00072, 0x00301, 0x00155 },
+	{ 0x00072, 0x00307, 0x01E59 }, { 0x00072, 0x0030C, 0x00159 }, { 0x00072, 0x0030F, 0x00211 },
+	{ 0x00072, 0x00311, 0x00213 }, { 0x00072, 0x00323, 0x01E5B }, { 0x00072, 0x00327, 0x00157 },
+	{ 0x00072, 0x00331, 0x01E5F }, { 0x00073, 0x00301, 0x0015B }, { 0x00073, 0x00302, 0x0015D },
+	{ 0x00073, 0x00307, 0x01E61 }, { 0x00073, 0x0030C, 0x00161 }, { 0x00073, 0x00323, 0x01E63 },
+	{ 0x00073, 0x00326, 0x00219 }, { 0x00073, 0x00327, 0x0015F }, { 0x00074, 0x00307, 0x01E6B },
+	{ 0x00074, 0x00308, 0x01E97 }, { 0x00074, 0x0030C, 0x00165 }, { 0x00074, 0x00323, 0x01E6D },
+	{ 0x00074, 0x00326, 0x0021B }, { 0x00074, 0x00327, 0x00163 }, { 0x00074, 0x0032D, 0x01E71 },
+	{ 0x00074, 0x00331, 0x01E6F }, { 0x00075, 0x00300, 0x000F9 }, { 0x00075, 0x00301, 0x000FA },
+	{ 0x00075, 0x00302, 0x000FB }, { 0x00075, 0x00303, 0x00169 }, { 0x00075, 0x00304, 0x0016B },
+	{ 0x00075, 0x00306, 0x0016D }, { 0x00075, 0x00308, 0x000FC }, { 0x00075, 0x00309, 0x01EE7 },
+	{ 0x00075, 0x0030A, 0x0016F }, { 0x00075, 0x0030B, 0x00171 }, { 0x00075, 0x0030C, 0x001D4 },
+	{ 0x00075, 0x0030F, 0x00215 }, { 0x00075, 0x00311, 0x00217 }, { 0x00075, 0x0031B, 0x001B0 },
+	{ 0x00075, 0x00323, 0x01EE5 }, { 0x00075, 0x00324, 0x01E73 }, { 0x00075, 0x00328, 0x00173 },
+	{ 0x00075, 0x0032D, 0x01E77 }, { 0x00075, 0x00330, 0x01E75 }, { 0x00076, 0x00303, 0x01E7D },
+	{ 0x00076, 0x00323, 0x01E7F }, { 0x00077, 0x00300, 0x01E81 }, { 0x00077, 0x00301, 0x01E83 },
+	{ 0x00077, 0x00302, 0x00175 }, { 0x00077, 0x00307, 0x01E87 }, { 0x00077, 0x00308, 0x01E85 },
+	{ 0x00077, 0x0030A, 0x01E98 }, { 0x00077, 0x00323, 0x01E89 }, { 0x00078, 0x00307, 0x01E8B },
+	{ 0x00078, 0x00308, 0x01E8D }, { 0x00079, 0x00300, 0x01EF3 }, { 0x00079, 0x00301, 0x000FD },
+	{ 0x00079, 0x00302, 0x00177 }, { 0x00079, 0x00303, 0x01EF9 }, { 0x00079, 0x00304, 0x00233 },
+	{ 0x00079, 0x00307, 0x01E8F }, { 0x00079, 0x00308, 0x000FF }, { 0x00079, 0x00309, 0x01EF7 },
+	{ 0x00079, 0x0030A, 0x01E99 }, { 0x00079, 0x00323, 0x01EF5 }, { 0x0007A, 0x00301, 0x0017A },
+	{ 0x0007A, 0x00302, 0x01E91 }, { 0x0007A, 0x00307, 0x0017C }, { 0x0007A, 0x0030C, 0x0017E },
+	{ 0x0007A, 0x00323, 0x01E93 }, { 0x0007A, 0x00331, 0x01E95 }, { 0x000A8, 0x00300, 0x01FED },
+	{ 0x000A8, 0x00301, 0x00385 }, { 0x000A8, 0x00342, 0x01FC1 }, { 0x000C2, 0x00300, 0x01EA6 },
+	{ 0x000C2, 0x00301, 0x01EA4 }, { 0x000C2, 0x00303, 0x01EAA }, { 0x000C2, 0x00309, 0x01EA8 },
+	{ 0x000C4, 0x00304, 0x001DE }, { 0x000C5, 0x00301, 0x001FA }, { 0x000C6, 0x00301, 0x001FC },
+	{ 0x000C6, 0x00304, 0x001E2 }, { 0x000C7, 0x00301, 0x01E08 }, { 0x000CA, 0x00300, 0x01EC0 },
+	{ 0x000CA, 0x00301, 0x01EBE }, { 0x000CA, 0x00303, 0x01EC4 }, { 0x000CA, 0x00309, 0x01EC2 },
+	{ 0x000CF, 0x00301, 0x01E2E }, { 0x000D4, 0x00300, 0x01ED2 }, { 0x000D4, 0x00301, 0x01ED0 },
+	{ 0x000D4, 0x00303, 0x01ED6 }, { 0x000D4, 0x00309, 0x01ED4 }, { 0x000D5, 0x00301, 0x01E4C },
+	{ 0x000D5, 0x00304, 0x0022C }, { 0x000D5, 0x00308, 0x01E4E }, { 0x000D6, 0x00304, 0x0022A },
+	{ 0x000D8, 0x00301, 0x001FE }, { 0x000DC, 0x00300, 0x001DB }, { 0x000DC, 0x00301, 0x001D7 },
+	{ 0x000DC, 0x00304, 0x001D5 }, { 0x000DC, 0x0030C, 0x001D9 }, { 0x000E2, 0x00300, 0x01EA7 },
+	{ 0x000E2, 0x00301, 0x01EA5 }, { 0x000E2, 0x00303, 0x01EAB }, { 0x000E2, 0x00309, 0x01EA9 },
+	{ 0x000E4, 0x00304, 0x001DF }, { 0x000E5, 0x00301, 0x001FB }, { 0x000E6, 0x00301, 0x001FD },
+	{ 0x000E6, 0x00304, 0x001E3 }, { 0x000E7, 0x00301, 0x01E09 }, { 0x000EA, 0x00300, 0x01EC1 },
+	{ 0x000EA, 0x00301, 0x01EBF }, { 0x000EA, 0x00303, 0x01EC5 }, { 0x000EA, 0x00309, 0x01EC3 },
+	{ 0x000EF, 0x00301, 0x01E2F }, { 0x000F4, 0x00300, 0x01ED3 }, { 0x000F4, 0x00301, 0x01ED1 },
+	{ 0x000F4, 0x00303, 0x01ED7 }, { 0x000F4, 0x00309, 0x01ED5 }, { 0x000F5, 0x00301, 0x01E4D },
+	{ 0x000F5, 0x00304, 0x0022D }, { 0x000F5, 0x00308, 0x01E4F }, { 0x000F6, 0x00304, 0x0022B },
+	{ 0x000F8, 0x00301, 0x001FF }, { 0x000FC, 0x00300, 0x001DC }, { 0x000FC, 0x00301, 0x001D8 },
+	{ 0x000FC, 0x00304, 0x001D6 }, { 0x000FC, 0x0030C, 0x001DA }, { 0x00102, 0x00300, 0x01EB0 },
+	{ 0x00102, 0x00301, 0x01EAE }, { 0x00102, 0x00303, 0x01EB4 }, { 0x00102, 0x00309, 0x01EB2 },
+	{ 0x00103, 0x00300, 0x01EB1 }, { 0x00103, 0x00301, 0x01EAF }, { 0x00103, 0x00303, 0x01EB5 },
+	{ 0x00103, 0x00309, 0x01EB3 }, { 0x00112, 0x00300, 0x01E14 }, { 0x00112, 0x00301, 0x01E16 },
+	{ 0x00113, 0x00300, 0x01E15 }, { 0x00113, 0x00301, 0x01E17 }, { 0x0014C, 0x00300, 0x01E50 },
+	{ 0x0014C, 0x00301, 0x01E52 }, { 0x0014D, 0x00300, 0x01E51 }, { 0x0014D, 0x00301, 0x01E53 },
+	{ 0x0015A, 0x00307, 0x01E64 }, { 0x0015B, 0x00307, 0x01E65 }, { 0x00160, 0x00307, 0x01E66 },
+	{ 0x00161, 0x00307, 0x01E67 }, { 0x00168, 0x00301, 0x01E78 }, { 0x00169, 0x00301, 0x01E79 },
+	{ 0x0016A, 0x00308, 0x01E7A }, { 0x0016B, 0x00308, 0x01E7B }, { 0x0017F, 0x00307, 0x01E9B },
+	{ 0x001A0, 0x00300, 0x01EDC }, { 0x001A0, 0x00301, 0x01EDA }, { 0x001A0, 0x00303, 0x01EE0 },
+	{ 0x001A0, 0x00309, 0x01EDE }, { 0x001A0, 0x00323, 0x01EE2 }, { 0x001A1, 0x00300, 0x01EDD },
+	{ 0x001A1, 0x00301, 0x01EDB }, { 0x001A1, 0x00303, 0x01EE1 }, { 0x001A1, 0x00309, 0x01EDF },
+	{ 0x001A1, 0x00323, 0x01EE3 }, { 0x001AF, 0x00300, 0x01EEA }, { 0x001AF, 0x00301, 0x01EE8 },
+	{ 0x001AF, 0x00303, 0x01EEE }, { 0x001AF, 0x00309, 0x01EEC }, { 0x001AF, 0x00323, 0x01EF0 },
+	{ 0x001B0, 0x00300, 0x01EEB }, { 0x001B0, 0x00301, 0x01EE9 }, { 0x001B0, 0x00303, 0x01EEF },
+	{ 0x001B0, 0x00309, 0x01EED }, { 0x001B0, 0x00323, 0x01EF1 }, { 0x001B7, 0x0030C, 0x001EE },
+	{ 0x001EA, 0x00304, 0x001EC }, { 0x001EB, 0x00304, 0x001ED }, { 0x00226, 0x00304, 0x001E0 },
+	{ 0x00227, 0x00304, 0x001E1 }, { 0x00228, 0x00306, 0x01E1C }, { 0x00229, 0x00306, 0x01E1D },
+	{ 0x0022E, 0x00304, 0x00230 }, { 0x0022F, 0x00304, 0x00231 }, { 0x00292, 0x0030C, 0x001EF },
+	{ 0x00391, 0x00300, 0x01FBA }, { 0x00391, 0x00301, 0x00386 }, { 0x00391, 0x00304, 0x01FB9 },
+	{ 0x00391, 0x00306, 0x01FB8 }, { 0x00391, 0x00313, 0x01F08 }, { 0x00391, 0x00314, 0x01F09 },
+	{ 0x00391, 0x00345, 0x01FBC }, { 0x00395, 0x00300, 0x01FC8 }, { 0x00395, 0x00301, 0x00388 },
+	{ 0x00395, 0x00313, 0x01F18 }, { 0x00395, 0x00314, 0x01F19 }, { 0x00397, 0x00300, 0x01FCA },
+	{ 0x00397, 0x00301, 0x00389 }, { 0x00397, 0x00313, 0x01F28 }, { 0x00397, 0x00314, 0x01F29 },
+	{ 0x00397, 0x00345, 0x01FCC }, { 0x00399, 0x00300, 0x01FDA }, { 0x00399, 0x00301, 0x0038A },
+	{ 0x00399, 0x00304, 0x01FD9 }, { 0x00399, 0x00306, 0x01FD8 }, { 0x00399, 0x00308, 0x003AA },
+	{ 0x00399, 0x00313, 0x01F38 }, { 0x00399, 0x00314, 0x01F39 }, { 0x0039F, 0x00300, 0x01FF8 },
+	{ 0x0039F, 0x00301, 0x0038C }, { 0x0039F, 0x00313, 0x01F48 }, { 0x0039F, 0x00314, 0x01F49 },
+	{ 0x003A1, 0x00314, 0x01FEC }, { 0x003A5, 0x00300, 0x01FEA }, { 0x003A5, 0x00301, 0x0038E },
+	{ 0x003A5, 0x00304, 0x01FE9 }, { 0x003A5, 0x00306, 0x01FE8 }, { 0x003A5, 0x00308, 0x003AB },
+	{ 0x003A5, 0x00314, 0x01F59 }, { 0x003A9, 0x00300, 0x01FFA }, { 0x003A9, 0x00301, 0x0038F },
+	{ 0x003A9, 0x00313, 0x01F68 }, { 0x003A9, 0x00314, 0x01F69 }, { 0x003A9, 0x00345, 0x01FFC },
+	{ 0x003AC, 0x00345, 0x01FB4 }, { 0x003AE, 0x00345, 0x01FC4 }, { 0x003B1, 0x00300, 0x01F70 },
+	{ 0x003B1, 0x00301, 0x003AC }, { 0x003B1, 0x00304, 0x01FB1 }, { 0x003B1, 0x00306, 0x01FB0 },
+	{ 0x003B1, 0x00313, 0x01F00 }, { 0x003B1, 0x00314, 0x01F01 }, { 0x003B1, 0x00342, 0x01FB6 },
+	{ 0x003B1, 0x00345, 0x01FB3 }, { 0x003B5, 0x00300, 0x01F72 }, { 0x003B5, 0x00301, 0x003AD },
+	{ 0x003B5, 0x00313, 0x01F10 }, { 0x003B5, 0x00314, 0x01F11 }, { 0x003B7, 0x00300, 0x01F74 },
+	{ 0x003B7, 0x00301, 0x003AE }, { 0x003B7, 0x00313, 0x01F20 }, { 0x003B7, 0x00314, 0x01F21 },
+	{ 0x003B7, 0x00342, 0x01FC6 }, { 0x003B7, 0x00345, 0x01FC3 }, { 0x003B9, 0x00300, 0x01F76 },
+	{ 0x003B9, 0x00301, 0x003AF }, { 0x003B9, 0x00304, 0x01FD1 }, { 0x003B9, 0x00306, 0x01FD0 },
+	{ 0x003B9, 0x00308, 0x003CA }, { 0x003B9, 0x00313, 0x01F30 }, { 0x003B9, 0x00314, 0x01F31 },
+	{ 0x003B9, 0x00342, 0x01FD6 }, { 0x003BF, 0x00300, 0x01F78 }, { 0x003BF, 0x00301, 0x003CC },
+	{ 0x003BF, 0x00313, 0x01F40 }, { 0x003BF, 0x00314, 0x01F41 }, { 0x003C1, 0x00313, 0x01FE4 },
+	{ 0x003C1, 0x00314, 0x01FE5 }, { 0x003C5, 0x00300, 0x01F7A }, { 0x003C5, 0x00301, 0x003CD },
+	{ 0x003C5, 0x00304, 0x01FE1 }, { 0x003C5, 0x00306, 0x01FE0 }, { 0x003C5, 0x00308, 0x003CB },
+	{ 0x003C5, 0x00313, 0x01F50 }, { 0x003C5, 0x00314, 0x01F51 }, { 0x003C5, 0x00342, 0x01FE6 },
+	{ 0x003C9, 0x00300, 0x01F7C }, { 0x003C9, 0x00301, 0x003CE }, { 0x003C9, 0x00313, 0x01F60 },
+	{ 0x003C9, 0x00314, 0x01F61 }, { 0x003C9, 0x00342, 0x01FF6 }, { 0x003C9, 0x00345, 0x01FF3 },
+	{ 0x003CA, 0x00300, 0x01FD2 }, { 0x003CA, 0x00301, 0x00390 }, { 0x003CA, 0x00342, 0x01FD7 },
+	{ 0x003CB, 0x00300, 0x01FE2 }, { 0x003CB, 0x00301, 0x003B0 }, { 0x003CB, 0x00342, 0x01FE7 },
+	{ 0x003CE, 0x00345, 0x01FF4 }, { 0x003D2, 0x00301, 0x003D3 }, { 0x003D2, 0x00308, 0x003D4 },
+	{ 0x00406, 0x00308, 0x00407 }, { 0x00410, 0x00306, 0x004D0 }, { 0x00410, 0x00308, 0x004D2 },
+	{ 0x00413, 0x00301, 0x00403 }, { 0x00415, 0x00300, 0x00400 }, { 0x00415, 0x00306, 0x004D6 },
+	{ 0x00415, 0x00308, 0x00401 }, { 0x00416, 0x00306, 0x004C1 }, { 0x00416, 0x00308, 0x004DC },
+	{ 0x00417, 0x00308, 0x004DE }, { 0x00418, 0x00300, 0x0040D }, { 0x00418, 0x00304, 0x004E2 },
+	{ 0x00418, 0x00306, 0x00419 }, { 0x00418, 0x00308, 0x004E4 }, { 0x0041A, 0x00301, 0x0040C },
+	{ 0x0041E, 0x00308, 0x004E6 }, { 0x00423, 0x00304, 0x004EE }, { 0x00423, 0x00306, 0x0040E },
+	{ 0x00423, 0x00308, 0x004F0 }, { 0x00423, 0x0030B, 0x004F2 }, { 0x00427, 0x00308, 0x004F4 },
+	{ 0x0042B, 0x00308, 0x004F8 }, { 0x0042D, 0x00308, 0x004EC }, { 0x00430, 0x00306, 0x004D1 },
+	{ 0x00430, 0x00308, 0x004D3 }, { 0x00433, 0x00301, 0x00453 }, { 0x00435, 0x00300, 0x00450 },
+	{ 0x00435, 0x00306, 0x004D7 }, { 0x00435, 0x00308, 0x00451 }, { 0x00436, 0x00306, 0x004C2 },
+	{ 0x00436, 0x00308, 0x004DD }, { 0x00437, 0x00308, 0x004DF }, { 0x00438, 0x00300, 0x0045D },
+	{ 0x00438, 0x00304, 0x004E3 }, { 0x00438, 0x00306, 0x00439 }, { 0x00438, 0x00308, 0x004E5 },
+	{ 0x0043A, 0x00301, 0x0045C }, { 0x0043E, 0x00308, 0x004E7 }, { 0x00443, 0x00304, 0x004EF },
+	{ 0x00443, 0x00306, 0x0045E }, { 0x00443, 0x00308, 0x004F1 }, { 0x00443, 0x0030B, 0x004F3 },
+	{ 0x00447, 0x00308, 0x004F5 }, { 0x0044B, 0x00308, 0x004F9 }, { 0x0044D, 0x00308, 0x004ED },
+	{ 0x00456, 0x00308, 0x00457 }, { 0x00474, 0x0030F, 0x00476 }, { 0x00475, 0x0030F, 0x00477 },
+	{ 0x004D8, 0x00308, 0x004DA }, { 0x004D9, 0x00308, 0x004DB }, { 0x004E8, 0x00308, 0x004EA },
+	{ 0x004E9, 0x00308, 0x004EB }, { 0x00627, 0x00653, 0x00622 }, { 0x00627, 0x00654, 0x00623 },
+	{ 0x00627, 0x00655, 0x00625 }, { 0x00648, 0x00654, 0x00624 }, { 0x0064A, 0x00654, 0x00626 },
+	{ 0x006C1, 0x00654, 0x006C2 }, { 0x006D2, 0x00654, 0x006D3 }, { 0x006D5, 0x00654, 0x006C0 },
+	{ 0x00928, 0x0093C, 0x00929 }, { 0x00930, 0x0093C, 0x00931 }, { 0x00933, 0x0093C, 0x00934 },
+	{ 0x009C7, 0x009BE, 0x009CB }, { 0x009C7, 0x009D7, 0x009CC }, { 0x00B47, 0x00B3E, 0x00B4B },
+	{ 0x00B47, 0x00B56, 0x00B48 }, { 0x00B47, 0x00B57, 0x00B4C }, { 0x00B92, 0x00BD7, 0x00B94 },
+	{ 0x00BC6, 0x00BBE, 0x00BCA }, { 0x00BC6, 0x00BD7, 0x00BCC }, { 0x00BC7, 0x00BBE, 0x00BCB },
+	{ 0x00C46, 0x00C56, 0x00C48 }, { 0x00CBF, 0x00CD5, 0x00CC0 }, { 0x00CC6, 0x00CC2, 0x00CCA },
+	{ 0x00CC6, 0x00CD5, 0x00CC7 }, { 0x00CC6, 0x00CD6, 0x00CC8 }, { 0x00CCA, 0x00CD5, 0x00CCB },
+	{ 0x00D46, 0x00D3E, 0x00D4A }, { 0x00D46, 0x00D57, 0x00D4C }, { 0x00D47, 0x00D3E, 0x00D4B },
+	{ 0x00DD9, 0x00DCA, 0x00DDA }, { 0x00DD9, 0x00DCF, 0x00DDC }, { 0x00DD9, 0x00DDF, 0x00DDE },
+	{ 0x00DDC, 0x00DCA, 0x00DDD }, { 0x01025, 0x0102E, 0x01026 }, { 0x01B05, 0x01B35, 0x01B06 },
+	{ 0x01B07, 0x01B35, 0x01B08 }, { 0x01B09, 0x01B35, 0x01B0A }, { 0x01B0B, 0x01B35, 0x01B0C },
+	{ 0x01B0D, 0x01B35, 0x01B0E }, { 0x01B11, 0x01B35, 0x01B12 }, { 0x01B3A, 0x01B35, 0x01B3B },
+	{ 0x01B3C, 0x01B35, 0x01B3D }, { 0x01B3E, 0x01B35, 0x01B40 }, { 0x01B3F, 0x01B35, 0x01B41 },
+	{ 0x01B42, 0x01B35, 0x01B43 }, { 0x01E36, 0x00304, 0x01E38 }, { 0x01E37, 0x00304, 0x01E39 },
+	{ 0x01E5A, 0x00304, 0x01E5C }, { 0x01E5B, 0x00304, 0x01E5D }, { 0x01E62, 0x00307, 0x01E68 },
+	{ 0x01E63, 0x00307, 0x01E69 }, { 0x01EA0, 0x00302, 0x01EAC }, { 0x01EA0, 0x00306, 0x01EB6 },
+	{ 0x01EA1, 0x00302, 0x01EAD }, { 0x01EA1, 0x00306, 0x01EB7 }, { 0x01EB8, 0x00302, 0x01EC6 },
+	{ 0x01EB9, 0x00302, 0x01EC7 }, { 0x01ECC, 0x00302, 0x01ED8 }, { 0x01ECD, 0x00302, 0x01ED9 },
+	{ 0x01F00, 0x00300, 0x01F02 }, { 0x01F00, 0x00301, 0x01F04 }, { 0x01F00, 0x00342, 0x01F06 },
+	{ 0x01F00, 0x00345, 0x01F80 }, { 0x01F01, 0x00300, 0x01F03 }, { 0x01F01, 0x00301, 0x01F05 },
+	{ 0x01F01, 0x00342, 0x01F07 }, { 0x01F01, 0x00345, 0x01F81 }, { 0x01F02, 0x00345, 0x01F82 },
+	{ 0x01F03, 0x00345, 0x01F83 }, { 0x01F04, 0x00345, 0x01F84 }, { 0x01F05, 0x00345, 0x01F85 },
+	{ 0x01F06, 0x00345, 0x01F86 }, { 0x01F07, 0x00345, 0x01F87 }, { 0x01F08, 0x00300, 0x01F0A },
+	{ 0x01F08, 0x00301, 0x01F0C }, { 0x01F08, 0x00342, 0x01F0E }, { 0x01F08, 0x00345, 0x01F88 },
+	{ 0x01F09, 0x00300, 0x01F0B }, { 0x01F09, 0x00301, 0x01F0D }, { 0x01F09, 0x00342, 0x01F0F },
+	{ 0x01F09, 0x00345, 0x01F89 }, { 0x01F0A, 0x00345, 0x01F8A }, { 0x01F0B, 0x00345, 0x01F8B },
+	{ 0x01F0C, 0x00345, 0x01F8C }, { 0x01F0D, 0x00345, 0x01F8D }, { 0x01F0E, 0x00345, 0x01F8E },
+	{ 0x01F0F, 0x00345, 0x01F8F }, { 0x01F10, 0x00300, 0x01F12 }, { 0x01F10, 0x00301, 0x01F14 },
+	{ 0x01F11, 0x00300, 0x01F13 }, { 0x01F11, 0x00301, 0x01F15 }, { 0x01F18, 0x00300, 0x01F1A },
+	{ 0x01F18, 0x00301, 0x01F1C }, { 0x01F19, 0x00300, 0x01F1B }, { 0x01F19, 0x00301, 0x01F1D },
+	{ 0x01F20, 0x00300, 0x01F22 }, { 0x01F20, 0x00301, 0x01F24 }, { 0x01F20, 0x00342, 0x01F26 },
+	{ 0x01F20, 0x00345, 0x01F90 }, { 0x01F21, 0x00300, 0x01F23 }, { 0x01F21, 0x00301, 0x01F25 },
+	{ 0x01F21, 0x00342, 0x01F27 }, { 0x01F21, 0x00345, 0x01F91 }, { 0x01F22, 0x00345, 0x01F92 },
+	{ 0x01F23, 0x00345, 0x01F93 }, { 0x01F24, 0x00345, 0x01F94 }, { 0x01F25, 0x00345, 0x01F95 },
+	{ 0x01F26, 0x00345, 0x01F96 }, { 0x01F27, 0x00345, 0x01F97 }, { 0x01F28, 0x00300, 0x01F2A },
+	{ 0x01F28, 0x00301, 0x01F2C }, { 0x01F28, 0x00342, 0x01F2E }, { 0x01F28, 0x00345, 0x01F98 },
+	{ 0x01F29, 0x00300, 0x01F2B }, { 0x01F29, 0x00301, 0x01F2D }, { 0x01F29, 0x00342, 0x01F2F },
+	{ 0x01F29, 0x00345, 0x01F99 }, { 0x01F2A, 0x00345, 0x01F9A }, { 0x01F2B, 0x00345, 0x01F9B },
+	{ 0x01F2C, 0x00345, 0x01F9C }, { 0x01F2D, 0x00345, 0x01F9D }, { 0x01F2E, 0x00345, 0x01F9E },
+	{ 0x01F2F, 0x00345, 0x01F9F }, { 0x01F30, 0x00300, 0x01F32 }, { 0x01F30, 0x00301, 0x01F34 },
+	{ 0x01F30, 0x00342, 0x01F36 }, { 0x01F31, 0x00300, 0x01F33 }, { 0x01F31, 0x00301, 0x01F35 },
+	{ 0x01F31, 0x00342, 0x01F37 }, { 0x01F38, 0x00300, 0x01F3A }, { 0x01F38, 0x00301, 0x01F3C },
+	{ 0x01F38, 0x00342, 0x01F3E }, { 0x01F39, 0x00300, 0x01F3B }, { 0x01F39, 0x00301, 0x01F3D },
+	{ 0x01F39, 0x00342, 0x01F3F }, { 0x01F40, 0x00300, 0x01F42 }, { 0x01F40, 0x00301, 0x01F44 },
+	{ 0x01F41, 0x00300, 0x01F43 }, { 0x01F41, 0x00301, 0x01F45 }, { 0x01F48, 0x00300, 0x01F4A },
+	{ 0x01F48, 0x00301, 0x01F4C }, { 0x01F49, 0x00300, 0x01F4B }, { 0x01F49, 0x00301, 0x01F4D },
+	{ 0x01F50, 0x00300, 0x01F52 }, { 0x01F50, 0x00301, 0x01F54 }, { 0x01F50, 0x00342, 0x01F56 },
+	{ 0x01F51, 0x00300, 0x01F53 }, { 0x01F51, 0x00301, 0x01F55 }, { 0x01F51, 0x00342, 0x01F57 },
+	{ 0x01F59, 0x00300, 0x01F5B }, { 0x01F59, 0x00301, 0x01F5D }, { 0x01F59, 0x00342, 0x01F5F },
+	{ 0x01F60, 0x00300, 0x01F62 }, { 0x01F60, 0x00301, 0x01F64 }, { 0x01F60, 0x00342, 0x01F66 },
+	{ 0x01F60, 0x00345, 0x01FA0 }, { 0x01F61, 0x00300, 0x01F63 }, { 0x01F61, 0x00301, 0x01F65 },
+	{ 0x01F61, 0x00342, 0x01F67 }, { 0x01F61, 0x00345, 0x01FA1 }, { 0x01F62, 0x00345, 0x01FA2 },
+	{ 0x01F63, 0x00345, 0x01FA3 }, { 0x01F64, 0x00345, 0x01FA4 }, { 0x01F65, 0x00345, 0x01FA5 },
+	{ 0x01F66, 0x00345, 0x01FA6 }, { 0x01F67, 0x00345, 0x01FA7 }, { 0x01F68, 0x00300, 0x01F6A },
+	{ 0x01F68, 0x00301, 0x01F6C }, { 0x01F68, 0x00342, 0x01F6E }, { 0x01F68, 0x00345, 0x01FA8 },
+	{ 0x01F69, 0x00300, 0x01F6B }, { 0x01F69, 0x00301, 0x01F6D }, { 0x01F69, 0x00342, 0x01F6F },
+	{ 0x01F69, 0x00345, 0x01FA9 }, { 0x01F6A, 0x00345, 0x01FAA }, { 0x01F6B, 0x00345, 0x01FAB },
+	{ 0x01F6C, 0x00345, 0x01FAC }, { 0x01F6D, 0x00345, 0x01FAD }, { 0x01F6E, 0x00345, 0x01FAE },
+	{ 0x01F6F, 0x00345, 0x01FAF }, { 0x01F70, 0x00345, 0x01FB2 }, { 0x01F74, 0x00345, 0x01FC2 },
+	{ 0x01F7C, 0x00345, 0x01FF2 }, { 0x01FB6, 0x00345, 0x01FB7 }, { 0x01FBF, 0x00300, 0x01FCD },
+	{ 0x01FBF, 0x00301, 0x01FCE }, { 0x01FBF, 0x00342, 0x01FCF }, { 0x01FC6, 0x00345, 0x01FC7 },
+	{ 0x01FF6, 0x00345, 0x01FF7 }, { 0x01FFE, 0x00300, 0x01FDD }, { 0x01FFE, 0x00301, 0x01FDE },
+	{ 0x01FFE, 0x00342, 0x01FDF }, { 0x02190, 0x00338, 0x0219A }, { 0x02192, 0x00338, 0x0219B },
+	{ 0x02194, 0x00338, 0x021AE }, { 0x021D0, 0x00338, 0x021CD }, { 0x021D2, 0x00338, 0x021CF },
+	{ 0x021D4, 0x00338, 0x021CE }, { 0x02203, 0x00338, 0x02204 }, { 0x02208, 0x00338, 0x02209 },
+	{ 0x0220B, 0x00338, 0x0220C }, { 0x02223, 0x00338, 0x02224 }, { 0x02225, 0x00338, 0x02226 },
+	{ 0x0223C, 0x00338, 0x02241 }, { 0x02243, 0x00338, 0x02244 }, { 0x02245, 0x00338, 0x02247 },
+	{ 0x02248, 0x00338, 0x02249 }, { 0x0224D, 0x00338, 0x0226D }, { 0x02261, 0x00338, 0x02262 },
+	{ 0x02264, 0x00338, 0x02270 }, { 0x02265, 0x00338, 0x02271 }, { 0x02272, 0x00338, 0x02274 },
+	{ 0x02273, 0x00338, 0x02275 }, { 0x02276, 0x00338, 0x02278 }, { 0x02277, 0x00338, 0x02279 },
+	{ 0x0227A, 0x00338, 0x02280 }, { 0x0227B, 0x00338, 0x02281 }, { 0x0227C, 0x00338, 0x022E0 },
+	{ 0x0227D, 0x00338, 0x022E1 }, { 0x02282, 0x00338, 0x02284 }, { 0x02283, 0x00338, 0x02285 },
+	{ 0x02286, 0x00338, 0x02288 }, { 0x02287, 0x00338, 0x02289 }, { 0x02291, 0x00338, 0x022E2 },
+	{ 0x02292, 0x00338, 0x022E3 }, { 0x022A2, 0x00338, 0x022AC }, { 0x022A8, 0x00338, 0x022AD },
+	{ 0x022A9, 0x00338, 0x022AE }, { 0x022AB, 0x00338, 0x022AF }, { 0x022B2, 0x00338, 0x022EA },
+	{ 0x022B3, 0x00338, 0x022EB }, { 0x022B4, 0x00338, 0x022EC }, { 0x022B5, 0x00338, 0x022ED },
+	{ 0x03046, 0x03099, 0x03094 }, { 0x0304B, 0x03099, 0x0304C }, { 0x0304D, 0x03099, 0x0304E },
+	{ 0x0304F, 0x03099, 0x03050 }, { 0x03051, 0x03099, 0x03052 }, { 0x03053, 0x03099, 0x03054 },
+	{ 0x03055, 0x03099, 0x03056 }, { 0x03057, 0x03099, 0x03058 }, { 0x03059, 0x03099, 0x0305A },
+	{ 0x0305B, 0x03099, 0x0305C }, { 0x0305D, 0x03099, 0x0305E }, { 0x0305F, 0x03099, 0x03060 },
+	{ 0x03061, 0x03099, 0x03062 }, { 0x03064, 0x03099, 0x03065 }, { 0x03066, 0x03099, 0x03067 },
+	{ 0x03068, 0x03099, 0x03069 }, { 0x0306F, 0x03099, 0x03070 }, { 0x0306F, 0x0309A, 0x03071 },
+	{ 0x03072, 0x03099, 0x03073 }, { 0x03072, 0x0309A, 0x03074 }, { 0x03075, 0x03099, 0x03076 },
+	{ 0x03075, 0x0309A, 0x03077 }, { 0x03078, 0x03099, 0x03079 }, { 0x03078, 0x0309A, 0x0307A },
+	{ 0x0307B, 0x03099, 0x0307C }, { 0x0307B, 0x0309A, 0x0307D }, { 0x0309D, 0x03099, 0x0309E },
+	{ 0x030A6, 0x03099, 0x030F4 }, { 0x030AB, 0x03099, 0x030AC }, { 0x030AD, 0x03099, 0x030AE },
+	{ 0x030AF, 0x03099, 0x030B0 }, { 0x030B1, 0x03099, 0x030B2 }, { 0x030B3, 0x03099, 0x030B4 },
+	{ 0x030B5, 0x03099, 0x030B6 }, { 0x030B7, 0x03099, 0x030B8 }, { 0x030B9, 0x03099, 0x030BA },
+	{ 0x030BB, 0x03099, 0x030BC }, { 0x030BD, 0x03099, 0x030BE }, { 0x030BF, 0x03099, 0x030C0 },
+	{ 0x030C1, 0x03099, 0x030C2 }, { 0x030C4, 0x03099, 0x030C5 }, { 0x030C6, 0x03099, 0x030C7 },
+	{ 0x030C8, 0x03099, 0x030C9 }, { 0x030CF, 0x03099, 0x030D0 }, { 0x030CF, 0x0309A, 0x030D1 },
+	{ 0x030D2, 0x03099, 0x030D3 }, { 0x030D2, 0x0309A, 0x030D4 }, { 0x030D5, 0x03099, 0x030D6 },
+	{ 0x030D5, 0x0309A, 0x030D7 }, { 0x030D8, 0x03099, 0x030D9 }, { 0x030D8, 0x0309A, 0x030DA },
+	{ 0x030DB, 0x03099, 0x030DC }, { 0x030DB, 0x0309A, 0x030DD }, { 0x030EF, 0x03099, 0x030F7 },
+	{ 0x030F0, 0x03099, 0x030F8 }, { 0x030F1, 0x03099, 0x030F9 }, { 0x030F2, 0x03099, 0x030FA },
+	{ 0x030FD, 0x03099, 0x030FE }, { 0x11099, 0x110BA, 0x1109A }, { 0x1109B, 0x110BA, 0x1109C },
+	{ 0x110A5, 0x110BA, 0x110AB }, { 0x11131, 0x11127, 0x1112E }, { 0x11132, 0x11127, 0x1112F },
+	{ 0x11347, 0x1133E, 0x1134B }, { 0x11347, 0x11357, 0x1134C }, { 0x114B9, 0x114B0, 0x114BC },
+	{ 0x114B9, 0x114BA, 0x114BB }, { 0x114B9, 0x114BD, 0x114BE }, { 0x115B8, 0x115AF, 0x115BA },
+	{ 0x115B9, 0x115AF, 0x115BB }, { 0x11935, 0x11930, 0x11938 },
+};
+
+enum str_wb {
+	STR_WB_OTHER, STR_WB_CR, STR_WB_LF, STR_WB_NEWLINE,
+	STR_WB_EXTEND, STR_WB_ZWJ, STR_WB_REGIONAL_INDICATOR, STR_WB_FORMAT,
+	STR_WB_KATAKANA, STR_WB_HEBREW_LETTER, STR_WB_ALETTER, STR_WB_SINGLE_QUOTE,
+	STR_WB_DOUBLE_QUOTE, STR_WB_MIDNUMLET, STR_WB_MIDLETTER, STR_WB_MIDNUM,
+	STR_WB_NUMERIC, STR_WB_EXTENDNUMLET, STR_WB_WSEGSPACE,
+	STR_WB_COUNT
+};
+
+enum str_sb {
+	STR_SB_OTHER, STR_SB_CR, STR_SB_LF, STR_SB_EXTEND,
+	STR_SB_SEP, STR_SB_FORMAT, STR_SB_SP, STR_SB_LOWER,
+	STR_SB_UPPER, STR_SB_OLETTER, STR_SB_NUMERIC, STR_SB_ATERM,
+	STR_SB_SCONTINUE, STR_SB_STERM, STR_SB_CLOSE,
+	STR_SB_COUNT
+};
+
+#define STR_SEG_SHIFT2	3
+#define STR_SEG_SHIFT3	4
+#define STR_SEG_LIMIT	0x20000
+
+/* Word_Break, Sentence_Break and Extended_Pictographic, by property index. */
+static const uint8_t str_seg_props[42][3] = {
+	{  0,  0, 0 }, {  0,  6, 0 }, {  2,  2, 0 }, {  3,  6, 0 }, {  1,  1, 0 }, { 18,  6, 0 },
+	{  0, 13, 0 }, { 12, 14, 0 }, { 11, 14, 0 }, {  0, 14, 0 }, { 15, 12, 0 }, {  0, 12, 0 },
+	{ 13, 11, 0 }, { 16, 10, 0 }, { 14, 12, 0 }, { 15,  0, 0 }, { 10,  8, 0 }, { 17,  0, 0 },
+	{ 10,  7, 0 }, {  3,  4, 0 }, {  0,  0, 1 }, {  7,  5, 0 }, { 14,  0, 0 }, { 10,  9, 0 },
+	{ 10,  0, 0 }, {  4,  3, 0 }, { 15, 13, 0 }, {  9,  9, 0 }, { 15, 10, 0 }, {  0,  9, 0 },
+	{  0,  5, 0 }, {  5,  3, 0 }, { 13, 14, 0 }, { 17,  6, 0 }, {  0, 13, 1 }, { 10,  7, 1 },
+	{ 10,  8, 1 }, {  8,  9, 0 }, {  8,  0, 0 }, { 13,  0, 0 }, {  6,  0, 0 }, {  4,  0, 0 },
+};
+
+/* Middle block for each 1 << (STR_SEG_SHIFT2 + STR_SEG_SHIFT3) code points. */
+static const uint8_t str_seg_stage1[1024] = {
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+	 16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+	 32,  33,  34,  34,  35,  36,  37,  38,  39,  34,  34,  34,  40,  41,  42,  43,
+	 44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,
+	 60,  61,  62,  63,  64,  64,  65,  66,  64,  67,  64,  68,  69,  70,  71,  72,
+	 64,  64,  73,  74,  64,  64,  75,  64,  76,  77,  78,  79,  80,  64,  64,  64,
+	 81,  82,  83,  84,  64,  85,  86,  64,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  88,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  89,  34,  34,  90,  91,  92,  93,
+	 94,  95,  96,  97,  98,  99, 100, 101,  34,  34,  34,  34,  34,  34,  34,  34,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,
+	 34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34,  34, 102,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  87,  87, 103, 104, 105, 106,  34,  34, 107, 108, 109, 110, 111, 112,
+	113, 114, 115, 116,  64, 117, 118, 119, 120, 121, 122, 123,  34,  34, 124, 125,
+	126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136,  64,  64, 137, 138, 139,
+	140, 141, 142, 143, 144, 145, 146,  64, 147, 148,  64, 149, 150, 151, 152,  64,
+	153, 154, 155, 156, 157, 158,  64,  64, 159, 160, 161, 162,  64, 163,  64, 164,
+	 34,  34,  34,  34,  34,  34,  34, 165, 166,  34, 167,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64, 168,
+	 34,  34,  34,  34,  34,  34,  34,  34, 169,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  34,  34,  34,  34, 170,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 34,  34,  34,  34, 171, 172, 173, 174,  64,  64,  64,  64, 175, 176, 177, 178,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87,  87, 179,
+	 87,  87,  87,  87,  87,  87,  87,  87,  87, 180, 181,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64, 182,
+	183,  87, 184,  87,  87, 185,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64, 186, 187,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+	 64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64, 188,  64,
+	 64,  64, 189, 190, 191,  64,  64,  64, 192, 193, 194, 195, 196, 197, 198, 199,
+	 64,  64,  64,  64, 200, 201,  64,  64,  64,  64,  64,  64,  64,  64, 202,  64,
+	203,  64, 204,  64,  64, 205,  64,  64,  64,  64,  64,  64,  64,  64,  64, 206,
+	 34, 207, 208,  64,  64,  64,  64,  64,  64,  64,  64,  64, 209, 210,  64,  64,
+	211, 211, 212, 213, 214, 211, 211, 215, 211, 211, 216, 211, 217, 211, 218, 219,
+	220, 221, 222, 211, 211, 211,  64, 223, 211, 211, 211, 211, 211, 211, 211, 224,
+};
+
+/* Leaf for each 1 << STR_SEG_SHIFT3 code points, in blocks of 1 << STR_SEG_SHIFT2. */
+static const uint16_t str_seg_stage2[1800] = {
+	  0,   1,   2,   3,   4,   5,   6,   7,   8,   1,   9,  10,  11,  12,  13,  14,
+	 15,  15,  15,  16,  17,  15,  15,  18,  19,  20,  21,  22,  23,  24,  15,  25,
+	 15,  15,  15,  26,  27,  13,  13,  13,  13,  28,  13,  29,  30,  31,  32,  33,
+	 34,  34,  34,  34,  34,  34,  34,  35,  36,  37,  38,  13,  39,  40,  15,  41,
+	 11,  11,  11,  13,  13,  13,  15,  15,  42,  15,  15,  15,  43,  15,  15,  15,
+	 15,  15,  15,   4,  11,  44,  13,  13,  45,  46,  34,  47,  48,  49,  50,  51,
+	 52,  53,  54,  54,  55,  34,  56,  57,  54,  54,  54,  54,  54,  58,  59,  60,
+	 61,  62,  54,  34,  63,  54,  54,  54,  54,  54,  64,  65,  66,  54,  55,  67,
+	 54,  68,  69,  70,  54,  71,  72,  54,  73,  74,  54,  54,  75,  34,  76,  34,
+	 77,  54,  54,  78,  34,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,
+	 90,  83,  84,  91,  92,  93,  94,  95,  96,  97,  84,  98,  99, 100,  88, 101,
+	102,  83,  84,  98, 103, 104,  88, 105, 106, 107, 108, 109, 110, 111,  94,   1,
+	112, 113,  84, 114, 115, 116,  88,   1, 117, 113,  84, 118, 115, 119,  88, 120,
+	121, 113,  54, 122, 123, 124,  88, 125, 126, 127,  54, 128, 129, 130,  94, 131,
+	132, 133, 133, 134, 135, 136,   1,   1, 137, 133, 138, 139, 140, 141,   1,   1,
+	100, 142, 136, 143, 144,  54, 145,  46, 146, 147,  34, 148, 149,   1,   1,   1,
+	133, 133, 150, 151, 152, 153, 154, 155, 156, 157,  11,  11, 158,  54,  54, 159,
+	 54,  54,  54,  54,  54,  54,  54,  54,  54,  54,  54,  54, 160, 161,  54,  54,
+	160,  54,  54, 162, 163, 164,  54,  54,  54, 163,  54,  54,  54, 165, 166,   1,
+	 54,   1,  11,  11,  11,  11,  11, 167,  81,  54,  54,  54,  54,  54,  54,  54,
+	 54,  54,  54,  54,  54,  54, 168,  54, 169, 170,  54,  54,  54,  54, 171, 172,
+	 54, 173,  54, 174,  54, 175, 176, 177, 133, 133, 133, 178,  34, 179, 136,   1,
+	180, 136,  54,  54,  54,  54,  54, 172, 181,  54, 182,  54,  54,  54,  54, 183,
+	 54, 184, 185, 185, 186, 133, 187, 188, 133, 133, 189, 133, 190, 136,   1,   1,
+	 54, 191, 133, 133, 133, 192,  34, 193, 136, 136, 194,  34, 195,   1,   1,   1,
+	196,  54,  54, 197, 198, 199, 200, 201, 202,  54, 203,  66,  54,  54,  64, 204,
+	 54,  54, 197, 205, 206,  66,  54, 207, 208,  54,  54, 209,   1, 210, 211, 212,
+	 13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  13,  34,  34,  34,  34,
+	 15,  15,  15,  15,  15,  15,  15,  15,  15, 213,  15,  15,  15,  15,  15,  15,
+	214, 215, 214, 214, 215, 216, 214, 217, 214, 214, 214, 218, 219, 220, 221, 219,
+	222, 223, 224, 225, 226, 227, 228, 229, 230, 231,   1,   1,   1,  34,  34, 232,
+	233, 234, 235, 236, 237,   1,  11,  13, 238, 239, 240,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1,   1, 241, 242, 243,   1,   1,   1,   1,   1,
+	244,   1,   1,   1, 245,   1, 246, 247,   1,   1,   1, 248, 249,  13, 250,   1,
+	  1,   1, 242, 251, 252,   1,   1, 253, 254, 255, 256, 256, 256, 256, 256, 256,
+	257, 256, 256, 256, 256, 256, 256, 256, 258, 259, 260, 261, 262, 263, 264, 265,
+	  1, 266, 267, 268, 269,   1, 270,   1,   1,   1,   1, 271,   1,   1,   1,   1,
+	272, 273,   1,   1,   1, 241,   1, 274, 266, 275,   1,   1,   1, 276,   1,   1,
+	 11,  11,  11,  13,  13,  13, 277, 278,  15,  15,  15,  15,  15,  15, 279, 280,
+	 13,  13, 281,  54,  54,  54, 282, 283,  54, 284, 285, 285, 285, 285,  34,  34,
+	286, 274, 287, 288, 289, 290,   1,   1, 291, 292, 293, 294, 132, 133, 133, 133,
+	133, 295, 296, 297, 297, 297, 297, 298, 299,  54,  54,  81,  54,  54,  54,  54,
+	184,   1,  54,  54,   1,   1,   1, 297,   1, 300,   1,   1,   1, 301, 301, 302,
+	301, 301, 301, 301, 301, 303,   1,   1, 133, 133, 133, 133, 133, 133, 133, 133,
+	133, 133, 133, 133,   1,   1,   1,   1, 145,   1,   1,   1,   1,  54,  54, 304,
+	305,  54, 306,   1,  15,  15, 307, 308,  15, 309,  54,  54,  54,  54,  54, 310,
+	311, 312, 313, 314,  15,  15,  15, 315, 316, 317, 318, 319, 320, 321,   1, 322,
+	323,  54, 324,   1,  54,  54,  54, 325, 326,  54,  54, 197, 327, 136,  34, 328,
+	 66,  54, 329,  54, 330, 204,  54, 145,  77,  54,  54, 331, 332, 136, 333, 334,
+	 54,  54, 335, 336, 337, 338, 133, 339, 133, 133, 133, 340, 341, 342,  55, 343,
+	344, 345, 285,  13,  13, 346, 347,  13,  13,  13,  13,  13,  54,  54, 348, 136,
+	 54,  54, 349,  54, 350,  54,  54, 351, 133, 133, 133, 133, 133, 133, 187, 133,
+	133, 133, 133, 133, 133, 190,   1,   1, 352, 353, 354, 355, 356,  54,  54,  54,
+	 54,  54,  54, 357,   1, 358,  54,  54,  54,  54,  54, 359,   1,  54,  54,  54,
+	 54, 360,  54,  54, 361,   1,   1, 351,  34, 362,  34, 363, 364, 365, 366, 367,
+	 54,  54,  54,  54,  54,  54,  54, 368, 369,   3,   4,   5,   6, 370, 371, 297,
+	297, 372,  54, 184, 373, 374,   1, 375, 376,  54, 164, 377, 378, 378,   1,   1,
+	 54,  54,  54,  54,  54,  54,  54,  72,   1,   1,   1,   1,  54,  54,  54, 379,
+	  1,   1,   1,   1,   1,   1,   1, 380,  54, 145,  54,  54,  54, 100, 232,   1,
+	 54,  54, 381,  54,  72,  54,  54, 382,  54, 378,  54,  54, 383, 384,   1,   1,
+	 11,  11, 385,  13,  13,  54,  54,  54,  54, 378, 136,  11,  11, 386,  13, 387,
+	 54,  54, 361,  54,  54,  54, 349, 388, 388, 389, 390, 391,   1,   1,   1,   1,
+	 54,  54,  54, 284,  54, 183, 361,   1, 392,  13,  13, 393,   1,   1,   1,   1,
+	394,  54,  54, 395,  54, 183,  54, 284,  54, 184,   1,   1,   1,   1,  54, 396,
+	 54, 183,  54, 397,   1,   1,   1,   1,  54,  54,  54, 398,   1,   1,   1,   1,
+	399, 400,  54, 401,   1, 402,  54, 145,  54, 145,   1,   1, 144,  54, 403,   1,
+	 54,  54,  54, 183,  54, 183,  54, 404,  54, 357,   1,   1,   1,   1,   1,   1,
+	 54,  54,  54,  54, 172,   1,   1,   1,  11,  11,  11, 405,  13,  13,  13, 406,
+	 54,  54, 407, 136,   1,   1,   1,   1,  54,  54, 408, 357,   1,   1,   1,   1,
+	 54, 145, 409,  54,  64, 410,   1,  54, 411,   1,   1,  54, 379,   1,  54, 284,
+	202,  54,  54, 412, 413,   1,  94, 414, 202,  54,  54, 415, 416,  54, 172, 136,
+	202,  54, 330, 417, 418,  54,  54, 419, 202,  54,  54, 331, 420, 421,   1,   1,
+	 54,  97, 422, 423,   1,   1,   1,   1, 424, 425, 426,  54,  54, 427, 428, 136,
+	429,  83,  84, 430, 103, 431, 432, 433,  54,  54,  54, 434, 435, 436, 357,   1,
+	 54,  54,  54,  34, 437, 136,   1,   1,  54,  54, 427, 438, 439, 440,   1,   1,
+	 54,  54,  54,  34, 441, 136,   1,   1,  54,  54,  55, 442, 136,   1,   1,   1,
+	133, 443, 185, 444, 445,   1,   1,   1,  54,  54, 422, 428,   1,   1,   1,   1,
+	  1,   1,  11,  11,  13,  13, 136, 446, 447, 448,  54, 449, 450, 136,   1,   1,
+	  1,   1, 451,  54,  54, 452, 453,   1, 454,  54,  54, 455, 456, 457,  54,  54,
+	 75, 458,   1,  54,  54,  54,  54, 172,  84,  54, 427, 459, 460, 136,   1, 360,
+	 54, 461, 147, 336,   1,   1,   1,   1, 462,  54,  54, 463, 464, 136, 465,  54,
+	466, 467, 136,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  54, 468,
+	  1,   1,   1, 100,   1,   1,   1,   1,  54, 397,   1,   1,   1,   1,   1,   1,
+	 54,  54,  54,  54,  54,  54, 184,   1,  54,  54,  54,  54, 349,   1,   1,   1,
+	  1,  54,  54,  54,  54,  54,  54, 100,  54,  54, 184, 469,   1,   1,   1,   1,
+	 54,  54,  54,  54, 284,   1,   1,   1,  54,  54,  54, 172,  54, 184, 470,  54,
+	 54,  54,  54, 184, 136,  54, 378, 471,  54,  54,  54, 413, 472, 136, 358, 473,
+	 54,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,  11,  11,  13,  13,
+	  1, 474,   1,   1,   1,   1,   1,   1,  54,  54,  54,  54, 475, 476,  34,  34,
+	477, 202,   1,   1,   1,   1, 478, 479, 133, 133, 133, 133, 133, 133, 133, 480,
+	133, 133, 133, 133, 133, 481,   1,   1, 482,   1,   1,   1,   1,   1,   1,   1,
+	  1,   1,   1,   1,   1,   1,   1, 483, 484, 133, 133, 133, 133, 133, 133, 133,
+	133, 133, 485,   1,   1, 486, 487, 133, 133, 133, 133, 133, 133, 133, 133, 189,
+	 54,  54,  54,  54,  54,  54,  72, 145, 172, 488, 489,   1,   1,   1,   1,   1,
+	 34,  34, 490,  34, 336,   1,   1,   1,   1,   1,   1,   1,   1,   1, 491, 492,
+	493,   1, 494,   1,   1,   1,   1,   1,   1,   1,   1,   1, 495,   1,   1,   1,
+	 11, 496,  13, 497, 498, 499, 214,  11, 500, 501, 502, 503, 504,  11, 496,  13,
+	505, 506,  13, 507, 508, 509, 510,  11, 511,  13,  11, 496,  13, 497, 498,  13,
+	214,  11, 500, 510,  11, 511,  13,  11, 496,  13, 512,  11, 509, 513, 514, 515,
+	 13, 516,  11, 517, 518, 519, 520,  13, 521,  11, 522,  13, 523, 524, 524, 524,
+	 34,  34,  34, 525,  34,  34, 148, 526, 527, 200,  46,   1,   1,   1,   1,   1,
+	528, 518,   1,   1,   1,   1,   1,   1, 459, 529, 530,   1,   1,   1,   1,   1,
+	 54,  54, 145, 531, 532,   1,   1,   1,   1,  54, 533,   1,  54,  54, 422, 136,
+	  1,   1,   1,   1,   1,   1, 534, 184,  54,  54,  54,  54, 379, 336,   1,   1,
+	 11,  11, 500,  13, 535, 136,   1,   1, 536,  54, 537, 538, 539, 540, 541, 542,
+	543, 351, 544, 351,   1,   1,   1,   1, 256, 256, 256, 256, 256, 256, 256, 256,
+	545,   1, 245,  11, 546,  11, 547, 548, 549, 550, 545, 256, 256, 256, 551, 552,
+	553, 554, 245, 555, 246, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 556,
+	256, 256, 256, 557, 558, 256, 256, 256, 256, 256, 256, 256, 256,   1,   1, 559,
+	  1,   1,   1,   1,   1,   1,   1, 560,   1,   1,   1,   1,   1, 561, 256, 256,
+	562,   1,   1,   1, 563, 564,   1,   1, 563,   1, 565, 256, 256, 256, 256, 256,
+	562, 256, 256, 566, 254, 256, 256, 256,   1,   1,   1,   1,   1,   1,   1, 136,
+	256, 256, 256, 256, 256, 256, 256, 557,
+};
+
+/* Property index of each code point, in leaves of 1 << STR_SEG_SHIFT3. */
+static const uint8_t str_seg_stage3[9072] = {
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  3,  3,  4,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 5,  6,  7,  0,  0,  0,  0,  8,  9,  9,  0,  0, 10, 11, 12,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 15,  0,  0,  0,  6,
+	 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  9,  0,  9,  0, 17,
+	 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  9,  0,  9,  0,  0,
+	 0,  0,  0,  0,  0, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 1,  0,  0,  0,  0,  0,  0,  0,  0, 20, 18,  9,  0, 21, 20,  0,
+	 0,  0,  0,  0,  0, 18,  0, 22,  0,  0, 18,  9,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16,  0, 16, 16, 16, 16, 16, 16, 16, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 18, 18,
+	16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	16, 18, 16, 18, 16, 18, 16, 18, 18, 16, 18, 16, 18, 16, 18, 16,
+	18, 16, 18, 16, 18, 16, 18, 16, 18, 18, 16, 18, 16, 18, 16, 18,
+	16, 18, 16, 18, 16, 18, 16, 18, 16, 16, 18, 16, 18, 16, 18, 18,
+	18, 16, 16, 18, 16, 18, 16, 16, 18, 16, 16, 16, 18, 18, 16, 16,
+	16, 16, 18, 16, 16, 18, 16, 16, 16, 18, 18, 18, 16, 16, 18, 16,
+	16, 18, 16, 18, 16, 18, 16, 16, 18, 16, 18, 18, 16, 18, 16, 16,
+	18, 16, 16, 16, 18, 16, 18, 16, 16, 18, 18, 23, 16, 18, 18, 18,
+	23, 23, 23, 23, 16, 16, 18, 16, 16, 18, 16, 16, 18, 16, 18, 16,
+	18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 18, 16, 18,
+	18, 16, 16, 18, 16, 18, 16, 16, 16, 18, 16, 18, 16, 18, 16, 18,
+	16, 18, 16, 18, 18, 18, 18, 18, 18, 18, 16, 16, 18, 16, 16, 18,
+	18, 16, 18, 16, 16, 16, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	18, 18, 18, 18, 23, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 23, 23, 23, 23, 23, 23, 23,
+	18, 18, 24, 24, 24, 24, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 24, 24, 24, 24, 24, 24,  0,  0,  0,  0,  0,  0, 24, 24,
+	18, 18, 18, 18, 18, 24, 24, 24, 24, 24, 24, 24, 23, 24, 23, 24,
+	24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	16, 18, 16, 18, 23,  0, 16, 18,  0,  0, 18, 18, 18, 18, 15, 16,
+	 0,  0,  0,  0,  0,  0, 16, 22, 16, 16, 16,  0, 16,  0, 16, 16,
+	18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16,  0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 16,
+	18, 18, 16, 16, 16, 18, 18, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	18, 18, 18, 18, 16, 18,  0, 16, 18, 16, 16, 18, 18, 16, 16, 16,
+	16, 18,  0, 25, 25, 25, 25, 25, 25, 25, 16, 18, 16, 18, 16, 18,
+	16, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 18,
+	16, 16, 16, 16, 16, 16, 16,  0,  0, 23, 24, 24, 24, 11, 24, 22,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 26, 24,  0,  0,  0,  0,  0,
+	 0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0, 25,
+	 0, 25, 25,  0, 25, 25,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,  0,  0,  0,  0, 27,
+	27, 27, 27, 23, 22,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	21, 21, 21, 21, 21, 21,  0,  0,  0,  0,  0,  0, 10, 10,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0, 21,  6,  6,  6,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0, 13, 28,  0, 23, 23,
+	25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23,  6, 23, 25, 25, 25, 25, 25, 25, 25, 21,  0, 25,
+	25, 25, 25, 25, 25, 23, 23, 25, 25,  0, 25, 25, 25, 25, 23, 23,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23,  0,  0, 23,
+	 6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,
+	23, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23, 23, 23, 23, 23,
+	25, 25, 25, 25, 23, 23,  0,  0, 10,  6, 23,  0,  0, 25,  0,  0,
+	23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 23, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 23, 25, 25, 25, 23, 25, 25, 25, 25, 25,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  6,  0,  6,  0,  0,  0,  6,  6,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23,  0,
+	21, 21,  0,  0,  0,  0,  0,  0, 25, 25, 25, 25, 25, 25, 25, 25,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25,
+	25, 25, 21, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 23, 25, 25,
+	23, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 25, 25,  6,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	 0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 23,
+	23,  0,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23,
+	23,  0, 23,  0,  0,  0, 23, 23, 23, 23,  0,  0, 25, 23, 25, 25,
+	25, 25, 25, 25, 25,  0,  0, 25, 25,  0,  0, 25, 25, 25, 23,  0,
+	 0,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  0, 23, 23,  0, 23,
+	23, 23, 25, 25,  0,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,  0, 25,  0,
+	 0, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0, 23,
+	23,  0, 23, 23,  0, 23, 23,  0, 23, 23,  0,  0, 25,  0, 25, 25,
+	25, 25, 25,  0,  0,  0,  0, 25, 25,  0,  0, 25, 25, 25,  0,  0,
+	 0, 25,  0,  0,  0,  0,  0,  0,  0, 23, 23, 23, 23,  0, 23,  0,
+	 0,  0,  0,  0,  0,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	25, 25, 23, 23, 23, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23,
+	23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23,  0, 23, 23,  0, 23, 23, 23, 23, 23,  0,  0, 25, 23, 25, 25,
+	25, 25, 25, 25, 25, 25,  0, 25, 25, 25,  0, 25, 25, 25,  0,  0,
+	23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 23, 25, 25, 25, 25, 25, 25,
+	 0, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 23,
+	25, 25, 25, 25, 25,  0,  0, 25, 25,  0,  0, 25, 25, 25,  0,  0,
+	 0,  0,  0,  0,  0, 25, 25, 25,  0,  0,  0,  0, 23, 23,  0, 23,
+	 0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 25, 23,  0, 23, 23, 23, 23, 23, 23,  0,  0,  0, 23, 23,
+	23,  0, 23, 23, 23, 23,  0,  0,  0, 23, 23,  0, 23,  0, 23, 23,
+	 0,  0,  0, 23, 23,  0,  0,  0, 23, 23, 23,  0,  0,  0, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0, 25, 25,
+	25, 25, 25,  0,  0,  0, 25, 25, 25,  0, 25, 25, 25, 25,  0,  0,
+	23,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23,
+	23,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 25, 23, 25, 25,
+	25, 25, 25, 25, 25,  0, 25, 25, 25,  0, 25, 25, 25, 25,  0,  0,
+	 0,  0,  0,  0,  0, 25, 25,  0, 23, 23, 23,  0,  0, 23,  0,  0,
+	23, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23,
+	23, 23, 23, 23,  0, 23, 23, 23, 23, 23,  0,  0, 25, 23, 25, 25,
+	 0,  0,  0,  0,  0, 25, 25,  0,  0,  0,  0,  0,  0, 23, 23,  0,
+	 0, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 23, 25, 25,
+	25, 25, 25, 25, 25,  0, 25, 25, 25,  0, 25, 25, 25, 25, 23,  0,
+	 0,  0,  0,  0, 23, 23, 23, 25,  0,  0,  0,  0,  0,  0,  0, 23,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23, 23, 23, 23, 23, 23,
+	 0, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23,  0,  0,  0, 23, 23, 23, 23, 23, 23,
+	23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23,  0,  0,
+	23, 23, 23, 23, 23, 23, 23,  0,  0,  0, 25,  0,  0,  0,  0, 25,
+	25, 25, 25, 25, 25,  0, 25,  0, 25, 25, 25, 25, 25, 25, 25, 25,
+	 0,  0, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 25, 29, 29, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0,  0,  0,  0,
+	 0, 29, 29,  0, 29,  0, 29, 29, 29, 29, 29,  0, 29, 29, 29, 29,
+	29, 29, 29, 29,  0, 29,  0, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 25, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29,  0,  0,
+	29, 29, 29, 29, 29,  0, 29,  0, 25, 25, 25, 25, 25, 25,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0, 29, 29, 29, 29,
+	 0,  0,  0,  0,  0,  0,  0,  0, 25, 25,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0, 25,  0, 25,  0, 25,  9,  9,  9,  9, 25, 25,
+	23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,
+	25, 25, 25, 25, 25,  0, 25, 25, 23, 23, 23, 23, 23, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25,  0, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 29, 29, 29, 29, 25, 25,
+	25, 29, 25, 25, 25, 29, 29, 25, 25, 25, 25, 25, 25, 25, 29, 29,
+	29, 25, 25, 25, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 29, 25,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 25, 25, 25,  0,  0,
+	16, 16, 16, 16, 16, 16,  0, 16,  0,  0,  0,  0,  0, 16,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23,  0,  0,
+	23, 23, 23, 23, 23, 23, 23,  0, 23,  0, 23, 23, 23, 23,  0,  0,
+	23,  0, 23, 23, 23, 23,  0,  0, 23, 23, 23, 23, 23, 23, 23,  0,
+	23,  0, 23, 23, 23, 23,  0,  0, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 25, 25, 25,
+	 0,  0,  6,  0,  0,  0,  0,  6,  6,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16,  0,  0, 18, 18, 18, 18, 18, 18,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  6, 23,
+	 5, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  9,  9,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,
+	23, 23, 25, 25, 25,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23,
+	23,  0, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25,  0,  0,  0, 29,  0,  0,  0,  0, 29, 25,  0,  0,
+	 0,  0, 11,  6,  0,  0,  0,  0, 11,  6,  0, 25, 25, 25, 21, 25,
+	23, 23, 23, 23, 23, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 23,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,
+	 0,  0,  0,  0,  6,  6, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,  0,  0,
+	29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0, 25,
+	 0,  0,  0,  0,  0,  0,  0, 29,  6,  6,  6,  6,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,
+	25, 25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  6,  6,  0,  0,  6,  6,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25, 25, 25, 25, 25,
+	25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  0,
+	25, 25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23,
+	25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  6,  6,  0,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  6,  6,
+	18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 23, 23, 23,
+	25, 25, 25,  0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 25, 23, 23,
+	23, 23, 23, 23, 25, 23, 23, 25, 25, 25, 23,  0,  0,  0,  0,  0,
+	16, 18, 16, 18, 16, 18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16, 16, 16, 16, 16,
+	18, 18, 18, 18, 18, 18,  0,  0, 16, 16, 16, 16, 16, 16,  0,  0,
+	18, 18, 18, 18, 18, 18, 18, 18,  0, 16,  0, 16,  0, 16,  0, 16,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,
+	18, 18, 18, 18, 18,  0, 18, 18, 16, 16, 16, 16, 16,  0, 18,  0,
+	 0,  0, 18, 18, 18,  0, 18, 18, 16, 16, 16, 16, 16,  0,  0,  0,
+	18, 18, 18, 18,  0,  0, 18, 18, 16, 16, 16, 16,  0,  0,  0,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16, 16,  0,  0,  0,
+	 5,  5,  5,  5,  5,  5,  5,  1,  5,  5,  5, 30, 25, 31, 21, 21,
+	 0,  0,  0, 11, 11,  0,  0,  0, 32, 32,  9,  9,  9,  9,  9,  9,
+	 0,  0,  0,  0, 12,  0,  0, 22, 19, 19, 21, 21, 21, 21, 21, 33,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  9,  0, 34,  6,  0, 17,
+	17,  0,  0,  0, 15,  9,  9,  6,  6, 34,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  5,
+	21, 21, 21, 21, 21,  0, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+	 0, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  9, 18,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  9,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,
+	25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 16,  0,  0,  0,  0, 16,  0,  0, 18, 16, 16, 16, 18, 18,
+	16, 16, 16, 18,  0, 16,  0,  0,  0, 16, 16, 16, 16, 16,  0,  0,
+	 0,  0, 20,  0, 16,  0, 16,  0, 16,  0, 16, 16, 16, 16,  0, 18,
+	16, 16, 16, 16, 18, 23, 23, 23, 23, 35,  0,  0, 18, 18, 16, 16,
+	 0,  0,  0,  0,  0, 16, 18, 18, 18, 18,  0,  0,  0,  0, 18,  0,
+	23, 23, 23, 16, 18, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 20, 20, 20, 20, 20, 20,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  9,  9,  9,  9,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 20,  9,  9,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20,  0,  0,  0,  0, 20, 20, 20,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 36, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20, 20,  0,
+	20, 20, 20, 20, 20, 20,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	20, 20, 20, 20, 20, 20,  0,  0, 20, 20, 20, 20, 20, 20, 20, 20,
+	20, 20, 20,  0, 20,  0, 20,  0,  0,  0,  0,  0,  0, 20,  0,  0,
+	 0, 20,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 20, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 20,  0,  0, 20,  0,  0,  0,  0, 20,  0, 20,  0,
+	 0,  0,  0, 20, 20, 20,  0, 20,  0,  0,  0,  9,  9,  9,  9,  9,
+	 9,  0,  0, 20, 20, 20, 20, 20,  9,  9,  9,  9,  9,  9,  9,  9,
+	 9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0, 20, 20, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,
+	 0,  0,  0,  0,  0,  9,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+	 0,  0,  0,  0, 20, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+	 9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  9,  9,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20,  0,  0,  0,
+	20,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 18, 16, 16, 16, 18, 18, 16, 18, 16, 18, 16, 18, 16, 16, 16,
+	16, 18, 16, 18, 18, 16, 18, 18, 18, 18, 18, 18, 18, 18, 16, 16,
+	16, 18, 16, 18, 18,  0,  0,  0,  0,  0,  0, 16, 18, 16, 18, 25,
+	25, 25, 16, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	18, 18, 18, 18, 18, 18,  0, 18,  0,  0,  0,  0,  0, 18,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0, 23,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+	23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23,  0,
+	 9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,
+	 9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,  0,  6, 23,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,
+	 0,  0,  9,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  6,  6,  9,  9,  9,  9,  9,  9,  9,  9,  0,  0,  0,
+	 5, 11,  6,  0,  0, 23, 29, 29,  9,  9,  9,  9,  9,  9,  9,  9,
+	 9,  9,  0,  0,  9,  9,  9,  9,  9,  9,  9,  9,  0,  9,  9,  9,
+	 0, 29, 29, 29, 29, 29, 29, 29, 29, 29, 25, 25, 25, 25, 25, 25,
+	20, 37, 37, 37, 37, 37,  0,  0, 29, 29, 29, 23, 23, 20,  0,  0,
+	29, 29, 29, 29, 29, 29, 29,  0,  0, 25, 25, 38, 38, 29, 29, 29,
+	38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,  0, 37, 37, 37, 37,
+	 0,  0,  0,  0,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	 0,  0,  0,  0,  0,  0,  0, 20,  0, 20,  0,  0,  0,  0,  0,  0,
+	38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+	38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,  0,
+	38, 38, 38, 38, 38, 38, 38, 38,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  6,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  6,  6,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23, 23,  0,  0,  0,  0,
+	16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 23, 25,
+	25, 25, 25,  0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0, 23,
+	16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 18, 18, 25, 25,
+	25, 25,  0,  6,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0, 24, 24, 24, 24, 24, 24, 24, 24,
+	24, 24, 24, 24, 24, 24, 24, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	24, 24, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	18, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 18, 16, 18, 16, 16, 18,
+	16, 18, 16, 18, 16, 18, 16, 18, 23, 24, 24, 16, 18, 16, 18, 23,
+	16, 18, 16, 18, 18, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 16, 16, 16, 16, 18,
+	16, 16, 16, 16, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18, 16, 18,
+	16, 18, 16, 18, 16, 16, 16, 16, 18, 16, 18,  0,  0,  0,  0,  0,
+	16, 18,  0, 18,  0, 18, 16, 18, 16, 18,  0,  0,  0,  0,  0,  0,
+	 0,  0, 23, 23, 23, 16, 18, 23, 18, 18, 18, 23, 23, 23, 23, 23,
+	23, 23, 25, 23, 23, 23, 25, 23, 23, 23, 23, 25, 23, 23, 23, 23,
+	23, 23, 23, 25, 25, 25, 25, 25,  0,  0,  0,  0, 25,  0,  0,  0,
+	23, 23, 23, 23,  0,  0,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	25, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,
+	25, 25, 23, 23, 23, 23, 23, 23,  0,  0,  0, 23,  0, 23, 23, 25,
+	23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,  0,  6,
+	23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25,  0,  0,  0,  0,  0,  0,  0,  6,  6,  0,  0,  0,  0,  0, 23,
+	29, 29, 29, 29, 29, 25, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 29, 29, 29, 29, 29,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 25, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0,  6,  6,  6,
+	29, 29, 29, 29, 29, 29, 29,  0,  0,  0, 29, 25, 25, 25, 29, 29,
+	25, 29, 25, 25, 25, 29, 29, 25, 25, 29, 29, 29, 29, 29, 25, 25,
+	29, 25, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 29, 29, 29,  0,  0,
+	 6,  6, 23, 23, 23, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0, 23, 23, 23, 23, 23, 23,  0,  0, 23, 23, 23, 23, 23, 23,  0,
+	 0, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 24, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 23,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,  6, 25, 25,  0,  0,
+	23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,
+	18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 18, 18, 18, 18, 18,  0,  0,  0,  0,  0, 27, 25, 27,
+	27, 27, 27, 27, 27, 27, 27, 27, 27,  0, 27, 27, 27, 27, 27, 27,
+	27, 27, 27, 27, 27, 27, 27,  0, 27, 27, 27, 27, 27,  0, 27,  0,
+	27, 27,  0, 27, 27,  0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+	23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  9,  9,
+	 0,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,
+	10, 11,  0, 14, 15,  0,  0,  9,  9,  0,  0,  0,  0,  0,  0,  0,
+	 0, 11, 11, 17, 17,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,  9,
+	 9,  9,  9,  9,  9,  0,  0,  9,  9,  0,  0,  0,  0, 17, 17, 17,
+	10, 11, 12,  0, 15, 14,  6,  6, 11,  9,  9,  9,  9,  9,  9,  0,
+	 0,  0,  0, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 21,
+	 0,  6,  0,  0,  0,  0,  0, 39,  9,  9,  0,  0, 10, 11, 12,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  9,  0,  9,  0,  9,
+	 9,  6,  9,  9, 11,  0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+	37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 25, 25,
+	 0,  0, 23, 23, 23, 23, 23, 23,  0,  0, 23, 23, 23, 23, 23, 23,
+	 0,  0, 23, 23, 23, 23, 23, 23,  0,  0, 23, 23, 23,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0, 21, 21, 21,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23,  0, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,
+	23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,
+	23, 23, 23, 23,  0,  0,  0,  0, 23, 23, 23, 23, 23, 23, 23, 23,
+	 0, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+	16, 16, 16, 16,  0,  0,  0,  0, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0, 16, 16, 16, 16,
+	16, 16, 16,  0, 16, 16,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18,  0, 18, 18, 18, 18, 18, 18, 18,  0, 18, 18,  0,  0,  0,
+	18, 23, 23, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23,  0,  0, 23,  0, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23,  0, 23, 23,  0,  0,  0, 23,  0,  0, 23,
+	23, 23, 23,  0, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0,  0, 23, 23,
+	23, 25, 25, 25,  0, 25, 25,  0,  0,  0,  0,  0, 25, 25, 25, 25,
+	23, 23, 23, 23,  0, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23,  0,  0, 25, 25, 25,  0,  0,  0,  0, 25,
+	 0,  0,  0,  0,  0,  0,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	18, 18, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 25, 25,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,
+	25,  0,  0,  0,  0,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,
+	23, 23, 25, 25, 25, 25,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25,  6,  6,  0,  0,  0,  0,  0,  0,  0,
+	25, 23, 23, 25, 25, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0, 21,  6,  6,
+	 6,  6, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 21,  0,  0,
+	25, 25, 25, 25, 25,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	 0,  6,  6,  6, 23, 25, 25, 23,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 25,  0,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 23, 23, 23, 23,  6,  6,  0,  0, 25, 25, 25, 25,  6, 25, 25,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 23,  0, 23,  0,  6,  6,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25,  6,  6,  0,  6,  6,  0, 25,  0,
+	23, 23, 23, 23, 23, 23, 23,  0, 23,  0, 23, 23, 23, 23,  0, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23,  6,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,
+	25, 25, 25, 25,  0, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 23,
+	23,  0, 23, 23,  0, 23, 23, 23, 23, 23,  0, 25, 25, 23, 25, 25,
+	23,  0,  0,  0,  0,  0,  0, 25,  0,  0,  0,  0,  0, 23, 23, 23,
+	23, 23, 25, 25,  0,  0, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,
+	25, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23,  6,  6,  0,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0,  0, 25, 23,
+	25, 25, 25, 25, 23, 23,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25,  0,  0, 25, 25, 25, 25, 25, 25, 25, 25,
+	25,  0,  6,  6,  0,  0,  0,  0,  0,  6,  6,  6,  6,  6,  6,  6,
+	 6,  6,  6,  6,  6,  6,  6,  6, 23, 23, 23, 23, 25, 25,  0,  0,
+	25,  6,  6,  0, 23,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 23,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,  0,  0, 25, 25, 25,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  6,  6,  6,  0,
+	29, 29, 29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 23,
+	23, 23, 23, 23, 23, 23, 23,  0,  0, 23,  0,  0, 23, 23, 23, 23,
+	23, 23, 23, 23,  0, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23,
+	25, 25, 25, 25, 25, 25,  0, 25, 25,  0,  0, 25, 25, 25, 25, 23,
+	25, 23, 25, 25,  6,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23,  0,  0, 23, 23, 23, 23, 23, 23,
+	23, 25, 25, 25, 25, 25, 25, 25,  0,  0, 25, 25, 25, 25, 25, 25,
+	25, 23,  0, 23, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 23,
+	23, 23, 23, 25, 25, 25, 25, 25, 25, 25, 23, 25, 25, 25, 25,  0,
+	 0,  0,  6,  6,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  6,  6, 23,  0,  0,
+	25, 25, 25, 25, 25, 25, 25,  0, 25, 25, 25, 25, 25, 25, 25, 25,
+	23,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	23, 23, 23, 23, 23, 23, 23,  0, 23, 23,  0, 23, 23, 23, 23, 23,
+	23, 25, 25, 25, 25, 25, 25,  0,  0,  0, 25,  0, 25, 25,  0, 25,
+	25, 25, 25, 25, 25, 25, 23, 25,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23,  0, 23, 23,  0, 23, 23, 23, 23, 23, 23,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25, 25, 25, 25, 25,  0,
+	25, 25,  0, 25, 25, 25, 25, 25, 23,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 25, 25, 25, 25,  6,  6,  0,  0,  0,  0,  0,  0,  0,
+	21, 21, 21, 21, 21, 21, 21, 21, 21,  0,  0,  0,  0,  0,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0,  0,  6,  6,
+	25, 25, 25, 25, 25,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0,  0, 23, 23, 23,
+	 0,  0,  0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0,  0, 25,
+	23, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	25, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0, 25,
+	23, 23,  0, 23, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29, 29, 29, 29, 29, 29, 29,  0,  0,  0,  0,  0,  0,  0,
+	37, 37, 37, 37,  0, 37, 37, 37, 37, 37, 37, 37,  0, 37, 37,  0,
+	37, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+	37, 37, 37,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	29, 29, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 37, 37, 37, 37,  0,  0,  0,  0,  0,  0,  0,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0,  0,  0, 25, 25,  6,
+	21, 21, 21, 21,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0,
+	 0,  0,  0,  0,  0, 25, 25, 25, 25, 25,  0,  0,  0, 25, 25, 25,
+	25, 25, 25, 21, 21, 21, 21, 21, 21, 21, 21, 25, 25, 25, 25, 25,
+	25, 25, 25,  0,  0, 25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25, 25, 25, 25,  0,  0,
+	 0,  0, 25, 25, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 18, 18,
+	18, 18, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	16, 16, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 16,  0, 16, 16,
+	 0,  0, 16,  0,  0, 16, 16,  0,  0, 16, 16, 16, 16,  0, 16, 16,
+	16, 16, 16, 16, 16, 16, 18, 18, 18, 18,  0, 18,  0, 18, 18, 18,
+	18, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 16, 16,  0, 16, 16, 16, 16,  0,  0, 16, 16, 16,
+	16, 16, 16, 16, 16,  0, 16, 16, 16, 16, 16, 16, 16,  0, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 16, 16,  0, 16, 16, 16, 16,  0,
+	16, 16, 16, 16, 16,  0, 16,  0,  0,  0, 16, 16, 16, 16, 16, 16,
+	16,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0, 18, 18, 18, 18,
+	18, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0, 18, 18, 18, 18,
+	18, 18, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 16, 16, 16, 16,
+	16, 16, 16, 16, 16,  0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  0,
+	18, 18, 18, 18, 18, 18, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 18,  0, 18, 18, 18, 18, 18, 18,
+	16, 16, 16, 16, 16, 16, 16, 16, 16,  0, 18, 18, 18, 18, 18, 18,
+	18, 18, 18,  0, 18, 18, 18, 18, 18, 18, 16, 18,  0,  0, 13, 13,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+	25, 25, 25, 25, 25, 25, 25,  0,  0,  0,  0, 25, 25, 25, 25, 25,
+	 0,  0,  0,  0,  0, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 25,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 23, 18, 18, 18, 18, 18,
+	25, 25, 25, 25, 25, 25, 25, 25, 25,  0,  0, 25, 25, 25, 25, 25,
+	25, 25,  0, 25, 25,  0, 25, 25, 25, 25, 25,  0,  0,  0,  0,  0,
+	25, 25, 25, 25, 25, 25, 25, 23, 23, 23, 23, 23, 23, 23,  0,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,  0,  0, 23,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 25,  0,
+	23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23,  0, 23, 23,  0,
+	18, 18, 18, 18, 25, 25, 25, 25, 25, 25, 25, 23,  0,  0,  0,  0,
+	23, 23, 23, 23,  0, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23,
+	 0, 23, 23,  0, 23,  0,  0, 23,  0, 23, 23, 23, 23, 23, 23, 23,
+	23, 23, 23,  0, 23, 23, 23, 23,  0, 23,  0, 23,  0,  0,  0,  0,
+	 0,  0, 23,  0,  0,  0,  0, 23,  0, 23,  0, 23,  0, 23, 23, 23,
+	 0, 23, 23,  0, 23,  0,  0, 23,  0, 23,  0, 23,  0, 23,  0, 23,
+	 0, 23, 23,  0, 23,  0,  0, 23, 23, 23, 23,  0, 23, 23, 23, 23,
+	23, 23, 23,  0, 23, 23, 23, 23,  0, 23, 23, 23, 23,  0, 23,  0,
+	23, 23, 23, 23, 23, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23,
+	 0, 23, 23, 23,  0, 23, 23, 23, 23, 23,  0, 23, 23, 23, 23, 23,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0, 20, 20, 20, 20,
+	36, 36, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 36, 36,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0, 20,  0,
+	 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  0,  0,  0,  0,  0,
+	20, 20, 20, 20, 20, 20, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40, 40,
+	 0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20,  0,  0,  0,  0,  0,
+	 0,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20,  0, 20, 20, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 41, 41, 41, 41, 41,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  0,  0,
+	 0,  0,  0,  0,  0,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  9,  9,  9,  0,  0,  0,  0,  0,  0,  0,
+	 0,  0,  0,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20, 20, 20, 20, 20,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 20,
+	20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,  0, 20, 20, 20, 20,
+};
+
+/* Property index of each ASCII character, skipping the stages. */
+static const uint8_t str_seg_ascii[128] = {
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  2,  3,  3,  4,  0,  0,
+	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+	 5,  6,  7,  0,  0,  0,  0,  8,  9,  9,  0,  0, 10, 11, 12,  0,
+	13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 14, 15,  0,  0,  0,  6,
+	 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+	16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,  9,  0,  9,  0, 17,
+	 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,  9,  0,  9,  0,  0,
+};
+
+/* Property index of the code points at or above STR_SEG_LIMIT not in index 0. */
+static const uint32_t str_seg_high[10][3] = {
+	{ 0x20000, 0x2A6DF, 29 },
+	{ 0x2A700, 0x2B738, 29 },
+	{ 0x2B740, 0x2B81D, 29 },
+	{ 0x2B820, 0x2CEA1, 29 },
+	{ 0x2CEB0, 0x2EBE0, 29 },
+	{ 0x2F800, 0x2FA1D, 29 },
+	{ 0x30000, 0x3134A, 29 },
+	{ 0xE0001, 0xE0001, 21 },
+	{ 0xE0020, 0xE007F, 25 },
+	{ 0xE0100, 0xE01EF, 25 },
+};
+/* <- UNICODE TABLES */
+
+/*
+ * str_utf8_next() - Decodes the UTF-8 sequence at @p into @cp.
+ *
+ * Overlong forms, surrogates and code points above U+10FFFF are rejected.
+ *
+ * Returns:
+ *     The length of the sequence, or 0 if it is not valid or ends past @end
+ */
+static inline size_t str_utf8_next(const unsigned char *p, const unsigned char *end, uint32_t *cp)
+{
+	uint32_t c = p[0];
+	size_t left = (size_t)(end - p);
+
+	if (c < 0x80) {
+		*cp = c;
+		return 1;
+	}
+	if (c < 0xC2)
+		return 0;
+	if (c < 0xE0) {
+		if (left < 2 || (p[1] & 0xC0) != 0x80)
+			return 0;
+		*cp = (c & 0x1F) << 6 | (p[1] & 0x3F);
+		return 2;
+	}
+	if (c < 0xF0) {
+		if (left < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80)
+			return 0;
+		c = (c & 0x0F) << 12 | (uint32_t)(p[1] & 0x3F) << 6 | (p[2] & 0x3F);
+		if (c < 0x800 || (c >= 0xD800 && c < 0xE000))
+			return 0;
+		*cp = c;
+		return 3;
+	}
+	if (c > 0xF4 || left < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 ||
+	    (p[3] & 0xC0) != 0x80)
+		return 0;
+	c = (c & 0x07) << 18 | (uint32_t)(p[1] & 0x3F) << 12 | (uint32_t)(p[2] & 0x3F) << 6 | (p[3] & 0x3F);
+	if (c < 0x10000 || c > 0x10FFFF)
+		return 0;
+	*cp = c;
+	return 4;
+}
+
+
+/*
+ * str_char_width() - Returns the display width in columns of code point @cp.
+ *
+ * Controls, combining marks and format characters take no column, East
+ * Asian wide and fullwidth characters take two, everything else one.
+ */
+static inline unsigned int str_char_width(uint32_t cp)
+{
+	if (cp < STR_WIDTH_LIMIT) {
+		size_t b = (size_t)str_width_stage1[cp >> STR_WIDTH_SHIFT] << (STR_WIDTH_SHIFT - 2);
+		size_t i = (cp & ((1u << STR_WIDTH_SHIFT) - 1)) >> 2;
+
+		return (str_width_stage2[b + i] >> ((cp & 3) * 2)) & 3;
+	}
+	for (size_t i = 0; i < sizeof(str_width_zero_high) / sizeof(*str_width_zero_high); i++)
+		if (cp >= str_width_zero_high[i][0] && cp <= str_width_zero_high[i][1])
+			return 0;
+	return 1;
+}
+
+
+/*
+ * str_display_width_n() - Returns the display width in columns of @n bytes of UTF-8.
+ * @s: Bytes to measure, may contain NUL bytes.
+ * @n: Number of bytes at @s.
+ *
+ * Widths come from two-level tables generated from the Unicode Character
+ * Database (see tools/gen_unicode.py), so each code point costs two loads.
+ * Runs of ASCII are measured a vector at a time with SSE2 or AVX2: every
+ * byte counts one column except the controls, which count none. Bytes that
+ * are not valid UTF-8 count one column each, like the U+FFFD a terminal
+ * shows in their place.
+ */
+size_t str_display_width_n(const char *s, size_t n)
+{
+	const unsigned char *p = (const unsigned char *)s, *end = p + n;
+	size_t width = 0;
+
+#ifdef STR_SIMD_BYTES
+	const str_simd space = str_simd_splat(' '), del = str_simd_splat(0x7F);
+
+	while (end - p >= STR_SIMD_BYTES) {
+		str_simd v = str_simd_load((const char *)p);
+		uint32_t high = str_simd_high(v);
+		uint32_t ctrl = str_simd_lt(v, space) | str_simd_eq(v, del);
+
+		if (!high) {
+			width += STR_SIMD_BYTES - (size_t)__builtin_popcount(ctrl);
+			p += STR_SIMD_BYTES;
+			continue;
+		}
+
+		// ASCII up to the first high byte, then the run of non-ASCII
+		unsigned int k = (unsigned int)__builtin_ctz(high);
+		width += k - (size_t)__builtin_popcount(ctrl & ((1u << k) - 1));
+		p += k;
+		while (p < end && *p >= 0x80) {
+			uint32_t cp;
+			size_t len = str_utf8_next(p, end, &cp);
+
+			width += len ? str_char_width(cp) : 1;
+			p += len ? len : 1;
+		}
+	}
+#endif
+	while (p < end) {
+		uint32_t cp;
+		size_t len = str_utf8_next(p, end, &cp);
+
+		width += len ? str_char_width(cp) : 1;
+		p += len ? len : 1;
+	}
+	return width;
+}
+
+
+/*
+ * str_display_width() - Returns the display width of @self in terminal columns.
+ * @self: Pointer to the Str structure.
+ *
+ * See str_display_width_n(). The result is cached in @self until the next
+ * change made through the str_* functions, so repeated calls, e.g. when
+ * laying out table columns, cost nothing. Changes made by writing to
+ * @self->data directly are not noticed. Shared memory mappings are measured
+ * on every call since another process may change them at any time.
+ *
+ * Returns:
+ *     The number of columns, 0 if @self is empty
+ */
+size_t str_display_width(str *self)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_DISPLAY_WIDTH, self->len);
+
+	if (self->dwidth)
+		return self->dwidth - 1;
+
+	size_t width = self->data ? str_display_width_n(self->data, self->len) : 0;
+	if (!(self->flags & STR_F_MAPPED))
+		self->dwidth = width + 1;
+	return width;
+}
+
+
+/*
+ * Transcoding between UTF-8 and UTF-16, UTF-32 or Latin-1.
+ *
+ * Every conversion makes two passes over its input: the first validates it
+ * and computes the exact output size, the second writes straight into
+ * capacity reserved in the destination once. Nothing is written when the
+ * input is invalid. With SSE2, runs of ASCII go through both passes eight
+ * or sixteen characters at a time.
+ */
+static inline size_t str_utf8_put(unsigned char *out, uint32_t cp)
+{
+	if (cp < 0x80) {
+		out[0] = (unsigned char)cp;
+		return 1;
+	}
+	if (cp < 0x800) {
+		out[0] = (unsigned char)(0xC0 | cp >> 6);
+		out[1] = (unsigned char)(0x80 | (cp & 0x3F));
+		return 2;
+	}
+	if (cp < 0x10000) {
+		out[0] = (unsigned char)(0xE0 | cp >> 12);
+		out[1] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (unsigned char)(0x80 | (cp & 0x3F));
+		return 3;
+	}
+	out[0] = (unsigned char)(0xF0 | cp >> 18);
+	out[1] = (unsigned char)(0x80 | ((cp >> 12) & 0x3F));
+	out[2] = (unsigned char)(0x80 | ((cp >> 6) & 0x3F));
+	out[3] = (unsigned char)(0x80 | (cp & 0x3F));
+	return 4;
+}
+
+static inline size_t str_utf8_len(uint32_t cp)
+{
+	return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+}
+
+static inline uint32_t str_load_u16(const unsigned char *p, int be)
+{
+	return be ? (uint32_t)p[0] << 8 | p[1] : (uint32_t)p[1] << 8 | p[0];
+}
+
+static inline uint32_t str_load_u32(const unsigned char *p, int be)
+{
+	return be ? (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3]
+		  : (uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0];
+}
+
+static inline void str_store_u16(unsigned char *p, uint32_t v, int be)
+{
+	p[be ? 0 : 1] = (unsigned char)(v >> 8);
+	p[be ? 1 : 0] = (unsigned char)v;
+}
+
+static inline void str_store_u32(unsigned char *p, uint32_t v, int be)
+{
+	for (int i = 0; i < 4; i++)
+		p[be ? 3 - i : i] = (unsigned char)(v >> (8 * i));
+}
+
+#ifdef __SSE2__
+/* Swaps the bytes of every 16-bit lane. */
+static inline __m128i str_sse_bswap16(__m128i v)
+{
+	return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+/* Swaps the bytes of every 32-bit lane. */
+static inline __m128i str_sse_bswap32(__m128i v)
+{
+	v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+	return str_sse_bswap16(v);
+}
+#endif
+
+/*
+ * str_utf16_decode() - Converts UTF-16 at @p to UTF-8 at @out.
+ *
+ * With @out NULL only the output size is computed. Unpaired surrogates
+ * become U+FFFD with STR_UTF_REPLACE and fail the conversion otherwise.
+ *
+ * Returns:
+ *     The number of UTF-8 bytes, or SIZE_MAX if the input is invalid
+ */
+static size_t str_utf16_decode(const unsigned char *p, const unsigned char *end, int flags,
+			       unsigned char *out)
+{
+	int be = flags & STR_UTF_BE;
+	size_t size = 0;
+
+	while (p < end) {
+#ifdef __SSE2__
+		while (end - p >= 16) {
+			const __m128i zero = _mm_setzero_si128();
+			__m128i v = _mm_loadu_si128((const __m128i *)p);
+			if (be)
+				v = str_sse_bswap16(v);
+
+			uint32_t ascii = (uint32_t)_mm_movemask_epi8(
+				_mm_cmpeq_epi16(_mm_subs_epu16(v, _mm_set1_epi16(0x7F)), zero));
+			if (ascii == 0xFFFF) {
+				if (out)
+					_mm_storel_epi64((__m128i *)(out + size), _mm_packus_epi16(v, v));
+				size += 8;
+				p += 16;
+				continue;
+			}
+			if (out)
+				break;
+
+			// Sizing without surrogates: 3 bytes, less one below U+0800 and one more below U+0080
+			__m128i sur = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xF800)),
+						      _mm_set1_epi16((short)0xD800));
+			if (_mm_movemask_epi8(sur))
+				break;
+			uint32_t narrow = (uint32_t)_mm_movemask_epi8(
+				_mm_cmpeq_epi16(_mm_subs_epu16(v, _mm_set1_epi16(0x7FF)), zero));
+			size += 24 - (size_t)(__builtin_popcount(ascii) + __builtin_popcount(narrow)) / 2;
+			p += 16;
+		}
+#endif
+		// A vector's worth one at a time before looking for ASCII again
+		const unsigned char *stop = end - p > 16 ? p + 16 : end;
+		while (p < stop) {
+			uint32_t cp = str_load_u16(p, be);
+			size_t k = 2;
+
+			if (cp >= 0xD800 && cp <= 0xDFFF) {
+				uint32_t lo = end - p >= 4 ? str_load_u16(p + 2, be) : 0;
+
+				if (cp <= 0xDBFF && lo >= 0xDC00 && lo <= 0xDFFF) {
+					cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+					k = 4;
+				} else if (flags & STR_UTF_REPLACE) {
+					cp = 0xFFFD;
+				} else {
+					return SIZE_MAX;
+				}
+			}
+			size += out ? str_utf8_put(out + size, cp) : str_utf8_len(cp);
+			p += k;
+		}
+	}
+	return size;
+}
+
+/*
+ * str_utf32_decode() - Converts UTF-32 at @p to UTF-8 at @out.
+ *
+ * See str_utf16_decode(). Surrogates and values above U+10FFFF are invalid.
+ */
+static size_t str_utf32_decode(const unsigned char *p, const unsigned char *end, int flags,
+			       unsigned char *out)
+{
+	int be = flags & STR_UTF_BE;
+	size_t size = 0;
+
+	while (p < end) {
+#ifdef __SSE2__
+		while (end - p >= 32) {
+			__m128i a = _mm_loadu_si128((const __m128i *)p);
+			__m128i b = _mm_loadu_si128((const __m128i *)(p + 16));
+			if (be) {
+				a = str_sse_bswap32(a);
+				b = str_sse_bswap32(b);
+			}
+			__m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi32((int)0xFFFFFF80));
+			if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xFFFF)
+				break;
+			if (out) {
+				__m128i w = _mm_packs_epi32(a, b);
+				_mm_storel_epi64((__m128i *)(out + size), _mm_packus_epi16(w, w));
+			}
+			size += 8;
+			p += 32;
+		}
+#endif
+		const unsigned char *stop = end - p > 32 ? p + 32 : end;
+		for (; p < stop; p += 4) {
+			uint32_t cp = str_load_u32(p, be);
+
+			if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+				if (!(flags & STR_UTF_REPLACE))
+					return SIZE_MAX;
+				cp = 0xFFFD;
+			}
+			size += out ? str_utf8_put(out + size, cp) : str_utf8_len(cp);
+		}
+	}
+	return size;
+}
+
+/*
+ * str_utf8_encode() - Converts UTF-8 at @p to UTF-16 (@unit 2) or UTF-32 (@unit 4).
+ *
+ * With @out NULL only the output size is computed. Invalid sequences become
+ * U+FFFD with STR_UTF_REPLACE and fail the conversion otherwise.
+ *
+ * Returns:
+ *     The number of bytes written, or SIZE_MAX if the input is invalid
+ */
+static size_t str_utf8_encode(const unsigned char *p, const unsigned char *end, int flags,
+			      size_t unit, unsigned char *out)
+{
+	int be = flags & STR_UTF_BE;
+	size_t size = 0;
+
+	while (p < end) {
+#ifdef __SSE2__
+		while (end - p >= 16) {
+			__m128i v = _mm_loadu_si128((const __m128i *)p);
+			if (_mm_movemask_epi8(v))
+				break;
+			if (out) {
+				__m128i zero = _mm_setzero_si128();
+				__m128i lo = _mm_unpacklo_epi8(v, zero), hi = _mm_unpackhi_epi8(v, zero);
+
+				if (unit == 2) {
+					if (be) {
+						lo = str_sse_bswap16(lo);
+						hi = str_sse_bswap16(hi);
+					}
+					_mm_storeu_si128((__m128i *)(out + size), lo);
+					_mm_storeu_si128((__m128i *)(out + size + 16), hi);
+				} else {
+					__m128i w[4] = {
+						_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+						_mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero),
+					};
+					for (int i = 0; i < 4; i++)
+						_mm_storeu_si128((__m128i *)(out + size + 16 * i),
+								 be ? str_sse_bswap32(w[i]) : w[i]);
+				}
+			}
+			size += 16 * unit;
+			p += 16;
+		}
+#endif
+		const unsigned char *stop = end - p > 16 ? p + 16 : end;
+		while (p < stop) {
+			uint32_t cp;
+			size_t k = str_utf8_next(p, end, &cp);
+
+			if (k == 0) {
+				if (!(flags & STR_UTF_REPLACE))
+					return SIZE_MAX;
+				cp = 0xFFFD;
+				k = 1;
+			}
+			p += k;
+
+			if (unit == 4) {
+				if (out)
+					str_store_u32(out + size, cp, be);
+				size += 4;
+			} else if (cp < 0x10000) {
+				if (out)
+					str_store_u16(out + size, cp, be);
+				size += 2;
+			} else {
+				if (out) {
+					str_store_u16(out + size, 0xD800 + ((cp - 0x10000) >> 10), be);
+					str_store_u16(out + size + 2, 0xDC00 + (cp & 0x3FF), be);
+				}
+				size += 4;
+			}
+		}
+	}
+	return size;
+}
+
+/*
+ * str_latin1_decode() - Converts Latin-1 at @p to UTF-8 at @out.
+ *
+ * With @out NULL only the output size is computed.
+ */
+static size_t str_latin1_decode(const unsigned char *p, const unsigned char *end, unsigned char *out)
+{
+	size_t size = 0;
+
+	while (p < end) {
+#ifdef STR_SIMD_BYTES
+		while (end - p >= STR_SIMD_BYTES) {
+			uint32_t high = str_simd_high(str_simd_load((const char *)p));
+
+			if (!out) {
+				size += STR_SIMD_BYTES + (size_t)__builtin_popcount(high);
+			} else if (!high) {
+				memcpy(out + size, p, STR_SIMD_BYTES);
+				size += STR_SIMD_BYTES;
+			} else {
+				break;
+			}
+			p += STR_SIMD_BYTES;
+		}
+#endif
+		const unsigned char *stop = end - p > 16 ? p + 16 : end;
+		for (; p < stop; p++)
+			size += out ? str_utf8_put(out + size, *p) : (size_t)1 + (*p >> 7);
+	}
+	return size;
+}
+
+/*
+ * str_latin1_encode() - Converts UTF-8 at @p to Latin-1 at @out.
+ *
+ * With @out NULL only the output size is computed. Code points above U+00FF
+ * and invalid sequences become '?' with STR_UTF_REPLACE and fail the
+ * conversion otherwise.
+ */
+static size_t str_latin1_encode(const unsigned char *p, const unsigned char *end, int flags,
+				unsigned char *out)
+{
+	size_t size = 0;
+
+	while (p < end) {
+#ifdef STR_SIMD_BYTES
+		while (end - p >= STR_SIMD_BYTES && !str_simd_high(str_simd_load((const char *)p))) {
+			if (out)
+				memcpy(out + size, p, STR_SIMD_BYTES);
+			size += STR_SIMD_BYTES;
+			p += STR_SIMD_BYTES;
+		}
+#endif
+		const unsigned char *stop = end - p > 16 ? p + 16 : end;
+		while (p < stop) {
+			uint32_t cp;
+			size_t k = str_utf8_next(p, end, &cp);
+
+			if (k == 0 || cp > 0xFF) {
+				if (!(flags & STR_UTF_REPLACE))
+					return SIZE_MAX;
+				cp = '?';
+				k = k ? k : 1;
+			}
+			if (out)
+				out[size] = (unsigned char)cp;
+			size++;
+			p += k;
+		}
+	}
+	return size;
+}
+
+/* Appends @size bytes produced by the second pass of a transcoder. */
+static int str_transcode_reserve(str *self, size_t size, unsigned char **out)
+{
+	if (size > SIZE_MAX - 1 - self->len)
+		return -ENOMEM;
+
+	int ret = str_grow(self, 0, self->len + size);
+	if (ret)
+		return ret;
+
+	*out = (unsigned char *)self->data + self->len;
+	return 0;
+}
+
+static void str_transcode_commit(str *self, size_t size)
+{
+	self->len += size;
+	self->data[self->len] = '\0';
+}
+
+
+/*
+ * str_from_utf16() - Appends UTF-16 text converted to UTF-8.
+ * @self: Pointer to the Str structure.
+ * @src: UTF-16 code units, little-endian unless @flags has STR_UTF_BE.
+ * @n: Number of bytes at @src.
+ * @flags: STR_UTF_BE, STR_UTF_REPLACE.
+ *
+ * A leading byte order mark selects the byte order regardless of
+ * STR_UTF_BE and is dropped.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @n is odd
+ *    -EILSEQ if @src holds an unpaired surrogate and @flags lacks STR_UTF_REPLACE
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_from_utf16(str *self, const char *src, size_t n, int flags)
+{
+	const unsigned char *p = (const unsigned char *)src, *end = p + n;
+	unsigned char *out;
+
+	assert(self != NULL);
+	STR_TRACE(STR_M_FROM_UTF16, n);
+
+	if (n % 2)
+		return -EINVAL;
+	if (n >= 2 && (p[0] ^ p[1]) == (0xFF ^ 0xFE) && (p[0] == 0xFF || p[0] == 0xFE)) {
+		flags = p[0] == 0xFE ? flags | STR_UTF_BE : flags & ~STR_UTF_BE;
+		p += 2;
+	}
+
+	size_t size = str_utf16_decode(p, end, flags, NULL);
+	if (size == SIZE_MAX)
+		return -EILSEQ;
+
+	int ret = str_transcode_reserve(self, size, &out);
+	if (ret)
+		return ret;
+
+	str_utf16_decode(p, end, flags, out);
+	str_transcode_commit(self, size);
+	return 0;
+}
+
+
+/*
+ * str_from_utf32() - Appends UTF-32 text converted to UTF-8.
+ * @self: Pointer to the Str structure.
+ * @src: UTF-32 code units, little-endian unless @flags has STR_UTF_BE.
+ * @n: Number of bytes at @src.
+ * @flags: STR_UTF_BE, STR_UTF_REPLACE.
+ *
+ * A leading byte order mark selects the byte order regardless of
+ * STR_UTF_BE and is dropped.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @n is not a multiple of 4
+ *    -EILSEQ if @src holds a surrogate or a value above U+10FFFF and @flags
+ *     lacks STR_UTF_REPLACE
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_from_utf32(str *self, const char *src, size_t n, int flags)
+{
+	const unsigned char *p = (const unsigned char *)src, *end = p + n;
+	unsigned char *out;
+
+	assert(self != NULL);
+	STR_TRACE(STR_M_FROM_UTF32, n);
+
+	if (n % 4)
+		return -EINVAL;
+	if (n >= 4 && (str_load_u32(p, 0) == 0xFEFF || str_load_u32(p, 1) == 0xFEFF)) {
+		flags = p[0] == 0 ? flags | STR_UTF_BE : flags & ~STR_UTF_BE;
+		p += 4;
+	}
+
+	size_t size = str_utf32_decode(p, end, flags, NULL);
+	if (size == SIZE_MAX)
+		return -EILSEQ;
+
+	int ret = str_transcode_reserve(self, size, &out);
+	if (ret)
+		return ret;
+
+	str_utf32_decode(p, end, flags, out);
+	str_transcode_commit(self, size);
+	return 0;
+}
+
+
+/*
+ * str_from_latin1() - Appends ISO 8859-1 text converted to UTF-8.
+ * @self: Pointer to the Str structure.
+ * @src: Latin-1 bytes, may contain NUL bytes.
+ * @n: Number of bytes at @src.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_from_latin1(str *self, const char *src, size_t n)
+{
+	const unsigned char *p = (const unsigned char *)src, *end = p + n;
+	unsigned char *out;
+
+	assert(self != NULL);
+	STR_TRACE(STR_M_FROM_LATIN1, n);
+
+	size_t size = str_latin1_decode(p, end, NULL);
+	int ret = str_transcode_reserve(self, size, &out);
+	if (ret)
+		return ret;
+
+	str_latin1_decode(p, end, out);
+	str_transcode_commit(self, size);
+	return 0;
+}
+
+
+/*
+ * str_to_utf16() - Appends the contents of @self converted to UTF-16 to @out.
+ * @self: Pointer to the Str structure holding UTF-8.
+ * @out: String receiving the UTF-16 bytes, not @self.
+ * @flags: STR_UTF_BE, STR_UTF_BOM, STR_UTF_REPLACE.
+ *
+ * Code units are written little-endian unless @flags has STR_UTF_BE, after
+ * a byte order mark if it has STR_UTF_BOM. @out->len counts bytes.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EILSEQ if @self is not valid UTF-8 and @flags lacks STR_UTF_REPLACE
+ *    -EPERM if @out is read-only
+ *    -ENOSPC if @out is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_to_utf16(const str *self, str *out, int flags)
+{
+	assert(self != NULL && out != NULL && self != out);
+	STR_TRACE(STR_M_TO_UTF16, self->len);
+
+	const unsigned char *p = (const unsigned char *)self->data, *end = p + self->len;
+	size_t bom = flags & STR_UTF_BOM ? 2 : 0;
+	unsigned char *dst;
+
+	size_t size = str_utf8_encode(p, end, flags, 2, NULL);
+	if (size == SIZE_MAX)
+		return -EILSEQ;
+
+	int ret = str_transcode_reserve(out, bom + size, &dst);
+	if (ret)
+		return ret;
+
+	if (bom)
+		str_store_u16(dst, 0xFEFF, flags & STR_UTF_BE);
+	str_utf8_encode(p, end, flags, 2, dst + bom);
+	str_transcode_commit(out, bom + size);
+	return 0;
+}
+
+
+/*
+ * str_to_utf32() - Appends the contents of @self converted to UTF-32 to @out.
+ * @self: Pointer to the Str structure holding UTF-8.
+ * @out: String receiving the UTF-32 bytes, not @self.
+ * @flags: STR_UTF_BE, STR_UTF_BOM, STR_UTF_REPLACE.
+ *
+ * See str_to_utf16().
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EILSEQ if @self is not valid UTF-8 and @flags lacks STR_UTF_REPLACE
+ *    -EPERM if @out is read-only
+ *    -ENOSPC if @out is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_to_utf32(const str *self, str *out, int flags)
+{
+	assert(self != NULL && out != NULL && self != out);
+	STR_TRACE(STR_M_TO_UTF32, self->len);
+
+	const unsigned char *p = (const unsigned char *)self->data, *end = p + self->len;
+	size_t bom = flags & STR_UTF_BOM ? 4 : 0;
+	unsigned char *dst;
+
+	size_t size = str_utf8_encode(p, end, flags, 4, NULL);
+	if (size == SIZE_MAX)
+		return -EILSEQ;
+
+	int ret = str_transcode_reserve(out, bom + size, &dst);
+	if (ret)
+		return ret;
+
+	if (bom)
+		str_store_u32(dst, 0xFEFF, flags & STR_UTF_BE);
+	str_utf8_encode(p, end, flags, 4, dst + bom);
+	str_transcode_commit(out, bom + size);
+	return 0;
+}
+
+
+/*
+ * str_to_latin1() - Appends the contents of @self converted to ISO 8859-1 to @out.
+ * @self: Pointer to the Str structure holding UTF-8.
+ * @out: String receiving the Latin-1 bytes, not @self.
+ * @flags: STR_UTF_REPLACE.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EILSEQ if @self is not valid UTF-8 or holds characters above U+00FF,
+ *     and @flags lacks STR_UTF_REPLACE
+ *    -EPERM if @out is read-only
+ *    -ENOSPC if @out is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_to_latin1(const str *self, str *out, int flags)
+{
+	assert(self != NULL && out != NULL && self != out);
+	STR_TRACE(STR_M_TO_LATIN1, self->len);
+
+	const unsigned char *p = (const unsigned char *)self->data, *end = p + self->len;
+	unsigned char *dst;
+
+	size_t size = str_latin1_encode(p, end, flags, NULL);
+	if (size == SIZE_MAX)
+		return -EILSEQ;
+
+	int ret = str_transcode_reserve(out, size, &dst);
+	if (ret)
+		return ret;
+
+	str_latin1_encode(p, end, flags, dst);
+	str_transcode_commit(out, size);
+	return 0;
+}
+
+
+/*
+ * str_utf8_valid() - Returns the length of the valid UTF-8 prefix of @n bytes at @s.
+ *
+ * Overlong forms, surrogates and code points above U+10FFFF are invalid.
+ * Runs of ASCII are skipped a vector at a time with SSE2 or AVX2.
+ *
+ * Returns:
+ *     @n if all of @s is valid, otherwise the offset of the first bad sequence
+ */
+size_t str_utf8_valid(const char *s, size_t n)
+{
+	const unsigned char *p = (const unsigned char *)s, *end = p + n;
+
+	while (p < end) {
+#ifdef STR_SIMD_BYTES
+		while (end - p >= STR_SIMD_BYTES && !str_simd_high(str_simd_load((const char *)p)))
+			p += STR_SIMD_BYTES;
+#endif
+		const unsigned char *stop = end - p > 16 ? p + 16 : end;
+		while (p < stop) {
+			uint32_t cp;
+			size_t k = str_utf8_next(p, end, &cp);
+
+			if (k == 0)
+				return (size_t)(p - (const unsigned char *)s);
+			p += k;
+		}
+	}
+	return n;
+}
+
+
+#define STR_NFC	0
+#define STR_NFD	1
+
+/* Returns { canonical combining class, STR_NORM_* flags } of @cp. */
+static inline const uint8_t *str_norm_prop(uint32_t cp)
+{
+	if (cp >= STR_NORM_LIMIT)
+		return str_norm_props[0];
+
+	size_t b = (size_t)str_norm_stage1[cp >> STR_NORM_SHIFT] << STR_NORM_SHIFT;
+	return str_norm_props[str_norm_stage2[b + (cp & ((1u << STR_NORM_SHIFT) - 1))]];
+}
+
+/*
+ * A stable character is a starter that is already in the normalization
+ * form and never combines with what precedes it, so no change can reach
+ * across it: text between two of them is normalized independently.
+ */
+static inline int str_norm_stable(uint32_t cp, int form)
+{
+	const uint8_t *prop = str_norm_prop(cp);
+
+	return prop[0] == 0 && !(prop[1] & (form == STR_NFD ? STR_NORM_NFD_NO :
+					     STR_NORM_NFC_NO | STR_NORM_NFC_MAYBE));
+}
+
+/* Appends the full canonical decomposition of @cp to @w, which has room for four. */
+static size_t str_norm_decompose(uint32_t cp, uint32_t *w)
+{
+	if (cp - 0xAC00 < 11172) {
+		uint32_t s = cp - 0xAC00;
+
+		w[0] = 0x1100 + s / 588;
+		w[1] = 0x1161 + s % 588 / 28;
+		if (s % 28 == 0)
+			return 2;
+		w[2] = 0x11A7 + s % 28;
+		return 3;
+	}
+	if (str_norm_prop(cp)[1] & STR_NORM_NFD_NO) {
+		size_t lo = 0, hi = sizeof(str_nfd_cps) / sizeof(*str_nfd_cps);
+
+		while (lo < hi) {
+			size_t mid = (lo + hi) / 2;
+
+			if (str_nfd_cps[mid] < cp) {
+				lo = mid + 1;
+			} else if (str_nfd_cps[mid] > cp) {
+				hi = mid;
+			} else {
+				const uint32_t *d = str_nfd_data + (str_nfd_index[mid] >> 2);
+				size_t n = (str_nfd_index[mid] & 3) + 1;
+
+				memcpy(w, d, n * sizeof(*w));
+				return n;
+			}
+		}
+	}
+	w[0] = cp;
+	return 1;
+}
+
+/* Returns the primary composite of @a and @b, or 0 if there is none. */
+static uint32_t str_norm_compose(uint32_t a, uint32_t b)
+{
+	if (a - 0x1100 < 19 && b - 0x1161 < 21)
+		return 0xAC00 + ((a - 0x1100) * 21 + (b - 0x1161)) * 28;
+	if (a - 0xAC00 < 11172 && (a - 0xAC00) % 28 == 0 && b - 0x11A8 < 27)
+		return a + (b - 0x11A7);
+
+	size_t lo = 0, hi = sizeof(str_nfc_pairs) / sizeof(*str_nfc_pairs);
+	while (lo < hi) {
+		size_t mid = (lo + hi) / 2;
+		const uint32_t *p = str_nfc_pairs[mid];
+
+		if (p[0] < a || (p[0] == a && p[1] < b))
+			lo = mid + 1;
+		else if (p[0] == a && p[1] == b)
+			return p[2];
+		else
+			hi = mid;
+	}
+	return 0;
+}
+
+struct str_norm_buf {
+	uint32_t *w;
+	size_t	cap;
+};
+
+/*
+ * str_norm_region() - Normalizes @n bytes at @s into @self->w.
+ *
+ * Decomposes, puts combining marks in canonical order and, for NFC,
+ * composes again. @s holds valid UTF-8.
+ *
+ * Returns:
+ *     The number of code points in the result, or 0 if memory allocation fails
+ */
+
+static size_t str_norm_region(struct str_norm_buf *self, const unsigned char *s, size_t n, int form)
+{
+	const unsigned char *p = s, *end = s + n;
+	size_t len = 0;
+
+	// At most four code points per decomposed input byte
+	if (self->cap < 4 * n) {
+		uint32_t *tmp = (uint32_t *)realloc(self->w, 4 * n * sizeof(*tmp));
+		if (!tmp)
+			return 0;
+		self->w = tmp;
+		self->cap = 4 * n;
+	}
+	uint32_t *w = self->w;
+
+	while (p < end) {
+		uint32_t cp = 0;
+
+		p += str_utf8_next(p, end, &cp);
+		len += str_norm_decompose(cp, w + len);
+	}
+
+	// Canonical ordering: a stable insertion sort of each run of marks
+	for (size_t i = 1; i < len; i++) {
+		uint32_t cp = w[i];
+		uint8_t ccc = str_norm_prop(cp)[0];
+		size_t j = i;
+
+		if (ccc == 0)
+			continue;
+		while (j > 0 && str_norm_prop(w[j - 1])[0] > ccc) {
+			w[j] = w[j - 1];
+			j--;
+		}
+		w[j] = cp;
+	}
+	if (form == STR_NFD || len == 0)
+		return len;
+
+	// Canonical composition: a mark joins the last starter unless blocked
+	size_t starter = 0, out = 1;
+	int last = str_norm_prop(w[0])[0] ? 256 : 0;
+
+	for (size_t i = 1; i < len; i++) {
+		uint32_t cp = w[i];
+		int ccc = str_norm_prop(cp)[0];
+		uint32_t c = last < ccc || last == 0 ? str_norm_compose(w[starter], cp) : 0;
+
+		if (c) {
+			w[starter] = c;
+			continue;
+		}
+		if (ccc == 0)
+			starter = out;
+		last = ccc;
+		w[out++] = cp;
+	}
+	return out;
+}
+
+/*
+ * str_adopt() - Replaces the contents of @self with the private buffer of @out.
+ *
+ * A mapping keeps its own buffer and gets the bytes copied in, then @out is
+ * released.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -ENOSPC if @self is a mapping too small for @out
+ */
+static int str_adopt(str *self, str *out)
+{
+	STR_ALLOC_FORGET(out);
+	if (self->flags & STR_F_MAPPED) {
+		if (out->len > self->head + self->cap) {
+			str_clear(out);
+			return -ENOSPC;
+		}
+		memcpy(self->data - self->head, out->data, out->len + 1);
+		self->cap += self->head;
+		self->data -= self->head;
+		self->head = 0;
+		self->len = out->len;
+		self->dwidth = 0;
+		str_clear(out);
+		return 0;
+	}
+
+	str_clear(self);
+	self->data = out->data;
+	self->len = out->len;
+	self->cap = out->cap;
+	self->head = out->head;
+	STR_ALLOC_NOTE(self, out->head + out->cap + 1);
+	return 0;
+}
+
+/*
+ * str_normalize() - Brings @self into normalization form @form.
+ *
+ * The quick check walks the string once, skipping ASCII a vector at a
+ * time and other stable characters one at a time. Only the regions
+ * between stable characters that hold something else are normalized, and
+ * a new buffer is built only once one of them actually changes.
+ */
+static int str_normalize(str *self, int form)
+{
+	if (!self)
+		return -EINVAL;
+	if (self->flags & STR_F_RDONLY)
+		return -EPERM;
+	if (!self->data || self->len == 0)
+		return 0;
+
+	const unsigned char *src = (const unsigned char *)self->data, *end = src + self->len;
+	const unsigned char *p = src, *copied = src, *last_stable = src;
+#ifdef STR_SIMD_BYTES
+	const unsigned char *retry = src;	/* no vector check before this */
+#endif
+	struct str_norm_buf buf = { NULL, 0 };
+	str out;
+	int ret = 0, started = 0;
+
+	memset(&out, 0, sizeof(out));
+
+	while (p < end) {
+#ifdef STR_SIMD_BYTES
+		if (p >= retry && end - p >= STR_SIMD_BYTES) {
+			if (!str_simd_high(str_simd_load((const char *)p))) {
+				p += STR_SIMD_BYTES;
+				last_stable = p - 1;
+				continue;
+			}
+			retry = p + STR_SIMD_BYTES;
+		}
+#endif
+		uint32_t cp;
+		size_t k = str_utf8_next(p, end, &cp);
+
+		if (k == 0) {
+			ret = -EILSEQ;
+			break;
+		}
+		if (str_norm_stable(cp, form)) {
+			last_stable = p;
+			p += k;
+			continue;
+		}
+
+		// The region runs from the last stable character to the next one
+		const unsigned char *start = last_stable > copied ? last_stable : copied;
+		for (p += k; p < end; p += k) {
+			k = str_utf8_next(p, end, &cp);
+			if (k == 0 || str_norm_stable(cp, form))
+				break;
+		}
+		if (p < end && k == 0) {
+			ret = -EILSEQ;
+			break;
+		}
+
+		size_t len = str_norm_region(&buf, start, (size_t)(p - start), form);
+		if (len == 0) {
+			ret = -ENOMEM;
+			break;
+		}
+
+		// Leave regions that come out the same alone
+		unsigned char tmp[4];
+		const unsigned char *q = start;
+		size_t i = 0;
+		for (; i < len; i++) {
+			size_t m = str_utf8_put(tmp, buf.w[i]);
+
+			if ((size_t)(p - q) < m || memcmp(q, tmp, m) != 0)
+				break;
+			q += m;
+		}
+		last_stable = p;
+		if (i == len && q == p)
+			continue;
+
+		ret = str_add_n(&out, (const char *)copied, (size_t)(start - copied));
+		if (!ret)
+			ret = str_grow(&out, 0, out.len + 4 * len);
+		if (ret)
+			break;
+		for (i = 0; i < len; i++)
+			out.len += str_utf8_put((unsigned char *)out.data + out.len, buf.w[i]);
+		copied = p;
+		started = 1;
+	}
+	free(buf.w);
+
+	if (!ret && started)
+		ret = str_add_n(&out, (const char *)copied, (size_t)(end - copied));
+	if (ret || !started) {
+		str_clear(&out);
+		return ret;
+	}
+
+	return str_adopt(self, &out);
+}
+
+
+/*
+ * str_normalize_nfc() - Converts @self to Unicode Normalization Form C.
+ * @self: Pointer to the Str structure holding UTF-8.
+ *
+ * Canonically equivalent strings, such as "e" followed by U+0301 and the
+ * precomposed U+00E9, become byte-for-byte equal, so they match in
+ * str_swap_word() and similar. Text that is already in NFC, as most is, is
+ * only read: one pass, no allocation. See str_normalize().
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self is NULL
+ *    -EILSEQ if @self is not valid UTF-8
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_normalize_nfc(str *self)
+{
+	STR_TRACE(STR_M_NORMALIZE_NFC, self ? self->len : 0);
+	return str_normalize(self, STR_NFC);
+}
+
+
+/*
+ * str_normalize_nfd() - Converts @self to Unicode Normalization Form D.
+ * @self: Pointer to the Str structure holding UTF-8.
+ *
+ * Like str_normalize_nfc(), but leaves every character fully decomposed.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self is NULL
+ *    -EILSEQ if @self is not valid UTF-8
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_normalize_nfd(str *self)
+{
+	STR_TRACE(STR_M_NORMALIZE_NFD, self ? self->len : 0);
+	return str_normalize(self, STR_NFD);
+}
+
+
+/* Returns { Word_Break, Sentence_Break, Extended_Pictographic } of @cp. */
+static inline const uint8_t *str_seg_prop(uint32_t cp)
+{
+	if (cp < STR_SEG_LIMIT) {
+		size_t mid = (size_t)str_seg_stage1[cp >> (STR_SEG_SHIFT2 + STR_SEG_SHIFT3)] << STR_SEG_SHIFT2 |
+			     (cp >> STR_SEG_SHIFT3 & ((1u << STR_SEG_SHIFT2) - 1));
+		size_t leaf = (size_t)str_seg_stage2[mid] << STR_SEG_SHIFT3 | (cp & ((1u << STR_SEG_SHIFT3) - 1));
+
+		return str_seg_props[str_seg_stage3[leaf]];
+	}
+	for (size_t i = 0; i < sizeof(str_seg_high) / sizeof(*str_seg_high); i++)
+		if (cp >= str_seg_high[i][0] && cp <= str_seg_high[i][1])
+			return str_seg_props[str_seg_high[i][2]];
+	return str_seg_props[0];
+}
+
+/* Decodes the character at @p; bytes that are not valid UTF-8 stand alone. */
+static inline const uint8_t *str_seg_next_prop(const unsigned char *p, const unsigned char *end,
+					       size_t *k)
+{
+	uint32_t cp;
+
+	if (*p < 0x80) {
+		*k = 1;
+		return str_seg_props[str_seg_ascii[*p]];
+	}
+	*k = str_utf8_next(p, end, &cp);
+	if (*k == 0) {
+		*k = 1;
+		return str_seg_props[0];
+	}
+	return str_seg_prop(cp);
+}
+
+#define STR_WB_BIT(c)		(1u << STR_WB_##c)
+#define STR_WB_AHLETTER		(STR_WB_BIT(ALETTER) | STR_WB_BIT(HEBREW_LETTER))
+#define STR_WB_MIDNUMLETQ	(STR_WB_BIT(MIDNUMLET) | STR_WB_BIT(SINGLE_QUOTE))
+#define STR_WB_IGNORED		(STR_WB_BIT(EXTEND) | STR_WB_BIT(FORMAT) | STR_WB_BIT(ZWJ))
+
+/*
+ * Word_Break pairs that never break, by the class on the left: rules WB5,
+ * WB7a, WB8 to WB10, WB13, WB13a and WB13b. Rules that look further back or
+ * ahead are applied in str_word_end().
+ */
+static const uint32_t str_wb_keep[STR_WB_COUNT] = {
+	[STR_WB_ALETTER]	= STR_WB_AHLETTER | STR_WB_BIT(NUMERIC) | STR_WB_BIT(EXTENDNUMLET),
+	[STR_WB_HEBREW_LETTER]	= STR_WB_AHLETTER | STR_WB_BIT(NUMERIC) | STR_WB_BIT(EXTENDNUMLET) |
+				  STR_WB_BIT(SINGLE_QUOTE),
+	[STR_WB_NUMERIC]	= STR_WB_AHLETTER | STR_WB_BIT(NUMERIC) | STR_WB_BIT(EXTENDNUMLET),
+	[STR_WB_KATAKANA]	= STR_WB_BIT(KATAKANA) | STR_WB_BIT(EXTENDNUMLET),
+	[STR_WB_EXTENDNUMLET]	= STR_WB_AHLETTER | STR_WB_BIT(NUMERIC) | STR_WB_BIT(KATAKANA) |
+				  STR_WB_BIT(EXTENDNUMLET),
+};
+
+/* ASCII that WB6 to WB13a may join to letters or digits: " ' , . : ; and _ */
+#define STR_WB_ASCII_MID	(1ull << '"' | 1ull << '\'' | 1ull << ',' | 1ull << '.' | \
+				 1ull << ':' | 1ull << ';')
+
+static inline int str_wb_ascii_alnum(unsigned char c)
+{
+	return (unsigned)(c - '0') < 10 || (unsigned)((c | 0x20) - 'a') < 26;
+}
+
+/* Whether a word or a run of spaces certainly ends before the ASCII byte @c. */
+static inline int str_wb_ascii_break(unsigned char c)
+{
+	return c < 0x80 && !str_wb_ascii_alnum(c) && c != '_' && c != ' ' &&
+	       !(c < 64 && (STR_WB_ASCII_MID >> c & 1));
+}
+
+static inline uint32_t str_wb_bit(int c)
+{
+	return c < 0 ? 0 : 1u << c;
+}
+
+/* Word_Break of the first character at or after @p that WB4 does not skip, or -1. */
+static int str_wb_peek(const unsigned char *p, const unsigned char *end)
+{
+	while (p < end) {
+		size_t k;
+		int c = str_seg_next_prop(p, end, &k)[0];
+
+		if (!(STR_WB_IGNORED & (1u << c)))
+			return c;
+		p += k;
+	}
+	return -1;
+}
+
+/* A segment with one of these holds a word rather than spaces or punctuation. */
+static inline int str_seg_wordlike(const uint8_t *prop)
+{
+	return ((STR_WB_AHLETTER | STR_WB_BIT(NUMERIC) | STR_WB_BIT(KATAKANA) |
+		 STR_WB_BIT(EXTENDNUMLET)) & (1u << prop[0])) ||
+	       prop[1] == STR_SB_OLETTER;
+}
+
+/*
+ * str_wb_keep_ctx() - Applies the word boundary rules that need context.
+ * @prev2: Word_Break of the character before @prev, or -1.
+ * @prev: Word_Break of the character before the candidate boundary.
+ * @c: Word_Break of the character after it, at @p.
+ * @ri: Number of Regional_Indicator characters in a row ending at @prev.
+ *
+ * Returns:
+ *     1 if WB6, WB7, WB7b, WB7c, WB11, WB12, WB15 or WB16 rule out a break
+ */
+static int str_wb_keep_ctx(int prev2, int prev, int c, const unsigned char *p,
+			   const unsigned char *end, size_t ri)
+{
+	const uint32_t mid_letter = STR_WB_BIT(MIDLETTER) | STR_WB_MIDNUMLETQ;
+	const uint32_t mid_num = STR_WB_BIT(MIDNUM) | STR_WB_MIDNUMLETQ;
+	size_t k;
+
+	if (c == STR_WB_REGIONAL_INDICATOR)
+		return prev == c && ri % 2;
+	if ((STR_WB_AHLETTER & str_wb_bit(prev2)) && (mid_letter & str_wb_bit(prev)) &&
+	    (STR_WB_AHLETTER & str_wb_bit(c)))
+		return 1;
+	if (prev2 == STR_WB_HEBREW_LETTER && prev == STR_WB_DOUBLE_QUOTE && c == STR_WB_HEBREW_LETTER)
+		return 1;
+	if (prev2 == STR_WB_NUMERIC && (mid_num & str_wb_bit(prev)) && c == STR_WB_NUMERIC)
+		return 1;
+
+	// The rest look past @c
+	if (!((mid_letter | mid_num | STR_WB_BIT(DOUBLE_QUOTE)) & str_wb_bit(c)))
+		return 0;
+	str_seg_next_prop(p, end, &k);
+	int next = str_wb_peek(p + k, end);
+
+	if ((STR_WB_AHLETTER & str_wb_bit(prev)) && (mid_letter & str_wb_bit(c)) &&
+	    (STR_WB_AHLETTER & str_wb_bit(next)))
+		return 1;
+	if (prev == STR_WB_HEBREW_LETTER && c == STR_WB_DOUBLE_QUOTE && next == STR_WB_HEBREW_LETTER)
+		return 1;
+	return prev == STR_WB_NUMERIC && (mid_num & str_wb_bit(c)) && next == STR_WB_NUMERIC;
+}
+
+/*
+ * str_word_end() - Returns the end of the word segment starting at @p.
+ *
+ * Follows the UAX #29 word boundary rules, with str_wb_keep covering the
+ * rules that only look at the pair of characters around a position.
+ */
+static const unsigned char *str_word_end(const unsigned char *p, const unsigned char *end,
+					 int *is_word)
+{
+	size_t k, ri;
+
+	// Plain ASCII words and runs of spaces need no tables
+	if (str_wb_ascii_alnum(*p) || *p == ' ') {
+		const unsigned char *q = p + 1;
+
+		if (*p == ' ') {
+			while (q < end && *q == ' ')
+				q++;
+		} else {
+			while (q < end && str_wb_ascii_alnum(*q))
+				q++;
+		}
+		if (q == end || str_wb_ascii_break(*q) || (*p != ' ' && *q == ' ') ||
+		    (*p == ' ' && *q < 0x80)) {
+			*is_word = *p != ' ';
+			return q;
+		}
+	}
+
+	const uint8_t *prop = str_seg_next_prop(p, end, &k);
+	int prev = prop[0], prev2 = -1, raw = prev;
+
+	*is_word = str_seg_wordlike(prop);
+	ri = prev == STR_WB_REGIONAL_INDICATOR;
+	p += k;
+	if (prev == STR_WB_CR)						// WB3, WB3a
+		return p < end && *p == '\n' ? p + 1 : p;
+	if (prev == STR_WB_LF || prev == STR_WB_NEWLINE)
+		return p;
+
+	while (p < end) {
+		// ASCII letters and digits always join letters and digits (WB5, WB8 to WB10)
+		if (prev == STR_WB_ALETTER || prev == STR_WB_NUMERIC) {
+			const unsigned char *q = p;
+
+			while (q < end && str_wb_ascii_alnum(*q))
+				q++;
+			if (q > p) {
+				prev2 = q - p > 1 ? str_seg_props[str_seg_ascii[q[-2]]][0] : prev;
+				prev = raw = str_seg_props[str_seg_ascii[q[-1]]][0];
+				ri = 0;
+				*is_word = 1;
+				p = q;
+				continue;
+			}
+		}
+
+		prop = str_seg_next_prop(p, end, &k);
+		int c = prop[0];
+
+		if (c == STR_WB_CR || c == STR_WB_LF || c == STR_WB_NEWLINE)	// WB3b
+			return p;
+		if ((raw == STR_WB_ZWJ && prop[2]) ||				// WB3c
+		    (raw == STR_WB_WSEGSPACE && c == STR_WB_WSEGSPACE)) {	// WB3d
+		} else if (STR_WB_IGNORED & (1u << c)) {			// WB4
+			raw = c;
+			p += k;
+			continue;
+		} else if (!(str_wb_keep[prev] & (1u << c)) &&
+			   !str_wb_keep_ctx(prev2, prev, c, p, end, ri)) {
+			return p;						// WB999
+		}
+
+		ri = c == STR_WB_REGIONAL_INDICATOR ? ri + 1 : 0;
+		*is_word |= str_seg_wordlike(prop);
+		prev2 = prev;
+		prev = raw = c;
+		p += k;
+	}
+	return p;
+}
+
+
+#define STR_SB_BIT(c)		(1u << STR_SB_##c)
+#define STR_SB_PARASEP		(STR_SB_BIT(SEP) | STR_SB_BIT(CR) | STR_SB_BIT(LF))
+#define STR_SB_SATERM		(STR_SB_BIT(ATERM) | STR_SB_BIT(STERM))
+
+/* Skips the Extend and Format characters at @p (SB5). */
+static const unsigned char *str_sb_skip(const unsigned char *p, const unsigned char *end)
+{
+	while (p < end) {
+		size_t k;
+		int c = str_seg_next_prop(p, end, &k)[1];
+
+		if (c != STR_SB_EXTEND && c != STR_SB_FORMAT)
+			break;
+		p += k;
+	}
+	return p;
+}
+
+/* Sentence_Break of the character at @p, or -1 at @end. */
+static inline int str_sb_peek(const unsigned char *p, const unsigned char *end, size_t *k)
+{
+	*k = 0;
+	return p < end ? str_seg_next_prop(p, end, k)[1] : -1;
+}
+
+/* SB8: whether a Lower comes before any letter, paragraph or sentence end. */
+static int str_sb_lower_follows(const unsigned char *p, const unsigned char *end)
+{
+	const uint32_t stop = STR_SB_BIT(OLETTER) | STR_SB_BIT(UPPER) | STR_SB_BIT(LOWER) |
+			      STR_SB_PARASEP | STR_SB_SATERM;
+
+	while (p < end) {
+		size_t k;
+		int c = str_seg_next_prop(p, end, &k)[1];
+
+		if (stop & (1u << c))
+			return c == STR_SB_LOWER;
+		p += k;
+	}
+	return 0;
+}
+
+/*
+ * str_sentence_end() - Returns the end of the sentence starting at @p.
+ *
+ * Follows the UAX #29 sentence boundary rules. Only terminators and
+ * paragraph separators can end a sentence, so with SSE2 or AVX2 runs of
+ * ASCII without '.', '!', '?' or line breaks are skipped a vector at a time.
+ */
+static const unsigned char *str_sentence_end(const unsigned char *p, const unsigned char *end)
+{
+	int prev = -1;	/* Sentence_Break of the last character SB5 does not skip */
+	size_t k, nk;
+
+	while (p < end) {
+#ifdef STR_SIMD_BYTES
+		const unsigned char *from = p;
+
+		while (end - p >= STR_SIMD_BYTES) {
+			str_simd v = str_simd_load((const char *)p);
+
+			if (str_simd_high(v) | str_simd_eq(v, str_simd_splat('.')) |
+			    str_simd_eq(v, str_simd_splat('!')) | str_simd_eq(v, str_simd_splat('?')) |
+			    str_simd_eq(v, str_simd_splat('\n')) | str_simd_eq(v, str_simd_splat('\r')))
+				break;
+			p += STR_SIMD_BYTES;
+		}
+		if (p != from)
+			prev = str_seg_props[str_seg_ascii[p[-1]]][1];
+		if (p == end)
+			break;
+#endif
+		int c = str_seg_next_prop(p, end, &k)[1];
+
+		if (c == STR_SB_CR) {						// SB3, SB4
+			p += k;
+			return p < end && *p == '\n' ? p + 1 : p;
+		}
+		if (c == STR_SB_LF || c == STR_SB_SEP)				// SB4
+			return p + k;
+		if ((c == STR_SB_EXTEND || c == STR_SB_FORMAT) && prev >= 0) {	// SB5
+			p += k;
+			continue;
+		}
+		if (!(STR_SB_SATERM & (1u << c))) {
+			prev = c;
+			p += k;
+			continue;
+		}
+
+		// A terminator, then Close* Sp* and maybe a paragraph separator
+		const unsigned char *q = str_sb_skip(p + k, end);
+		int next = str_sb_peek(q, end, &nk), last = c;
+
+		if (c == STR_SB_ATERM && (next == STR_SB_NUMERIC ||				// SB6
+		    (next == STR_SB_UPPER && (prev == STR_SB_UPPER || prev == STR_SB_LOWER)))) {	// SB7
+			prev = c;
+			p = q;
+			continue;
+		}
+		for (; next == STR_SB_CLOSE; next = str_sb_peek(q, end, &nk)) {		// SB9
+			q = str_sb_skip(q + nk, end);
+			last = next;
+		}
+		for (; next == STR_SB_SP; next = str_sb_peek(q, end, &nk)) {		// SB10
+			q = str_sb_skip(q + nk, end);
+			last = next;
+		}
+		if (next == STR_SB_CR)							// SB11
+			return q + 1 < end && q[1] == '\n' ? q + 2 : q + 1;
+		if (next == STR_SB_LF || next == STR_SB_SEP)
+			return q + nk;
+		if ((c == STR_SB_ATERM && str_sb_lower_follows(q, end)) ||		// SB8
+		    (next >= 0 && ((STR_SB_BIT(SCONTINUE) | STR_SB_SATERM) & (1u << next)))) {	// SB8a
+			prev = last;
+			p = q;
+			continue;
+		}
+		return q;								// SB11
+	}
+	return p;
+}
+
+
+/*
+ * str_seg_init() - Starts iterating over the words or sentences of @len bytes at @data.
+ * @self: Iterator to set up.
+ * @data: UTF-8 text, may contain NUL bytes. It must outlive the iteration.
+ * @len: Number of bytes at @data.
+ * @kind: STR_SEG_WORD or STR_SEG_SENTENCE.
+ */
+void str_seg_init(str_seg *self, const char *data, size_t len, int kind)
+{
+	assert(self != NULL);
+
+	self->data = data;
+	self->len = len;
+	self->pos = 0;
+	self->kind = kind;
+	self->is_word = 0;
+}
+
+
+/*
+ * str_seg_next() - Returns the next word or sentence as a view into the text.
+ * @self: Iterator set up with str_seg_init().
+ * @seg: Set to the first byte of the segment.
+ * @n: Set to the length of the segment.
+ *
+ * Boundaries follow the default rules of Unicode Standard Annex #29, driven
+ * by Word_Break and Sentence_Break tables generated from the Unicode
+ * Character Database (see tools/gen_unicode.py). Segments cover the text
+ * without gaps: word segments include runs of spaces and single punctuation
+ * marks, for which @self->is_word is 0, and sentences include their trailing
+ * spaces and line break. Nothing is allocated. Bytes that are not valid
+ * UTF-8 are taken one at a time as characters with no special properties.
+ *
+ * Returns:
+ *     1 if a segment was returned, 0 at the end of the text
+ */
+int str_seg_next(str_seg *self, const char **seg, size_t *n)
+{
+	assert(self != NULL && seg != NULL && n != NULL);
+
+	if (self->pos >= self->len)
+		return 0;
+
+	const unsigned char *p = (const unsigned char *)self->data + self->pos;
+	const unsigned char *end = (const unsigned char *)self->data + self->len, *stop;
+
+	if (self->kind == STR_SEG_SENTENCE) {
+		stop = str_sentence_end(p, end);
+		self->is_word = 0;
+	} else {
+		stop = str_word_end(p, end, &self->is_word);
+	}
+	*seg = (const char *)p;
+	*n = (size_t)(stop - p);
+	self->pos += *n;
+	return 1;
+}
+
+/*
+ * Measures the whole lines the two texts share at the start (@pre bytes)
+ * and at the end (@suf bytes), which the line diff can leave out.
+ */
+static void str_diff_trim(const char *a, size_t na, const char *b, size_t nb, size_t *pre, size_t *suf)
+{
+	size_t max = na < nb ? na : nb, p = 0, s = 0;
+
+	while (p < max && a[p] == b[p])
+		p++;
+	if (p < na || p < nb)
+		while (p > 0 && a[p - 1] != '\n')
+			p--;
+
+	max -= p;
+	while (s < max && a[na - 1 - s] == b[nb - 1 - s])
+		s++;
+	if (!((na - s == p || a[na - s - 1] == '\n') && (nb - s == p || b[nb - s - 1] == '\n'))) {
+		// Start at the first line boundary inside the suffix
+		const char *nl = s ? (const char *)memchr(a + na - s, '\n', s) : NULL;
+
+		s = nl ? (size_t)(a + na - nl - 1) : 0;
+	}
+	*pre = p;
+	*suf = s;
+}
+
+/* Splits bytes @off to @n at @s into lines, each with its '\n', storing their offsets in @offs if set. */
+static size_t str_diff_lines(const char *s, size_t off, size_t n, size_t *offs)
+{
+	size_t count = 0;
+
+	while (off < n) {
+		const char *nl = (const char *)memchr(s + off, '\n', n - off);
+
+		if (offs)
+			offs[count] = off;
+		count++;
+		off = nl ? (size_t)(nl - s) + 1 : n;
+	}
+	if (offs)
+		offs[count] = n;
+	return count;
+}
+
+/* Lowercases the ASCII letters among eight bytes at once. */
+static inline uint64_t str_fold8(uint64_t v)
+{
+	uint64_t low = v & 0x7F7F7F7F7F7F7F7Full;
+	uint64_t upper = (low + 0x3F3F3F3F3F3F3F3Full) & ~(low + 0x2525252525252525ull) &
+			 ~v & 0x8080808080808080ull;
+
+	return v | upper >> 2;
+}
+
+/* Hashes @n bytes at @p, as if their ASCII letters were lowercase if @fold is set. */
+static inline uint64_t str_hash64_fold(const char *p, size_t n, int fold)
+{
+	uint64_t h = n * 0x9E3779B97F4A7C15ull, v;
+
+	for (; n >= 8; n -= 8, p += 8) {
+		memcpy(&v, p, sizeof(v));
+		if (fold)
+			v = str_fold8(v);
+		h = (h ^ v) * 0xBF58476D1CE4E5B9ull;
+		h ^= h >> 31;
+	}
+	v = 0;
+	memcpy(&v, p, n);
+	if (fold)
+		v = str_fold8(v);
+	h = (h ^ v) * 0x94D049BB133111EBull;
+	return h ^ h >> 29;
+}
+
+static uint64_t str_hash64(const char *p, size_t n)
+{
+	return str_hash64_fold(p, n, 0);
+}
+
+/*
+ * Numbers the @n lines of both texts, the first @na of which come from @a,
+ * so that two lines get the same number exactly when they hold the same
+ * bytes. @offs holds the line offsets of @a, then those of @b.
+ */
+static int str_diff_intern(const char *a, const char *b, const size_t *offs, size_t na, size_t n,
+			   uint32_t *ids)
+{
+	size_t cap = 16;
+
+	while (cap < 2 * n)
+		cap *= 2;
+
+	/* Top half of the hash, then 1 + the first line with it, 0 if free */
+	uint32_t (*slots)[2] = (uint32_t (*)[2])calloc(cap, sizeof(*slots));
+
+	if (!slots)
+		return -ENOMEM;
+	for (size_t g = 0; g < n; g++) {
+		// Line g of the combined list; the second text's offsets follow the first's end
+		const size_t *o = g < na ? offs + g : offs + g + 1;
+		const char *p = (g < na ? a : b) + o[0];
+		size_t len = o[1] - o[0];
+		uint64_t h = str_hash64(p, len);
+		size_t i = (size_t)h & (cap - 1);
+
+		for (;; i = (i + 1) & (cap - 1)) {
+			if (!slots[i][1]) {
+				slots[i][0] = (uint32_t)(h >> 32);
+				slots[i][1] = (uint32_t)g + 1;
+				ids[g] = (uint32_t)g;
+				break;
+			}
+
+			size_t f = slots[i][1] - 1;
+			const size_t *fo = f < na ? offs + f : offs + f + 1;
+
+			if (slots[i][0] == (uint32_t)(h >> 32) && fo[1] - fo[0] == len &&
+			    !memcmp((f < na ? a : b) + fo[0], p, len)) {
+				ids[g] = (uint32_t)f;
+				break;
+			}
+		}
+	}
+	free(slots);
+	return 0;
+}
+
+struct str_diff_ctx {
+	const unsigned char *a, *b;	/* the texts, compared bytewise */
+	const uint32_t *ia, *ib;	/* or their line numbers, if set */
+	ptrdiff_t *fd, *bd;		/* furthest x on each diagonal x - y, forward and backward */
+	uint8_t *da, *db;		/* set for deleted and inserted tokens */
+};
+
+static inline int str_diff_eq(const struct str_diff_ctx *c, ptrdiff_t x, ptrdiff_t y)
+{
+	return c->ia ? c->ia[x] == c->ib[y] : c->a[x] == c->b[y];
+}
+
+/*
+ * str_diff_split() - Finds the middle snake of a shortest edit script.
+ *
+ * Extends the furthest reaching D-paths forward from (@xoff, @yoff) and
+ * backward from (@xlim, @ylim) in turn until they overlap (Myers 1986,
+ * section 4b). The overlapping point lies on a shortest edit script, so the
+ * two halves can be solved on their own in O(N + M) space. Both corners are
+ * expected to start with a mismatch.
+ */
+static void str_diff_split(const struct str_diff_ctx *c, ptrdiff_t xoff, ptrdiff_t xlim,
+			   ptrdiff_t yoff, ptrdiff_t ylim, ptrdiff_t *xmid, ptrdiff_t *ymid)
+{
+	ptrdiff_t *fd = c->fd, *bd = c->bd;
+	const ptrdiff_t dmin = xoff - ylim, dmax = xlim - yoff;
+	const ptrdiff_t fmid = xoff - yoff, bmid = xlim - ylim;
+	ptrdiff_t fmin = fmid, fmax = fmid, bmin = bmid, bmax = bmid;
+	const int odd = (fmid - bmid) & 1;
+
+	fd[fmid] = xoff;
+	bd[bmid] = xlim;
+	for (;;) {
+		if (fmin > dmin)
+			fd[--fmin - 1] = -1;
+		else
+			fmin++;
+		if (fmax < dmax)
+			fd[++fmax + 1] = -1;
+		else
+			fmax--;
+		for (ptrdiff_t d = fmax; d >= fmin; d -= 2) {
+			ptrdiff_t lo = fd[d - 1], hi = fd[d + 1];
+			ptrdiff_t x = lo >= hi ? lo + 1 : hi, y = x - d;
+
+			while (x < xlim && y < ylim && str_diff_eq(c, x, y))
+				x++, y++;
+			fd[d] = x;
+			if (odd && bmin <= d && d <= bmax && bd[d] <= x) {
+				*xmid = x;
+				*ymid = y;
+				return;
+			}
+		}
+
+		if (bmin > dmin)
+			bd[--bmin - 1] = PTRDIFF_MAX;
+		else
+			bmin++;
+		if (bmax < dmax)
+			bd[++bmax + 1] = PTRDIFF_MAX;
+		else
+			bmax--;
+		for (ptrdiff_t d = bmax; d >= bmin; d -= 2) {
+			ptrdiff_t lo = bd[d - 1], hi = bd[d + 1];
+			ptrdiff_t x = lo < hi ? lo : hi - 1, y = x - d;
+
+			while (x > xoff && y > yoff && str_diff_eq(c, x - 1, y - 1))
+				x--, y--;
+			bd[d] = x;
+			if (!odd && fmin <= d && d <= fmax && x <= fd[d]) {
+				*xmid = x;
+				*ymid = y;
+				return;
+			}
+		}
+	}
+}
+
+/* Marks the tokens a shortest edit script deletes from a[@xoff, @xlim) and inserts from b[@yoff, @ylim). */
+static void str_diff_seq(const struct str_diff_ctx *c, ptrdiff_t xoff, ptrdiff_t xlim,
+			 ptrdiff_t yoff, ptrdiff_t ylim)
+{
+	for (;;) {
+		while (xoff < xlim && yoff < ylim && str_diff_eq(c, xoff, yoff))
+			xoff++, yoff++;
+		while (xoff < xlim && yoff < ylim && str_diff_eq(c, xlim - 1, ylim - 1))
+			xlim--, ylim--;
+
+		if (xoff == xlim) {
+			memset(c->db + yoff, 1, (size_t)(ylim - yoff));
+			return;
+		}
+		if (yoff == ylim) {
+			memset(c->da + xoff, 1, (size_t)(xlim - xoff));
+			return;
+		}
+
+		ptrdiff_t xmid, ymid;
+
+		str_diff_split(c, xoff, xlim, yoff, ylim, &xmid, &ymid);
+		str_diff_seq(c, xoff, xmid, yoff, ymid);
+		xoff = xmid;
+		yoff = ymid;
+	}
+}
+
+/*
+ * Runs str_diff_seq() on the lines numbered in @ids, leaving out those found
+ * in only one of the texts. Such lines are edited by every script, and
+ * between two revisions of a document most edited lines are of this kind,
+ * so the search is left with far fewer differences.
+ */
+static int str_diff_seq_lines(const struct str_diff_ctx *c, uint32_t *ids, size_t na, size_t nb)
+{
+	size_t n = na + nb, ka = 0, kb = 0;
+	uint8_t *seen = (uint8_t *)calloc(n + 1, 1);	/* by line number: 1 in a, 2 in b */
+	uint32_t *map = (uint32_t *)malloc((n + 1) * sizeof(uint32_t));
+
+	if (!seen || !map) {
+		free(seen);
+		free(map);
+		return -ENOMEM;
+	}
+	for (size_t i = 0; i < n; i++)
+		seen[ids[i]] |= i < na ? 1 : 2;
+
+	// Compact both texts in place, remembering where each kept line came from
+	for (size_t i = 0; i < na; i++) {
+		if (seen[ids[i]] == 3) {
+			ids[ka] = ids[i];
+			map[ka++] = (uint32_t)i;
+		} else {
+			c->da[i] = 1;
+		}
+	}
+	for (size_t j = 0; j < nb; j++) {
+		if (seen[ids[na + j]] == 3) {
+			ids[na + kb] = ids[na + j];
+			map[na + kb++] = (uint32_t)j;
+		} else {
+			c->db[j] = 1;
+		}
+	}
+
+	// Search with marks of their own, then carry them back
+	struct str_diff_ctx k = *c;
+
+	memset(seen, 0, n + 1);
+	k.da = seen;
+	k.db = seen + na;
+	str_diff_seq(&k, 0, (ptrdiff_t)ka, 0, (ptrdiff_t)kb);
+	for (size_t i = 0; i < ka; i++)
+		c->da[map[i]] |= k.da[i];
+	for (size_t j = 0; j < kb; j++)
+		c->db[map[na + j]] |= k.db[j];
+
+	free(seen);
+	free(map);
+	return 0;
+}
+
+/* Turns runs of marked tokens into hunks: counts them, then fills them in. */
+static int str_diff_script(str_edit *self, const struct str_diff_ctx *c, size_t na, size_t nb,
+			   const size_t *ao, const size_t *bo, const char *b)
+{
+	for (int pass = 0; pass < 2; pass++) {
+		size_t i = 0, j = 0, count = 0, bytes = 0;
+
+		while (i < na || j < nb) {
+			if (!(i < na && c->da[i]) && !(j < nb && c->db[j])) {
+				i++;
+				j++;
+				continue;
+			}
+
+			size_t i0 = i, j0 = j;
+
+			while (i < na && c->da[i])
+				i++;
+			while (j < nb && c->db[j])
+				j++;
+
+			size_t b_off = bo ? bo[j0] : j0, b_len = (bo ? bo[j] : j) - b_off;
+
+			if (pass) {
+				struct str_hunk *h = &self->hunks[count];
+
+				h->a_off = ao ? ao[i0] : i0;
+				h->a_len = (ao ? ao[i] : i) - h->a_off;
+				h->b_off = b_off;
+				h->b_len = b_len;
+				memcpy(self->text + bytes, b + b_off, b_len);
+			}
+			count++;
+			bytes += b_len;
+		}
+
+		if (pass) {
+			self->len = count;
+		} else {
+			self->hunks = (struct str_hunk *)malloc((count + 1) * sizeof(struct str_hunk));
+			self->text = (char *)malloc(bytes + 1);
+			if (!self->hunks || !self->text)
+				return -ENOMEM;
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * str_diff() - Computes an edit script that turns @a into @b.
+ * @a: The old text.
+ * @b: The new text.
+ * @mode: STR_DIFF_LINES or STR_DIFF_BYTES.
+ *
+ * Uses Myers' O(ND) algorithm with the linear space refinement, so time
+ * grows with the size of the texts times the number of differences D, and
+ * memory with the size of the texts alone. In STR_DIFF_LINES mode each line
+ * is hashed once and equal lines are given the same number, so the search
+ * compares integers. The script does not reference @a or @b and holds the
+ * inserted bytes itself (see str_edit). The caller is responsible for
+ * freeing it using str_edit_free().
+ *
+ * Returns:
+ *     A pointer to the edit script, or NULL on failure (errno is set to
+ *     EINVAL for a bad argument, or ENOMEM)
+ */
+str_edit *str_diff(const str *a, const str *b, int mode)
+{
+	if (!a || !b || (mode != STR_DIFF_LINES && mode != STR_DIFF_BYTES)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	STR_TRACE(STR_M_DIFF, a->len + b->len);
+
+	const char *ad = a->data ? a->data : "", *bd = b->data ? b->data : "";
+	size_t na = a->len, nb = b->len, pre = 0, suf = 0;
+
+	if (mode == STR_DIFF_LINES) {
+		str_diff_trim(ad, a->len, bd, b->len, &pre, &suf);
+		na = str_diff_lines(ad, pre, a->len - suf, NULL);
+		nb = str_diff_lines(bd, pre, b->len - suf, NULL);
+	}
+
+	size_t n = na + nb;
+	str_edit *self = (str_edit *)calloc(1, sizeof(*self));
+	ptrdiff_t *diag = n < PTRDIFF_MAX / 4 / sizeof(ptrdiff_t) ?
+			  (ptrdiff_t *)malloc(2 * (n + 3) * sizeof(ptrdiff_t)) : NULL;
+	uint8_t *marks = (uint8_t *)calloc(n + 1, 1);
+	size_t *offs = NULL;
+	uint32_t *ids = NULL;
+	int ret = self && diag && marks ? 0 : -ENOMEM;
+
+	if (!ret && mode == STR_DIFF_LINES) {
+		offs = (size_t *)malloc((n + 2) * sizeof(size_t));
+		ids = (uint32_t *)malloc((n + 1) * sizeof(uint32_t));
+		if (!offs || !ids || n >= UINT32_MAX) {
+			ret = -ENOMEM;
+		} else {
+			str_diff_lines(ad, pre, a->len - suf, offs);
+			str_diff_lines(bd, pre, b->len - suf, offs + na + 1);
+			ret = str_diff_intern(ad, bd, offs, na, n, ids);
+		}
+	}
+	if (!ret) {
+		struct str_diff_ctx c = {
+			(const unsigned char *)ad, (const unsigned char *)bd,
+			ids, ids ? ids + na : NULL,
+			diag + nb + 1, diag + (n + 3) + nb + 1,
+			marks, marks + na,
+		};
+
+		if (ids)
+			ret = str_diff_seq_lines(&c, ids, na, nb);
+		else
+			str_diff_seq(&c, 0, (ptrdiff_t)na, 0, (ptrdiff_t)nb);
+		if (!ret)
+			ret = str_diff_script(self, &c, na, nb, offs, offs ? offs + na + 1 : NULL, bd);
+	}
+	free(diag);
+	free(marks);
+	free(offs);
+	free(ids);
+
+	if (ret) {
+		str_edit_free(self);
+		errno = -ret;
+		return NULL;
+	}
+	self->a_size = a->len;
+	self->b_size = b->len;
+	self->a_hash = str_hash64(ad, a->len);
+	return self;
+}
+
+
+/*
+ * str_patch() - Applies an edit script made by str_diff().
+ * @self: Pointer to the Str structure holding the old text.
+ * @edit: The edit script.
+ *
+ * The new text is assembled in a single allocation of its final size and
+ * then replaces the contents of @self.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self does not hold the text the script was made from
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_patch(str *self, const str_edit *edit)
+{
+	if (!self || !edit)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_PATCH, edit->b_size);
+
+	if (self->flags & STR_F_RDONLY)
+		return -EPERM;
+
+	const char *src = self->data ? self->data : "";
+
+	if (self->len != edit->a_size || str_hash64(src, self->len) != edit->a_hash)
+		return -EINVAL;
+
+	str out;
+	memset(&out, 0, sizeof(out));
+
+	int ret = str_grow(&out, 0, edit->b_size);
+	if (ret)
+		return ret;
+
+	const char *text = edit->text;
+	char *dst = out.data;
+	size_t from = 0;
+
+	for (size_t i = 0; i < edit->len; i++) {
+		const struct str_hunk *h = &edit->hunks[i];
+
+		memcpy(dst, src + from, h->a_off - from);
+		dst += h->a_off - from;
+		memcpy(dst, text, h->b_len);
+		dst += h->b_len;
+		text += h->b_len;
+		from = h->a_off + h->a_len;
+	}
+	memcpy(dst, src + from, edit->a_size - from);
+	out.len = edit->b_size;
+	out.data[out.len] = '\0';
+	return str_adopt(self, &out);
+}
+
+
+/*
+ * It releases @edit.
+ */
+void str_edit_free(str_edit *edit)
+{
+	if (edit) {
+		free(edit->hunks);
+		free(edit->text);
+		free(edit);
+	}
+}
+
+/* Position of the first '$' in [@p, @end), or NULL. */
+static const char *str_tmpl_dollar(const char *p, const char *end)
+{
+#ifdef STR_SIMD_BYTES
+	const str_simd dollar = str_simd_splat('$');
+
+	for (; end - p >= STR_SIMD_BYTES; p += STR_SIMD_BYTES) {
+		uint32_t mask = str_simd_eq(str_simd_load(p), dollar);
+
+		if (mask)
+			return p + __builtin_ctz(mask);
+	}
+#endif
+	return (const char *)memchr(p, '$', (size_t)(end - p));
+}
+
+/*
+ * Finds the ${name} markers in @n bytes at @s, storing the first @max of
+ * them in @vars. Returns the number found.
+ */
+static size_t str_tmpl_scan(const char *s, size_t n, struct str_tmpl_var *vars, size_t max)
+{
+	const char *p = s, *end = s + n;
+	size_t count = 0;
+
+	while ((p = str_tmpl_dollar(p, end)) != NULL) {
+		if (end - p < 3 || p[1] != '{') {
+			p++;
+			continue;
+		}
+
+		const char *close = (const char *)memchr(p + 2, '}', (size_t)(end - p - 2));
+		if (!close)
+			break;
+		if (count < max) {
+			vars[count].off = (size_t)(p - s);
+			vars[count].len = (size_t)(close + 1 - p);
+		}
+		count++;
+		p = close + 1;
+	}
+	return count;
+}
+
+/*
+ * Appends @len bytes of @text to @out with the @count markers in @vars
+ * replaced. Every name is looked up once; the sizes are summed first, so
+ * @out grows at most once.
+ */
+static int str_tmpl_expand(const char *text, size_t len, const struct str_tmpl_var *vars,
+			   size_t count, str *out, str_lookup_fn lookup, void *ctx)
+{
+	struct str_tmpl_val {
+		const char *p;
+		size_t	n;
+	} stack[32], *vals = stack;
+	size_t size = len;
+
+	if (count > sizeof(stack) / sizeof(stack[0])) {
+		vals = (struct str_tmpl_val *)malloc(count * sizeof(*vals));
+		if (!vals)
+			return -ENOMEM;
+	}
+	for (size_t i = 0; i < count; i++) {
+		const char *name = text + vars[i].off;
+
+		vals[i].p = lookup(ctx, name + 2, vars[i].len - 3, &vals[i].n);
+		if (!vals[i].p) {
+			vals[i].p = name;	/* unknown names stay as they are */
+			vals[i].n = vars[i].len;
+		}
+		size += vals[i].n - vars[i].len;
+	}
+
+	int ret = size > SIZE_MAX - 1 - out->len ? -ENOMEM : str_grow(out, 0, out->len + size);
+
+	if (!ret) {
+		char *dst = out->data + out->len;
+		size_t from = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			memcpy(dst, text + from, vars[i].off - from);
+			dst += vars[i].off - from;
+			memcpy(dst, vals[i].p, vals[i].n);
+			dst += vals[i].n;
+			from = vars[i].off + vars[i].len;
+		}
+		memcpy(dst, text + from, len - from);
+		out->len += size;
+		out->data[out->len] = '\0';
+	}
+	if (vals != stack)
+		free(vals);
+	return ret;
+}
+
+
+/*
+ * str_expand() - Replaces the ${name} markers in @self.
+ * @self: Pointer to the Str structure.
+ * @lookup: Returns the value of a name (not NUL-terminated) and sets its
+ *	    length, or returns NULL for names that are not defined.
+ * @ctx: Passed to @lookup.
+ *
+ * A name runs from "${" to the next '}'. Markers with an undefined name are
+ * left in place, and values are not scanned again. Markers are found with a
+ * vector search for '$', each name is looked up once, and the result is
+ * written into a single buffer of its final size. Templates expanded many
+ * times are better compiled once with str_tmpl_init().
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self or @lookup is NULL
+ *    -EPERM if @self is read-only
+ *    -ENOSPC if @self is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_expand(str *self, str_lookup_fn lookup, void *ctx)
+{
+	if (!self || !lookup)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_EXPAND, self->len);
+
+	if (self->flags & STR_F_RDONLY)
+		return -EPERM;
+	if (!self->data)
+		return 0;
+
+	struct str_tmpl_var stack[32], *vars = stack;
+	size_t max = sizeof(stack) / sizeof(stack[0]);
+	size_t count = str_tmpl_scan(self->data, self->len, vars, max);
+
+	if (count == 0)
+		return 0;
+	if (count > max) {
+		vars = (struct str_tmpl_var *)malloc(count * sizeof(*vars));
+		if (!vars)
+			return -ENOMEM;
+		str_tmpl_scan(self->data, self->len, vars, count);
+	}
+
+	str out;
+	memset(&out, 0, sizeof(out));
+
+	int ret = str_tmpl_expand(self->data, self->len, vars, count, &out, lookup, ctx);
+
+	if (vars != stack)
+		free(vars);
+	if (ret) {
+		str_clear(&out);
+		return ret;
+	}
+	return str_adopt(self, &out);
+}
+
+
+/*
+ * str_tmpl_init() - Compiles a template with ${name} markers.
+ * @s: The template text; it is copied.
+ * @n: Number of bytes at @s.
+ *
+ * The markers are found once, so str_tmpl_render() goes straight to
+ * looking up the names and copying. The caller is responsible for freeing
+ * the template using str_tmpl_free().
+ *
+ * Returns:
+ *     A pointer to the template, or NULL on failure (errno is set to
+ *     EINVAL if @s is NULL, or ENOMEM)
+ */
+str_tmpl *str_tmpl_init(const char *s, size_t n)
+{
+	if (!s) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	size_t count = str_tmpl_scan(s, n, NULL, 0);
+	str_tmpl *self = (str_tmpl *)calloc(1, sizeof(*self));
+
+	if (!self || !(self->text = (char *)malloc(n + 1)) ||
+	    !(self->vars = (struct str_tmpl_var *)malloc((count + 1) * sizeof(struct str_tmpl_var)))) {
+		str_tmpl_free(self);
+		errno = ENOMEM;
+		return NULL;
+	}
+	memcpy(self->text, s, n);
+	self->text[n] = '\0';
+	self->len = n;
+	self->count = str_tmpl_scan(s, n, self->vars, count);
+	return self;
+}
+
+
+/*
+ * str_tmpl_render() - Appends a template with its markers replaced.
+ * @self: Template made by str_tmpl_init().
+ * @out: Pointer to the Str structure to append to.
+ * @lookup: As for str_expand().
+ * @ctx: Passed to @lookup.
+ *
+ * @out grows at most once. The template is not modified, so it may be
+ * rendered from several threads at once.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if an argument is NULL
+ *    -EPERM if @out is read-only
+ *    -ENOSPC if @out is a mapping too small for the result
+ *    -ENOMEM if memory allocation fails
+ */
+int str_tmpl_render(const str_tmpl *self, str *out, str_lookup_fn lookup, void *ctx)
+{
+	if (!self || !out || !lookup)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_TMPL_RENDER, self->len);
+	return str_tmpl_expand(self->text, self->len, self->vars, self->count, out, lookup, ctx);
+}
+
+
+/*
+ * It releases @tmpl.
+ */
+void str_tmpl_free(str_tmpl *tmpl)
+{
+	if (tmpl) {
+		free(tmpl->text);
+		free(tmpl->vars);
+		free(tmpl);
+	}
+}
+
+/* Bit i is set where byte i of the 64 at @p is @a, @b, @c or @d. */
+static inline uint64_t str_kv_mask(const char *p, char a, char b, char c, char d)
+{
+	uint64_t m = 0;
+#ifdef STR_SIMD_BYTES
+	const str_simd va = str_simd_splat(a), vb = str_simd_splat(b);
+	const str_simd vc = str_simd_splat(c), vd = str_simd_splat(d);
+
+	for (int i = 0; i < 64; i += STR_SIMD_BYTES) {
+		str_simd v = str_simd_load(p + i);
+
+		m |= (uint64_t)(str_simd_eq(v, va) | str_simd_eq(v, vb) |
+				str_simd_eq(v, vc) | str_simd_eq(v, vd)) << i;
+	}
+#else
+	for (int i = 0; i < 64; i++)
+		m |= (uint64_t)(p[i] == a || p[i] == b || p[i] == c || p[i] == d) << i;
+#endif
+	return m;
+}
+
+/* str_kv_mask() for the block at @p, of which only @left bytes may be read. */
+static inline uint64_t str_kv_block(const char *p, size_t left, char a, char b, char c, char d)
+{
+	if (left >= 64)
+		return str_kv_mask(p, a, b, c, d);
+
+	char tmp[64] = { 0 };
+
+	memcpy(tmp, p, left);
+	return str_kv_mask(tmp, a, b, c, d) & ((1ull << left) - 1);
+}
+
+static inline void str_kv_put(struct str_kv *out, size_t max, size_t *count, const char *s,
+			      size_t ks, size_t ke, size_t vs, size_t ve, int quoted)
+{
+	if (*count < max) {
+		out[*count].key = s + ks;
+		out[*count].key_len = ke - ks;
+		out[*count].val = s + vs;
+		out[*count].val_len = ve - vs;
+		out[*count].quoted = quoted;
+	}
+	(*count)++;
+}
+
+
+/*
+ * str_parse_logfmt() - Splits a logfmt line into key/value views.
+ * @s: The line; a trailing "\n" or "\r\n" is ignored.
+ * @n: Number of bytes at @s.
+ * @out: Receives the pairs, pointing into @s.
+ * @max: Number of pairs @out can hold.
+ *
+ * Pairs are separated by spaces. A key without '=' has an empty value,
+ * and a value in double quotes may hold spaces and backslash escapes; it
+ * is returned without the quotes, escapes undecoded, with @quoted set.
+ * The delimiters of 64 bytes at a time are found with SSE2 or AVX2 as a
+ * bitmask, then walked bit by bit. Nothing is allocated.
+ *
+ * Returns:
+ *     The number of pairs on successful completion
+ *    -EINVAL if a quoted value is not closed or @s is NULL
+ *    -ENOSPC if the line holds more than @max pairs (@out holds the first @max)
+ */
+int str_parse_logfmt(const char *s, size_t n, struct str_kv *out, size_t max)
+{
+	if (!s || (!out && max))
+		return -EINVAL;
+
+	STR_TRACE(STR_M_PARSE_LOGFMT, n);
+
+	while (n && (s[n - 1] == '\n' || s[n - 1] == '\r'))
+		n--;
+
+	enum { KEY, VALUE, QUOTED } state = KEY;
+	size_t ks = 0, ke = 0, vs = 0, skip = 0, count = 0;
+
+	for (size_t base = 0; base < n; base += 64) {
+		uint64_t m = str_kv_block(s + base, n - base, ' ', '=', '"', '\\');
+
+		for (; m; m &= m - 1) {
+			size_t i = base + (size_t)__builtin_ctzll(m);
+			char c = s[i];
+
+			if (state == KEY) {
+				if (c == ' ') {
+					if (i > ks)
+						str_kv_put(out, max, &count, s, ks, i, i, i, 0);
+					ks = i + 1;
+				} else if (c == '=') {
+					ke = i;
+					vs = i + 1;
+					state = VALUE;
+				}
+			} else if (state == VALUE) {
+				if (c == ' ') {
+					if (ke > ks)
+						str_kv_put(out, max, &count, s, ks, ke, vs, i, 0);
+					ks = i + 1;
+					state = KEY;
+				} else if (c == '"' && i == vs) {
+					vs = i + 1;
+					state = QUOTED;
+				}
+			} else if (i >= skip) {
+				if (c == '\\') {
+					skip = i + 2;	/* the escaped byte is not a delimiter */
+				} else if (c == '"') {
+					if (ke > ks)
+						str_kv_put(out, max, &count, s, ks, ke, vs, i, 1);
+					ks = i + 1;
+					state = KEY;
+				}
+			}
+		}
+	}
+
+	if (state == QUOTED)
+		return -EINVAL;
+	if (state == VALUE && ke > ks)
+		str_kv_put(out, max, &count, s, ks, ke, vs, n, 0);
+	else if (state == KEY && n > ks)
+		str_kv_put(out, max, &count, s, ks, n, n, n, 0);
+	return count > max ? -ENOSPC : (int)count;
+}
+
+
+/*
+ * str_parse_headers() - Splits an HTTP header block into name/value views.
+ * @s: The header lines, after the request or status line.
+ * @n: Number of bytes at @s.
+ * @out: Receives the fields, pointing into @s.
+ * @max: Number of fields @out can hold.
+ * @used: Set to the length of the block, including the empty line that ends it.
+ *
+ * Lines end in "\r\n" or "\n". Values are stripped of surrounding spaces
+ * and tabs; @quoted is always 0 since quoted strings do not change where a
+ * field ends. Like str_parse_logfmt(), the ':' and '\n' of 64 bytes at a
+ * time are found as a bitmask. Nothing is allocated.
+ *
+ * Returns:
+ *     The number of fields on successful completion
+ *    -EAGAIN if @s does not hold the whole block yet
+ *    -EINVAL if a line has no ':', an empty name, whitespace before the ':'
+ *            or starts with whitespace (obsolete line folding)
+ *    -ENOSPC if the block holds more than @max fields (@out holds the first @max)
+ */
+int str_parse_headers(const char *s, size_t n, struct str_kv *out, size_t max, size_t *used)
+{
+	if (!s || !used || (!out && max))
+		return -EINVAL;
+
+	STR_TRACE(STR_M_PARSE_HEADERS, n);
+
+	size_t ls = 0, colon = SIZE_MAX, count = 0;
+
+	for (size_t base = 0; base < n; base += 64) {
+		uint64_t m = str_kv_block(s + base, n - base, ':', '\n', ':', '\n');
+
+		for (; m; m &= m - 1) {
+			size_t i = base + (size_t)__builtin_ctzll(m);
+
+			if (s[i] == ':') {
+				if (colon == SIZE_MAX)
+					colon = i;
+				continue;
+			}
+
+			size_t le = i > ls && s[i - 1] == '\r' ? i - 1 : i;
+			if (le == ls) {
+				*used = i + 1;
+				return count > max ? -ENOSPC : (int)count;
+			}
+			if (colon > le || colon == ls || s[ls] == ' ' || s[ls] == '\t' ||
+			    s[colon - 1] == ' ' || s[colon - 1] == '\t')
+				return -EINVAL;
+
+			size_t vs = colon + 1, ve = le;
+			while (vs < ve && (s[vs] == ' ' || s[vs] == '\t'))
+				vs++;
+			while (ve > vs && (s[ve - 1] == ' ' || s[ve - 1] == '\t'))
+				ve--;
+			str_kv_put(out, max, &count, s, ls, colon, vs, ve, 0);
+			ls = i + 1;
+			colon = SIZE_MAX;
+		}
+	}
+	return -EAGAIN;
+}
+
+
+static inline size_t str_wordset_bucket(uint64_t h, size_t buckets)
+{
+	return (size_t)(((h >> 32) * buckets) >> 32);
+}
+
+/* Slot of hash @h under displacement @d; the odd step sends each @d to a different slot. */
+static inline size_t str_wordset_pos(uint64_t h, size_t d, size_t mask)
+{
+	return ((size_t)h + d * ((size_t)(h >> 17) | 1)) & mask;
+}
+
+/*
+ * Gives each bucket of keys, largest first, the first displacement that
+ * puts all its keys in free slots. @order holds the keys grouped by
+ * bucket, bucket b starting at @start[b]. Returns 0 if some bucket fits
+ * nowhere, so a bigger table is needed.
+ */
+static int str_wordset_place(str_wordset *self, const uint64_t *hash, const uint32_t *order,
+			     const uint32_t *start, size_t biggest)
+{
+	for (size_t size = biggest; size > 0; size--) {
+		for (size_t b = 0; b < self->buckets; b++) {
+			const uint32_t *key = order + start[b];
+			size_t d, j = 0;
+
+			if (start[b + 1] - start[b] != size)
+				continue;
+			for (d = 0; d <= UINT16_MAX; d++) {
+				for (j = 0; j < size; j++) {
+					size_t pos = str_wordset_pos(hash[key[j]], d, self->mask);
+					if (self->slots[pos])
+						break;
+					self->slots[pos] = key[j] + 1;
+				}
+				if (j == size)
+					break;
+				while (j--)
+					self->slots[str_wordset_pos(hash[key[j]], d, self->mask)] = 0;
+			}
+			if (d > UINT16_MAX)
+				return 0;
+			self->disp[b] = (uint16_t)d;
+		}
+	}
+	return 1;
+}
+
+/*
+ * Groups the @n keys by bucket, keeping repeated words once, then grows the
+ * table from twice the number of words until every bucket finds a place.
+ * Returns 0, or an errno value.
+ */
+static int str_wordset_build(str_wordset *self, const uint64_t *hash, size_t n, uint32_t *order,
+			     uint32_t *start)
+{
+	size_t buckets = self->buckets, biggest = 0, w = 0, begin = 0;
+
+	for (size_t i = 0; i < n; i++)
+		start[str_wordset_bucket(hash[i], buckets)]++;
+	for (size_t b = 1; b < buckets; b++)
+		start[b] += start[b - 1];
+	for (size_t i = n; i-- > 0;)
+		order[--start[str_wordset_bucket(hash[i], buckets)]] = (uint32_t)i;
+	start[buckets] = (uint32_t)n;
+
+	for (size_t b = 0; b < buckets; b++) {
+		size_t end = start[b + 1], first = w;
+
+		start[b] = (uint32_t)w;
+		for (size_t k = begin; k < end; k++) {
+			uint32_t i = order[k], len = self->offs[i + 1] - self->offs[i];
+			size_t j = first;
+
+			for (; j < w; j++) {
+				uint32_t o = order[j];
+				if (hash[o] == hash[i] && self->offs[o + 1] - self->offs[o] == len &&
+				    !memcmp(self->text + self->offs[o], self->text + self->offs[i], len))
+					break;
+			}
+			if (j == w)
+				order[w++] = i;
+		}
+		if (w - first > biggest)
+			biggest = w - first;
+		begin = end;
+	}
+	start[buckets] = (uint32_t)w;
+	self->count = w;
+
+	for (size_t mask = 7;; mask = mask * 2 + 1) {
+		if (mask + 1 < 2 * w)
+			continue;
+		// Only distinct words with the same 64-bit hash get this far
+		if (mask > 64 * w + 64)
+			return EINVAL;
+
+		free(self->slots);
+		self->slots = (uint32_t *)calloc(mask + 1, sizeof(uint32_t));
+		if (!self->slots)
+			return ENOMEM;
+		self->mask = mask;
+		memset(self->disp, 0, buckets * sizeof(*self->disp));
+		if (str_wordset_place(self, hash, order, start, biggest))
+			return 0;
+	}
+}
+
+
+/*
+ * str_wordset_init() - Builds a set of @n words for str_wordset_has() and str_rem_words().
+ * @words: The words; they are copied and not referenced after the call.
+ * @lens: Length of each word.
+ * @n: Number of words. A repeated word is kept once.
+ * @flags: STR_WORDSET_ICASE to match ASCII letters in either case, or 0.
+ *
+ * The words are placed by a perfect hash, so a lookup never looks at more
+ * than one slot. Building it costs a few passes over the words; the set is
+ * meant to be built once and looked up many times.
+ *
+ * The caller is responsible for freeing the set using str_wordset_free().
+ *
+ * Returns:
+ *     A pointer to the set, or NULL on failure (errno is set to EINVAL for
+ *     an empty set or an empty word, or ENOMEM)
+ */
+str_wordset *str_wordset_init(const char *const *words, const size_t *lens, size_t n, int flags)
+{
+	size_t total = 0;
+
+	if (!words || !lens || n == 0 || n > UINT32_MAX / 4) {
+		errno = EINVAL;
+		return NULL;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (!words[i] || !lens[i] || lens[i] > UINT32_MAX - total) {
+			errno = EINVAL;
+			return NULL;
+		}
+		total += lens[i];
+	}
+
+	str_wordset *self = (str_wordset *)calloc(1, sizeof(*self));
+	size_t buckets = n / 4 + 1;
+	uint64_t *hash = (uint64_t *)malloc(n * sizeof(*hash));
+	uint32_t *order = (uint32_t *)malloc(n * sizeof(*order));
+	uint32_t *start = (uint32_t *)calloc(buckets + 1, sizeof(*start));
+	int err = ENOMEM;
+
+	if (self && hash && order && start &&
+	    (self->text = (char *)malloc(total)) &&
+	    (self->offs = (uint32_t *)malloc((n + 1) * sizeof(uint32_t))) &&
+	    (self->disp = (uint16_t *)malloc(buckets * sizeof(uint16_t)))) {
+		self->buckets = buckets;
+		self->flags = flags;
+		total = 0;
+		for (size_t i = 0; i < n; i++) {
+			char *w = self->text + total;
+
+			memcpy(w, words[i], lens[i]);
+			if (flags & STR_WORDSET_ICASE)
+				for (size_t k = 0; k < lens[i]; k++)
+					if (w[k] >= 'A' && w[k] <= 'Z')
+						w[k] += 'a' - 'A';
+			self->offs[i] = (uint32_t)total;
+			hash[i] = str_hash64(w, lens[i]);
+			total += lens[i];
+			if (lens[i] > self->max_len)
+				self->max_len = lens[i];
+		}
+		self->offs[n] = (uint32_t)total;
+		err = str_wordset_build(self, hash, n, order, start);
+	}
+
+	free(hash);
+	free(order);
+	free(start);
+	if (err) {
+		str_wordset_free(self);
+		errno = err;
+		return NULL;
+	}
+	return self;
+}
+
+
+/*
+ * str_wordset_has() - Tells whether @n bytes at @word are one of the words of @self.
+ * @self: Set from str_wordset_init().
+ * @word: Bytes to look up, may contain NUL bytes.
+ * @n: Number of bytes at @word.
+ *
+ * Returns:
+ *     1 if @word is in the set, 0 if it is not
+ */
+int str_wordset_has(const str_wordset *self, const char *word, size_t n)
+{
+	if (!self || !word || n == 0 || n > self->max_len)
+		return 0;
+
+	int fold = self->flags & STR_WORDSET_ICASE;
+	uint64_t h = str_hash64_fold(word, n, fold);
+	size_t d = self->disp[str_wordset_bucket(h, self->buckets)];
+	uint32_t k = self->slots[str_wordset_pos(h, d, self->mask)];
+
+	if (!k-- || self->offs[k + 1] - self->offs[k] != n)
+		return 0;
+
+	const char *w = self->text + self->offs[k];
+
+	if (!fold)
+		return !memcmp(w, word, n);
+	for (size_t i = 0; i < n; i++) {
+		char c = word[i] >= 'A' && word[i] <= 'Z' ? (char)(word[i] + 'a' - 'A') : word[i];
+		if (c != w[i])
+			return 0;
+	}
+	return 1;
+}
+
+
+/*
+ * It releases @self and its words.
+ */
+void str_wordset_free(str_wordset *self)
+{
+	if (self) {
+		free(self->text);
+		free(self->offs);
+		free(self->slots);
+		free(self->disp);
+		free(self);
+	}
+}
+
+
+/*
+ * str_rem_words() - Removes every word of @set from the string.
+ * @self: Pointer to the Str structure.
+ * @set: Words to remove, from str_wordset_init().
+ *
+ * The text is split into words once, by the UAX #29 rules of
+ * str_seg_next(), and each word is looked up in @set. Only whole words
+ * are removed: "cat" in "concatenate" is left alone. The kept bytes are
+ * moved down in the same pass, so nothing is allocated. With each removed
+ * word go the spaces and tabs after it or, if none follow (as before a
+ * '.' or at the end of a line), the ones before it.
+ *
+ * Returns:
+ *     The number of words removed on successful completion
+ *    -EINVAL if @self, @self->data or @set is NULL
+ *    -EPERM if @self is read-only
+ */
+int str_rem_words(str *self, const str_wordset *set)
+{
+	if (!self || !self->data || !set)
+		return -EINVAL;
+
+	STR_TRACE(STR_M_REM_WORDS, self->len);
+
+	int ret = str_unshare(self);
+	if (ret)
+		return ret;
+
+	str_seg it;
+	const char *seg;
+	char *w = self->data;
+	size_t n, removed = 0;
+	int gap = 0;	/* 1 after a removed word, 2 once spaces after it were dropped */
+
+	str_seg_init(&it, self->data, self->len, STR_SEG_WORD);
+	while (str_seg_next(&it, &seg, &n)) {
+		if (it.is_word && str_wordset_has(set, seg, n)) {
+			removed++;
+			gap = 1;
+			continue;
+		}
+		if (gap) {
+			size_t k = 0;
+
+			while (k < n && (seg[k] == ' ' || seg[k] == '\t'))
+				k++;
+			if (k == n) {
+				gap = 2;
+				continue;
+			}
+			if (gap == 1)
+				while (w > self->data && (w[-1] == ' ' || w[-1] == '\t'))
+					w--;
+			gap = 0;
+		}
+		if (w != seg)
+			memmove(w, seg, n);
+		w += n;
+	}
+	if (gap == 1)
+		while (w > self->data && (w[-1] == ' ' || w[-1] == '\t'))
+			w--;
+
+	self->len = (size_t)(w - self->data);
+	self->data[self->len] = '\0';
+	return removed > INT_MAX ? INT_MAX : (int)removed;
+}
+
+
+/*
+ * str_find_n() - Finds the first occurrence of @needle in @n bytes at @hay.
+ * @hay: Bytes to search, may contain NUL bytes.
+ * @n: Number of bytes at @hay.
+ * @needle: Bytes to look for.
+ * @m: Length of @needle.
+ *
+ * With SSE2 or AVX2, each step compares a whole vector of candidate
+ * positions against the first and the last byte of @needle at once, and
+ * only positions where both match are compared in full. This skips most
+ * of the false starts a byte-at-a-time search stops at.
+ *
+ * Returns:
+ *     A pointer to the first match, @hay if @m is 0, or NULL if there is none
+ */
+const char *str_find_n(const char *hay, size_t n, const char *needle, size_t m)
+{
+	size_t i = 0;
+
+	if (m == 0)
+		return hay;
+	if (m > n)
+		return NULL;
+	if (m == 1)
+		return (const char *)memchr(hay, needle[0], n);
+
+#ifdef STR_SIMD_BYTES
+	const str_simd first = str_simd_splat(needle[0]);
+	const str_simd last = str_simd_splat(needle[m - 1]);
+
+	for (; i + m - 1 + STR_SIMD_BYTES <= n; i += STR_SIMD_BYTES) {
+		uint32_t mask = str_simd_eq(str_simd_load(hay + i), first) &
+				str_simd_eq(str_simd_load(hay + i + m - 1), last);
+
+		while (mask) {
+			size_t at = i + (size_t)__builtin_ctz(mask);
+			if (!memcmp(hay + at + 1, needle + 1, m - 2))
+				return hay + at;
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	while (i + m <= n) {
+		const char *p = (const char *)memchr(hay + i, needle[0], n - m + 1 - i);
+		if (!p)
+			return NULL;
+		if (p[m - 1] == needle[m - 1] && !memcmp(p + 1, needle + 1, m - 2))
+			return p;
+		i = (size_t)(p - hay) + 1;
+	}
+	return NULL;
+}
+
+
+/*
+ * str_ac_init() - Builds an automaton that finds any of @n patterns.
+ * @pats: The patterns; they are not referenced after the call.
+ * @lens: Length of each pattern.
+ * @n: Number of patterns.
+ *
+ * The caller is responsible for freeing the automaton using str_ac_free().
+ * Memory use is one kilobyte per distinct pattern prefix.
+ *
+ * Returns:
+ *     A pointer to the automaton, or NULL on failure (errno is set to
+ *     EINVAL for an empty set or an empty pattern, or ENOMEM)
+ */
+str_ac *str_ac_init(const char *const *pats, const size_t *lens, size_t n)
+{
+	size_t total = 1;
+
+	if (!pats || !lens || n == 0 || n >= UINT32_MAX) {
+		errno = EINVAL;
+		return NULL;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (!pats[i] || !lens[i] || lens[i] > UINT32_MAX - total) {
+			errno = EINVAL;
+			return NULL;
+		}
+		total += lens[i];
+	}
+
+	str_ac *self = (str_ac *)calloc(1, sizeof(*self));
+	uint32_t *queue = (uint32_t *)malloc(total * sizeof(*queue));
+
+	if (!self || !queue || total > SIZE_MAX / 256 / sizeof(uint32_t) ||
+	    !(self->next = (uint32_t *)calloc(total * 256, sizeof(uint32_t))) ||
+	    !(self->match = (uint32_t *)calloc(total, sizeof(uint32_t))) ||
+	    !(self->lens = (size_t *)malloc(n * sizeof(size_t)))) {
+		free(queue);
+		str_ac_free(self);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	// Trie: state 0 is the root, so 0 also means "no child" until the BFS
+	self->states = 1;
+	self->count = n;
+	for (size_t i = 0; i < n; i++) {
+		const unsigned char *p = (const unsigned char *)pats[i];
+		uint32_t s = 0;
+
+		self->lens[i] = lens[i];
+		self->start[p[0]] = 1;
+		for (size_t k = 0; k < lens[i]; k++) {
+			uint32_t *t = &self->next[(size_t)s * 256 + p[k]];
+			if (!*t)
+				*t = (uint32_t)self->states++;
+			s = *t;
+		}
+		if (!self->match[s] || lens[i] < self->lens[self->match[s] - 1])
+			self->match[s] = (uint32_t)i + 1;
+	}
+
+	// Breadth first: complete each row from the row of the failure state
+	uint32_t *fails = (uint32_t *)calloc(self->states, sizeof(uint32_t));
+	size_t qh = 0, qt = 0;
+
+	if (!fails) {
+		free(queue);
+		str_ac_free(self);
+		errno = ENOMEM;
+		return NULL;
+	}
+	for (int c = 0; c < 256; c++)
+		if (self->next[c])
+			queue[qt++] = self->next[c];	/* fails to the root */
+
+	while (qh < qt) {
+		uint32_t s = queue[qh++], f = fails[s];
+
+		if (!self->match[s])
+			self->match[s] = self->match[f];
+		for (int c = 0; c < 256; c++) {
+			uint32_t *t = &self->next[(size_t)s * 256 + c];
+			if (*t) {
+				fails[*t] = self->next[(size_t)f * 256 + c];
+				queue[qt++] = *t;
+			} else {
+				*t = self->next[(size_t)f * 256 + c];
+			}
+		}
+	}
+
+	free(fails);
+	free(queue);
+	return self;
+}
+
+
+/*
+ * str_ac_find() - Finds the first place where any pattern of @self ends.
+ * @self: Automaton from str_ac_init().
+ * @hay: Bytes to search, may contain NUL bytes.
+ * @n: Number of bytes at @hay.
+ * @which: If not NULL, set to the index of the pattern found.
+ *
+ * Returns:
+ *     A pointer to the start of the match that ends first, or NULL
+ */
+const char *str_ac_find(const str_ac *self, const char *hay, size_t n, size_t *which)
+{
+	const unsigned char *p = (const unsigned char *)hay;
+	uint32_t s = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		// From the root, skip bytes that cannot start a pattern
+		if (s == 0) {
+			while (i < n && !self->start[p[i]])
+				i++;
+			if (i == n)
+				break;
+		}
+
+		s = self->next[(size_t)s * 256 + p[i]];
+		if (self->match[s]) {
+			size_t k = self->match[s] - 1;
+			if (which)
+				*which = k;
+			return hay + i + 1 - self->lens[k];
+		}
+	}
+	return NULL;
+}
+
+
+/*
+ * It releases @self and its tables.
+ */
+void str_ac_free(str_ac *self)
+{
+	if (self) {
+		free(self->next);
+		free(self->match);
+		free(self->lens);
+		free(self);
+	}
+}
+
+#ifdef STR_HAVE_POSIX
+
+#ifndef MFD_CLOEXEC
+  #define MFD_CLOEXEC		0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+  #define MFD_ALLOW_SEALING	0x0002U
+#endif
+
+/*
+ * str_memfd() - Creates an anonymous shared memory file.
+ * @name: Name shown in /proc/<pid>/fd, for debugging only.
+ * @flags: MFD_* flags, honoured where memfd_create() is available.
+ *
+ * Falls back to an immediately unlinked POSIX shared memory object on systems
+ * without memfd_create().
+ *
+ * Returns:
+ *     A file descriptor, or -errno on failure
+ */
+static int str_memfd(const char *name, unsigned int flags)
+{
+#if defined(__linux__) && defined(SYS_memfd_create) && \
+    (defined(_DEFAULT_SOURCE) || defined(_GNU_SOURCE) || defined(_BSD_SOURCE))
+	int fd = (int)syscall(SYS_memfd_create, name, flags);
+	if (fd >= 0 || errno != ENOSYS)
+		return fd >= 0 ? fd : -errno;
+#endif
+	static unsigned int seq;
+	char path[64];
+
+	(void)flags;
+	for (int tries = 0; tries < 16; tries++) {
+		snprintf(path, sizeof(path), "/%s-%ld-%u", name, (long)getpid(), seq++);
+
+		int fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0600);
+		if (fd >= 0) {
+			shm_unlink(path);
+			return fd;
+		}
+		if (errno != EEXIST)
+			return -errno;
+	}
+	return -EEXIST;
+}
+
+
+#if defined(__linux__)
+  #ifndef F_ADD_SEALS
+    #define F_ADD_SEALS		1033
+    #define F_GET_SEALS		1034
+  #endif
+  #ifndef F_SEAL_SEAL
+    #define F_SEAL_SEAL		0x0001
+    #define F_SEAL_SHRINK	0x0002
+    #define F_SEAL_GROW		0x0004
+    #define F_SEAL_WRITE	0x0008
+  #endif
+#endif
+
+/*
+ * str_init_shared() - Creates a string whose buffer is shared memory.
+ * @size: Capacity in bytes; the string cannot grow beyond it.
+ *
+ * The buffer is a MAP_SHARED mapping of a memfd, so it can be handed to
+ * another process with str_shared_send() without copying. Appends that do
+ * not fit fail with -ENOSPC. The caller is responsible for freeing the
+ * returned structure using str_free().
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL on failure (errno is set)
+ */
+str *str_init_shared(size_t size)
+{
+	if (size >= MAX_STRING_SIZE / 2) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	str *tmp = str_init();
+	if (!tmp)
+		return NULL;
+
+	int fd = str_memfd("str_shared", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd < 0) {
+		free(tmp);
+		errno = -fd;
+		return NULL;
+	}
+
+	char *map = MAP_FAILED;
+	if (ftruncate(fd, (off_t)(size + 1)) == 0)
+		map = (char *)mmap(NULL, size + 1, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		int err = errno;
+		close(fd);
+		free(tmp);
+		errno = err;
+		return NULL;
+	}
+
+	map[0] = '\0';
+	tmp->data = map;
+	tmp->cap = size;
+	tmp->fd = fd;
+	tmp->flags = STR_F_MAPPED;
+	return tmp;
+}
+
+
+/*
+ * str_map_shared() - Maps @len bytes of shared memory @fd as a read-only string.
+ * @fd: Descriptor received from str_shared_recv() or passed by other means.
+ *      The new string owns it and closes it on str_free().
+ * @len: Length of the contents, which must be followed by a NUL byte.
+ *
+ * Unless the sender sealed the memory with str_shared_seal(), it can still
+ * change the contents or shrink the file under the mapping.
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL on failure (errno is set)
+ */
+str *str_map_shared(int fd, size_t len)
+{
+	struct stat st;
+
+	if (fstat(fd, &st) != 0)
+		return NULL;
+
+	if (len >= MAX_STRING_SIZE / 2 || (uint64_t)st.st_size < (uint64_t)len + 1) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	str *tmp = str_init();
+	if (!tmp)
+		return NULL;
+
+	char *map = (char *)mmap(NULL, len + 1, PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED) {
+		int err = errno;
+		free(tmp);
+		errno = err;
+		return NULL;
+	}
+
+	tmp->data = map;
+	tmp->len = len;
+	tmp->cap = len;
+	tmp->fd = fd;
+	tmp->flags = STR_F_MAPPED | STR_F_RDONLY;
+	return tmp;
+}
+
+
+/*
+ * Returns the memfd behind @self, or -EINVAL if it is not shared memory.
+ */
+int str_shared_fd(const str *self)
+{
+	return (self->flags & STR_F_MAPPED) ? self->fd : -EINVAL;
+}
+
+
+/*
+ * str_shared_seal() - Freezes a shared memory string for a safe handoff.
+ *
+ * The contents are moved to the start of the memfd, the file is cut down to
+ * them plus the NUL, and write, grow and shrink seals are applied. @self is
+ * remapped read-only, so a receiver can trust the contents without copying.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self is not shared memory
+ *    -ENOTSUP if the system has no file sealing
+ *    -errno if a system call fails
+ */
+int str_shared_seal(str *self)
+{
+	assert(self != NULL);
+
+	if (!(self->flags & STR_F_MAPPED))
+		return -EINVAL;
+
+	if (self->flags & STR_F_RDONLY)
+		return 0;
+
+#ifdef F_ADD_SEALS
+	char *base = self->data - self->head;
+	size_t size = self->head + self->cap + 1;
+
+	memmove(base, self->data, self->len);
+	base[self->len] = '\0';
+
+	/* F_SEAL_WRITE is refused while a writable mapping exists. */
+	munmap(base, size);
+	self->data = NULL;
+
+	int err = 0;
+	if (ftruncate(self->fd, (off_t)(self->len + 1)) != 0 ||
+	    fcntl(self->fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) != 0)
+		err = errno;
+
+	char *map = (char *)mmap(NULL, self->len + 1, PROT_READ, MAP_SHARED, self->fd, 0);
+	if (map == MAP_FAILED) {
+		close(self->fd);
+		STR_ALLOC_FORGET(self);
+		self->flags &= (uint8_t)~STR_F_MAPPED;
+		self->len = self->cap = self->head = 0;
+		return -errno;
+	}
+
+	self->data = map;
+	self->cap = self->len;
+	self->head = 0;
+	self->flags |= STR_F_RDONLY;
+	return err ? -err : 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+
+/*
+ * str_shared_send() - Passes a shared memory string over a Unix socket.
+ * @self: String created by str_init_shared().
+ * @sock: Connected AF_UNIX socket.
+ *
+ * Only the descriptor and the length travel through the socket; the
+ * receiver maps the same pages with str_shared_recv(). The contents must
+ * start at the beginning of the buffer (nothing consumed from the front,
+ * or sealed).
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @self is not shared memory or has consumed front bytes
+ *    -errno if sendmsg() fails
+ */
+int str_shared_send(const str *self, int sock)
+{
+	assert(self != NULL);
+
+	if (!(self->flags & STR_F_MAPPED) || self->head)
+		return -EINVAL;
+
+	uint64_t len = self->len;
+	struct iovec iov = { &len, sizeof(len) };
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(sizeof(int))];
+	} ctl;
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+	memset(&ctl, 0, sizeof(ctl));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+
+	struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+	memcpy(CMSG_DATA(cmsg), &self->fd, sizeof(int));
+
+	ssize_t n;
+	do {
+		n = sendmsg(sock, &msg, 0);
+	} while (n < 0 && errno == EINTR);
+
+	if (n < 0)
+		return -errno;
+	return n == (ssize_t)sizeof(len) ? 0 : -EIO;
+}
+
+
+#ifdef MSG_CMSG_CLOEXEC
+  #define STR_MSG_CLOEXEC MSG_CMSG_CLOEXEC
+#else
+  #define STR_MSG_CLOEXEC 0
+#endif
+
+/* Descriptors str_shared_recv() takes from one message, so that extras can be closed. */
+#define STR_SHARED_RECV_FDS	8
+
+/*
+ * str_shared_recv() - Receives a string sent with str_shared_send().
+ * @sock: Connected AF_UNIX socket.
+ *
+ * The result is a read-only mapping of the sender's pages, see
+ * str_map_shared(). The caller is responsible for freeing it using str_free().
+ * A message that does not carry exactly one descriptor is refused, and any
+ * descriptors that came with it are closed.
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL on failure (errno is set,
+ *     to 0 if the peer closed the connection and to EPROTO for a malformed
+ *     or truncated message)
+ */
+str *str_shared_recv(int sock)
+{
+	uint64_t len = 0;
+	struct iovec iov = { &len, sizeof(len) };
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(STR_SHARED_RECV_FDS * sizeof(int))];
+	} ctl;
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl.buf;
+	msg.msg_controllen = sizeof(ctl.buf);
+
+	ssize_t n;
+	do {
+		n = recvmsg(sock, &msg, STR_MSG_CLOEXEC);
+	} while (n < 0 && errno == EINTR);
+
+	if (n < 0)
+		return NULL;
+
+	int fds[STR_SHARED_RECV_FDS], nfds = 0;
+	for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS ||
+		    cmsg->cmsg_len < CMSG_LEN(0))
+			continue;
+
+		size_t k = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+		for (size_t i = 0; i < k && nfds < STR_SHARED_RECV_FDS; i++)
+			memcpy(&fds[nfds++], CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+	}
+
+	int err = EPROTO;
+	if (!(msg.msg_flags & MSG_CTRUNC)) {
+		if (n == 0 && nfds == 0) {
+			err = 0;	/* the peer closed the connection */
+		} else if (nfds == 1 && n == (ssize_t)sizeof(len)) {
+			str *tmp = str_map_shared(fds[0], (size_t)len);
+			if (tmp)
+				return tmp;
+			err = errno;
+		}
+	}
+
+	while (nfds > 0)
+		close(fds[--nfds]);
+	errno = err;
+	return NULL;
+}
+
+
+/*
+ * str_load_fd() - Reads everything left in @fd into a new Str structure.
+ * @fd: File descriptor to read from; it is not closed.
+ *
+ * For regular files the buffer is sized once from fstat(), so the contents
+ * arrive in a single read(2) loop with no reallocation. Pipes and other
+ * streams start at STR_LOAD_CHUNK bytes and grow geometrically. The data may
+ * contain NUL bytes; use str_get_size() for its length. The caller is
+ * responsible for freeing the returned structure using str_free().
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL on failure (errno is set)
+ */
+str *str_load_fd(int fd)
+{
+	struct stat st;
+	size_t hint = STR_LOAD_CHUNK;
+
+	if (fstat(fd, &st) != 0)
+		return NULL;
+
+	if (S_ISREG(st.st_mode) && st.st_size > 0) {
+		off_t pos = lseek(fd, 0, SEEK_CUR);
+		if (pos < 0)
+			pos = 0;
+		hint = pos < st.st_size ? (size_t)(st.st_size - pos) : 0;
+	}
+
+	STR_TRACE(STR_M_LOAD_FD, hint);
+
+#if STR_LOAD_FADVISE
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+	str *tmp = str_init();
+	if (!tmp)
+		return NULL;
+
+	/* One spare byte lets the final read(2) report EOF without growing. */
+	int ret = str_grow(tmp, 0, hint + 1);
+	while (ret == 0) {
+		if (tmp->len == tmp->cap) {
+			ret = str_grow(tmp, 0, tmp->len + 1);
+			if (ret)
+				break;
+		}
+
+		ssize_t n = read(fd, tmp->data + tmp->len, tmp->cap - tmp->len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			ret = -errno;
+			break;
+		}
+		if (n == 0)
+			break;
+
+		tmp->len += (size_t)n;
+	}
+
+	if (ret) {
+		str_free(tmp);
+		errno = -ret;
+		return NULL;
+	}
+
+	tmp->data[tmp->len] = '\0';
+	return tmp;
+}
+
+
+/*
+ * str_load_file() - Reads the whole file at @path into a new Str structure.
+ *
+ * See str_load_fd().
+ *
+ * Returns:
+ *     A pointer to the new Str structure, or NULL on failure (errno is set)
+ */
+str *str_load_file(const char *path)
+{
+	if (path == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return NULL;
+
+	str *tmp = str_load_fd(fd);
+
+	int err = errno;
+	close(fd);
+	errno = err;
+	return tmp;
+}
+
+
+/*
+ * str_ring_init() - Creates a ring of at least @size bytes.
+ * @size: Requested capacity, rounded up to a multiple of the page size.
+ *
+ * The caller is responsible for freeing the ring using str_ring_free().
+ *
+ * Returns:
+ *     A pointer to the new ring, or NULL on failure (errno is set)
+ */
+str_ring *str_ring_init(size_t size)
+{
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+
+	if (size == 0 || size > MAX_STRING_SIZE / 2 - page) {
+		errno = EINVAL;
+		return NULL;
+	}
+	size = (size + page - 1) / page * page;
+
+	str_ring *tmp = (str_ring *)calloc(1, sizeof(str_ring));
+	if (!tmp)
+		return NULL;
+
+	int fd = str_memfd("str_ring", MFD_CLOEXEC);
+	if (fd < 0) {
+		free(tmp);
+		errno = -fd;
+		return NULL;
+	}
+
+	/*
+	 * Reserve both halves first so that the fixed mappings cannot clobber
+	 * anything. Without anonymous mappings (strict POSIX), the file itself
+	 * holds the reservation until it is mapped over.
+	 */
+#if defined(MAP_ANONYMOUS)
+	char *base = (char *)mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#elif defined(MAP_ANON)
+	char *base = (char *)mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANON, -1, 0);
+#else
+	char *base = (char *)mmap(NULL, 2 * size, PROT_NONE, MAP_SHARED, fd, 0);
+#endif
+	if (base == MAP_FAILED || ftruncate(fd, (off_t)size) != 0 ||
+	    mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+	    mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED) {
+		int err = errno;
+		if (base != MAP_FAILED)
+			munmap(base, 2 * size);
+		close(fd);
+		free(tmp);
+		errno = err;
+		return NULL;
+	}
+	close(fd);
+
+	tmp->base = base;
+	tmp->size = size;
+	return tmp;
+}
+
+
+/*
+ * It releases @self and its mappings.
+ */
+void str_ring_free(str_ring *self)
+{
+	if (self) {
+		if (self->base)
+			munmap(self->base, 2 * self->size);
+		free(self);
+	}
+}
+
+
+/*
+ * Returns the unread bytes of @self as one contiguous, non-NUL-terminated block
+ * of str_ring_get_size() bytes. It stays valid until the next str_ring_consume().
+ */
+const char *str_ring_data(const str_ring *self)
+{
+	return self->base + self->head;
+}
+
+
+/*
+ * Returns the number of unread bytes in @self.
+ */
+size_t str_ring_get_size(const str_ring *self)
+{
+	return self->len;
+}
+
+
+/*
+ * str_ring_tail() - Returns where the next bytes are to be written.
+ * @self: Pointer to the ring.
+ * @space: Set to the number of contiguous bytes that may be written there.
+ *
+ * Write directly into the returned block, then publish the bytes with
+ * str_ring_commit().
+ */
+char *str_ring_tail(const str_ring *self, size_t *space)
+{
+	if (space)
+		*space = self->size - self->len;
+
+	return self->base + self->head + self->len;
+}
+
+
+/*
+ * str_ring_commit() - Marks @n bytes written at str_ring_tail() as unread.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @n exceeds the free space
+ */
+int str_ring_commit(str_ring *self, size_t n)
+{
+	if (n > self->size - self->len)
+		return -EINVAL;
+
+	self->len += n;
+	return 0;
+}
+
+
+/*
+ * str_ring_add_n() - Copies @n bytes from @_data into the ring.
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @_data is NULL
+ *    -ENOSPC if the ring does not have @n bytes free
+ */
+int str_ring_add_n(str_ring *self, const char *_data, size_t n)
+{
+	assert(self != NULL);
+
+	if (_data == NULL && n)
+		return -EINVAL;
+
+	if (n > self->size - self->len)
+		return -ENOSPC;
+
+	if (n)
+		memcpy(self->base + self->head + self->len, _data, n);
+	self->len += n;
+	return 0;
+}
+
+
+/*
+ * str_ring_read() - Reads from @fd straight into the free space of the ring.
+ * @self: Pointer to the ring.
+ * @fd: File descriptor to read(2) from.
+ *
+ * A single read(2) fills as much of the free space as the descriptor offers,
+ * with no intermediate buffer.
+ *
+ * Returns:
+ *     The number of bytes read, 0 at end of file, -ENOSPC if the ring is full,
+ *     or -errno if read(2) fails
+ */
+ssize_t str_ring_read(str_ring *self, int fd)
+{
+	assert(self != NULL);
+
+	size_t space;
+	char *tail = str_ring_tail(self, &space);
+	if (space == 0)
+		return -ENOSPC;
+
+	ssize_t n;
+	do {
+		n = read(fd, tail, space);
+	} while (n < 0 && errno == EINTR);
+
+	if (n < 0)
+		return -errno;
+
+	self->len += (size_t)n;
+	return n;
+}
+
+
+/*
+ * str_ring_consume() - Drops the first @n unread bytes in O(1).
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if fewer than @n bytes are unread
+ */
+int str_ring_consume(str_ring *self, size_t n)
+{
+	if (n > self->len)
+		return -EINVAL;
+
+	self->len -= n;
+	self->head += n;
+	if (self->head >= self->size)
+		self->head -= self->size;
+	if (self->len == 0)
+		self->head = 0;
+
+	return 0;
+}
+
+
+/*
+ * str_follow_watch() - Points the inotify watches at the current file.
+ *
+ * The file itself is watched for appends and truncation, and its directory
+ * for a replacement appearing under the same name.
+ */
+static void str_follow_watch(str_follow *self)
+{
+#ifdef STR_HAVE_INOTIFY
+	if (self->ifd < 0)
+		return;
+
+	if (self->wd_file >= 0)
+		inotify_rm_watch(self->ifd, self->wd_file);
+	self->wd_file = inotify_add_watch(self->ifd, self->path,
+					  IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+
+	if (self->wd_dir < 0) {
+		const char *slash = strrchr(self->path, '/');
+		if (!slash) {
+			self->wd_dir = inotify_add_watch(self->ifd, ".", IN_CREATE | IN_MOVED_TO);
+		} else if (slash == self->path) {
+			self->wd_dir = inotify_add_watch(self->ifd, "/", IN_CREATE | IN_MOVED_TO);
+		} else {
+			size_t n = (size_t)(slash - self->path);
+			char *dir = (char *)malloc(n + 1);
+			if (dir) {
+				memcpy(dir, self->path, n);
+				dir[n] = '\0';
+				self->wd_dir = inotify_add_watch(self->ifd, dir, IN_CREATE | IN_MOVED_TO);
+				free(dir);
+			}
+		}
+	}
+#else
+	(void)self;
+#endif
+}
+
+
+/*
+ * str_follow_open() - Starts following the file at @path.
+ * @path: File to follow. It has to exist when the follower is opened.
+ * @from_end: Non-zero to skip the current contents, like `tail -f -n 0`.
+ *
+ * The caller is responsible for releasing the follower using str_follow_close().
+ *
+ * Returns:
+ *     A pointer to the new follower, or NULL on failure (errno is set)
+ */
+str_follow *str_follow_open(const char *path, int from_end)
+{
+	struct stat st;
+
+	if (path == NULL) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	str_follow *tmp = (str_follow *)calloc(1, sizeof(str_follow));
+	if (!tmp)
+		return NULL;
+
+	tmp->ifd = tmp->wd_file = tmp->wd_dir = -1;
+	tmp->path = strdup(path);
+	tmp->fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (!tmp->path || tmp->fd < 0 || fstat(tmp->fd, &st) != 0) {
+		int err = errno;
+		str_follow_close(tmp);
+		errno = err;
+		return NULL;
+	}
+
+	tmp->dev = st.st_dev;
+	tmp->ino = st.st_ino;
+	tmp->off = from_end ? st.st_size : 0;
+
+#ifdef STR_HAVE_INOTIFY
+	tmp->ifd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+	str_follow_watch(tmp);
+	return tmp;
+}
+
+
+/*
+ * str_follow_read() - Appends whatever the current file holds past @self->off.
+ *
+ * Returns:
+ *     0 on successful completion, or -errno on failure
+ */
+static int str_follow_read(str_follow *self)
+{
+	struct stat st;
+
+	for (;;) {
+		if (fstat(self->fd, &st) != 0)
+			return -errno;
+		if (st.st_size <= self->off)
+			return 0;
+
+		size_t avail = (size_t)(st.st_size - self->off);
+		int ret = str_grow(&self->buf, 0, self->buf.len + avail);
+		if (ret)
+			return ret;
+
+		ssize_t n = pread(self->fd, self->buf.data + self->buf.len, avail, self->off);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+		if (n == 0)
+			return 0;
+
+		self->buf.len += (size_t)n;
+		self->buf.data[self->buf.len] = '\0';
+		self->off += n;
+	}
+}
+
+
+/*
+ * str_follow_fill() - Reads new bytes, handling truncation and rotation.
+ *
+ * A truncated file is read again from the start and any partial line is
+ * dropped. When another file has taken the name, the rest of the old one
+ * is read before switching over.
+ *
+ * Returns:
+ *     0 on successful completion, or -errno on failure
+ */
+static int str_follow_fill(str_follow *self)
+{
+	struct stat st;
+
+	for (;;) {
+		int ret = str_follow_read(self);
+		if (ret)
+			return ret;
+
+		if (fstat(self->fd, &st) == 0 && st.st_size < self->off) {
+			str_consume_front(&self->buf, self->buf.len);
+			self->scan = 0;
+			self->off = 0;
+			continue;
+		}
+
+		/* Gone without a replacement yet: keep the old file open. */
+		if (stat(self->path, &st) != 0 ||
+		    (st.st_dev == self->dev && st.st_ino == self->ino))
+			return 0;
+
+		int fd = open(self->path, O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			return 0;
+
+		close(self->fd);
+		self->fd = fd;
+		if (fstat(fd, &st) == 0) {
+			self->dev = st.st_dev;
+			self->ino = st.st_ino;
+		}
+		self->off = 0;
+		str_follow_watch(self);
+	}
+}
+
+
+/*
+ * str_follow_next() - Returns the next complete line of the followed file.
+ * @self: Pointer to the follower.
+ * @line: Set to the start of the line, excluding the '\n'.
+ * @len: Set to the length of the line.
+ *
+ * The line is a view into the follower's buffer and stays valid until the
+ * next call. Only bytes appended since the previous refill are read, and
+ * only they are scanned for newlines. A trailing line without '\n' is held
+ * back until it is completed.
+ *
+ * Returns:
+ *     1 if a line was returned, 0 if no complete line is available yet,
+ *     or -errno on failure
+ */
+int str_follow_next(str_follow *self, const char **line, size_t *len)
+{
+	assert(self != NULL && line != NULL && len != NULL);
+	STR_TRACE(STR_M_FOLLOW_NEXT, self->buf.len);
+
+	str_consume_front(&self->buf, self->pending);
+	self->pending = 0;
+
+	for (int refilled = 0; ; refilled = 1) {
+		char *nl = self->buf.len > self->scan ?
+			(char *)memchr(self->buf.data + self->scan, '\n', self->buf.len - self->scan) : NULL;
+
+		if (nl) {
+			*line = self->buf.data;
+			*len = (size_t)(nl - self->buf.data);
+			self->pending = *len + 1;
+			self->scan = 0;
+			return 1;
+		}
+		self->scan = self->buf.len;
+
+		if (refilled)
+			return 0;
+
+		int ret = str_follow_fill(self);
+		if (ret)
+			return ret;
+	}
+}
+
+
+/*
+ * str_follow_wait() - Sleeps until the followed file may have changed.
+ * @self: Pointer to the follower.
+ * @timeout_ms: Maximum time to wait, or -1 to wait indefinitely.
+ *
+ * Uses inotify where available. Elsewhere, or if inotify could not be set
+ * up, it sleeps for @timeout_ms but never longer than STR_FOLLOW_POLL_MS,
+ * after which str_follow_next() polls the file; there -1 means "poll
+ * periodically" and the call returns 0 after each interval.
+ *
+ * Returns:
+ *     1 if a change was signalled, 0 on timeout, or -errno on failure
+ */
+int str_follow_wait(str_follow *self, int timeout_ms)
+{
+	assert(self != NULL);
+
+	if (self->ifd < 0) {
+		if (timeout_ms < 0 || timeout_ms > STR_FOLLOW_POLL_MS)
+			timeout_ms = STR_FOLLOW_POLL_MS;
+		if (poll(NULL, 0, timeout_ms) < 0 && errno != EINTR)
+			return -errno;
+		return 0;
+	}
+
+	struct pollfd pfd = { self->ifd, POLLIN, 0 };
+	int ret = poll(&pfd, 1, timeout_ms);
+	if (ret < 0)
+		return errno == EINTR ? 0 : -errno;
+	if (ret == 0)
+		return 0;
+
+	/* Drain the queue; the events only mean "look again". */
+	char events[4096];
+	while (read(self->ifd, events, sizeof(events)) > 0)
+		;
+
+	return 1;
+}
+
+
+/*
+ * It closes the followed file and releases @self.
+ */
+void str_follow_close(str_follow *self)
+{
+	if (self) {
+		if (self->fd >= 0)
+			close(self->fd);
+		if (self->ifd >= 0)
+			close(self->ifd);
+		str_clear(&self->buf);
+		free(self->path);
+		free(self);
+	}
+}
+
+
+/*
+ * str_write_all() - Writes the @cnt buffers of @iov to @fd, retrying on
+ * short writes.
+ *
+ * Returns:
+ *     0 on successful completion, or -errno on failure
+ */
+static int str_write_all(int fd, struct iovec *iov, int cnt)
+{
+	while (cnt > 0) {
+		ssize_t n = writev(fd, iov, cnt);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+
+		while (cnt > 0 && (size_t)n >= iov->iov_len) {
+			n -= (ssize_t)iov->iov_len;
+			iov++;
+			cnt--;
+		}
+		if (cnt > 0) {
+			iov->iov_base = (char *)iov->iov_base + n;
+			iov->iov_len -= (size_t)n;
+		}
+	}
+	return 0;
+}
+
+
+/*
+ * str_frame_writer_init() - Starts a frame stream on @fd.
+ *
+ * Frames are batched in memory; call str_frame_flush() to push them out.
+ * The caller is responsible for releasing the writer using
+ * str_frame_writer_free(), which does not close @fd.
+ *
+ * Returns:
+ *     A pointer to the new writer, or NULL if memory allocation fails
+ */
+str_frame_writer *str_frame_writer_init(int fd)
+{
+	str_frame_writer *tmp = (str_frame_writer *)calloc(1, sizeof(str_frame_writer));
+	if (!tmp)
+		return NULL;
+
+	tmp->fd = fd;
+	return tmp;
+}
+
+
+/*
+ * str_frame_write() - Queues one frame holding @n bytes from @_data.
+ * @self: Pointer to the writer.
+ * @_data: Payload, which may contain any bytes.
+ * @n: Payload length, at most STR_FRAME_MAX.
+ * @flags: STR_FRAME_CRC to protect the payload with a CRC32C.
+ *
+ * Small frames are copied into the batch buffer, which is written out once
+ * it holds STR_FRAME_BUF bytes. Larger payloads go out straight from @_data
+ * together with the batch in a single writev().
+ *
+ * Returns:
+ *     0 on successful completion
+ *    -EINVAL if @_data is NULL or @n exceeds STR_FRAME_MAX
+ *    -ENOMEM if memory allocation fails
+ *    -errno if writing fails
+ */
+int str_frame_write(str_frame_writer *self, const char *_data, size_t n, int flags)
+{
+	assert(self != NULL);
+	STR_TRACE(STR_M_FRAME_WRITE, n);
+
+	if ((_data == NULL && n) || n > STR_FRAME_MAX)
+		return -EINVAL;
+
+	unsigned char hdr[16];
+	size_t hlen = 0;
+	uint64_t v = ((uint64_t)n << 1) | ((flags & STR_FRAME_CRC) ? 1 : 0);
+
+	while (v >= 0x80) {
+		hdr[hlen++] = (unsigned char)(v | 0x80);
+		v >>= 7;
+	}
+	hdr[hlen++] = (unsigned char)v;
+
+	if (flags & STR_FRAME_CRC) {
+		uint32_t crc = str_crc32c(0, _data, n);
+		for (int i = 0; i < 4; i++)
+			hdr[hlen++] = (unsigned char)(crc >> (8 * i));
+	}
+
+	int ret = str_add_n(&self->buf, (const char *)hdr, hlen);
+	if (ret)
+		return ret;
+
+	if (n >= STR_FRAME_BUF) {
+		struct iovec iov[2] = {
+			{ self->buf.data, self->buf.len },
+			{ (void *)_data, n },
+		};
+		ret = str_write_all(self->fd, iov, 2);
+		self->buf.len = 0;
+		self->buf.data[0] = '\0';
+		return ret;
+	}
+
+	ret = str_add_n(&self->buf, _data, n);
+	if (ret)
+		return ret;
+
+	return self->buf.len >= STR_FRAME_BUF ? str_frame_flush(self) : 0;
+}
+
+
+/*
+ * str_frame_flush() - Writes all queued frames to the descriptor.
+ *
+ * Returns:
+ *     0 on successful completion, or -errno if writing fails
+ */
+int str_frame_flush(str_frame_writer *self)
+{
+	assert(self != NULL);
+
+	if (self->buf.len == 0)
+		return 0;
+
+	struct iovec iov = { self->buf.data, self->buf.len };
+	int ret = str_write_all(self->fd, &iov, 1);
+
+	self->buf.len = 0;
+	self->buf.data[0] = '\0';
+	return ret;
+}
+
+
+/*
+ * It releases @self without flushing or closing its descriptor.
+ */
+void str_frame_writer_free(str_frame_writer *self)
+{
+	if (self) {
+		str_clear(&self->buf);
+		free(self);
+	}
+}
+
+
+/*
+ * str_frame_reader_init() - Starts reading a frame stream from @fd.
+ *
+ * The caller is responsible for releasing the reader using
+ * str_frame_reader_free(), which does not close @fd.
+ *
+ * Returns:
+ *     A pointer to the new reader, or NULL if memory allocation fails
+ */
+str_frame_reader *str_frame_reader_init(int fd)
+{
+	str_frame_reader *tmp = (str_frame_reader *)calloc(1, sizeof(str_frame_reader));
+	if (!tmp)
+		return NULL;
+
+	tmp->fd = fd;
+	return tmp;
+}
+
+
+/*
+ * str_frame_fill() - Reads at least @need buffered bytes, in large blocks.
+ *
+ * Returns:
+ *     0 on successful completion or at end of file (@self->eof is set),
+ *     or -errno on failure
+ */
+static int str_frame_fill(str_frame_reader *self, size_t need)
+{
+	while (self->buf.len < need && !self->eof) {
+		size_t want = need > self->buf.len + STR_FRAME_BUF ? need : self->buf.len + STR_FRAME_BUF;
+		int ret = str_grow(&self->buf, 0, want);
+		if (ret)
+			return ret;
+
+		ssize_t n = read(self->fd, self->buf.data + self->buf.len, self->buf.cap - self->buf.len);
+		if (n < 0) {
+			if (errno == EINTR)
+				continue;
+			return -errno;
+		}
+		if (n == 0)
+			self->eof = 1;
+
+		self->buf.len += (size_t)n;
+	}
+	return 0;
+}
+
+
+/*
+ * str_frame_read() - Returns the next frame of the stream.
+ * @self: Pointer to the reader.
+ * @_data: Set to the payload, a view into the reader's buffer.
+ * @n: Set to the payload length.
+ *
+ * The payload is not copied and stays valid until the next call. It is not
+ * NUL-terminated. Frames carrying a CRC32C are verified before they are
+ * returned.
+ *
+ * Returns:
+ *     1 if a frame was returned, 0 at the end of the stream,
+ *    -EBADMSG if the stream is corrupt or ends inside a frame,
+ *    -EMSGSIZE if a frame exceeds STR_FRAME_MAX,
+ *     or -errno if reading fails
+ */
+int str_frame_read(str_frame_reader *self, const char **_data, size_t *n)
+{
+	assert(self != NULL && _data != NULL && n != NULL);
+	STR_TRACE(STR_M_FRAME_READ, self->buf.len);
+
+	str_consume_front(&self->buf, self->pending);
+	self->pending = 0;
+
+	uint64_t v = 0;
+	size_t hlen = 0;
+	for (;;) {
+		if (hlen == self->buf.len) {
+			int ret = str_frame_fill(self, hlen + 1);
+			if (ret)
+				return ret;
+			if (hlen == self->buf.len)
+				return hlen ? -EBADMSG : 0;
+		}
+
+		unsigned char c = (unsigned char)self->buf.data[hlen];
+		v |= (uint64_t)(c & 0x7f) << (7 * hlen);
+		hlen++;
+		if (!(c & 0x80))
+			break;
+		if (hlen == 10)
+			return -EBADMSG;
+	}
+
+	size_t len = (size_t)(v >> 1);
+	if ((v >> 1) > STR_FRAME_MAX)
+		return -EMSGSIZE;
+	if (v & 1)
+		hlen += 4;
+
+	int ret = str_frame_fill(self, hlen + len);
+	if (ret)
+		return ret;
+	if (self->buf.len < hlen + len)
+		return -EBADMSG;
+
+	const char *payload = self->buf.data + hlen;
+	if (v & 1) {
+		const unsigned char *c = (const unsigned char *)payload - 4;
+		uint32_t crc = (uint32_t)c[0] | (uint32_t)c[1] << 8 |
+			       (uint32_t)c[2] << 16 | (uint32_t)c[3] << 24;
+		if (str_crc32c(0, payload, len) != crc)
+			return -EBADMSG;
+	}
+
+	*_data = payload;
+	*n = len;
+	self->pending = hlen + len;
+	return 1;
+}
+
+
+/*
+ * It releases @self without closing its descriptor.
+ */
+void str_frame_reader_free(str_frame_reader *self)
+{
+	if (self) {
+		str_clear(&self->buf);
+		free(self);
+	}
+}
+
+#endif	/* STR_HAVE_POSIX */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _XSTRING_H_ */
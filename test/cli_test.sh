@@ -0,0 +1,42 @@
+#!/usr/bin/env bash
+#
+# cli_test.sh - checks the strutil CLI on inputs a C string would cut short.
+#
+# Usage: cli_test.sh STRUTIL
+#
+# Each command reads a file with an embedded NUL byte, which must come out
+# with every byte after the NUL processed like the bytes before it.
+
+set -euo pipefail
+
+strutil=${1:?usage: $0 STRUTIL}
+
+dir=$(mktemp -d)
+trap 'rm -rf "$dir"' EXIT
+input=$dir/nul.txt
+printf 'foo\0bar foo\nbaz foo. end\n' > "$input"
+
+export LC_ALL=C
+status=0
+
+# check NAME EXPECTED STRUTIL-ARGS... - runs strutil on $input; EXPECTED is
+# a printf format for the bytes it must write.
+check() {
+	local name=$1 expected=$2
+	shift 2
+	if cmp -s <("$strutil" "$@" "$input") <(printf "$expected"); then
+		echo "cli $name test passed"
+	else
+		echo "cli $name test failed: output differs"
+		status=1
+	fi
+}
+
+check replace  'XX\0bar XX\nbaz XX. end\n'	replace foo XX
+check remove   '\0bar \nbaz . end\n'		remove foo
+check upper    'FOO\0BAR FOO\nBAZ FOO. END\n'	upper
+check lower    'foo\0bar foo\nbaz foo. end\n'	lower
+check title    'Foo\0bar Foo\nBaz Foo. End\n'	title
+check sentence 'Foo\0bar foo\nbaz foo. End\n'	sentence
+
+exit $status
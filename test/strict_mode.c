@@ -0,0 +1,14 @@
+/*
+ * Compiles strutil.h as strict ISO C, once as is and once with POSIX.1-2008
+ * requested (see STR_HAVE_POSIX). Built by CMake, never run.
+ */
+#include "strutil.h"
+
+int strict_mode_check(void)
+{
+	str *s = str_init();
+	int ret = s ? str_add(s, "strict") : -ENOMEM;
+
+	str_free(s);
+	return ret;
+}
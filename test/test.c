@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "strutil.h"
+#include "bench/corpus.h"
 
 void test_str_init()
 {
@@ -38,6 +39,21 @@ void test_str_add()
 		str_free(s);
 		return;
 	}
+	// Appending a string to itself has to survive the buffer moving
+	for (int i = 0; i < 8; i++) {
+		if (str_add_n(s, s->data, s->len) != 0 || str_prepend_n(s, s->data, 5) != 0) {
+			printf("str_add test failed: unable to add a string to itself\n");
+			str_free(s);
+			return;
+		}
+	}
+	for (size_t i = 0; i < s->len; i += 5) {
+		if (s->len != 5 * 511 || memcmp(s->data + i, "Hello", 5) != 0) {
+			printf("str_add test failed: incorrect string added to itself\n");
+			str_free(s);
+			return;
+		}
+	}
 	str_free(s);
 	printf("str_add test passed\n");
 }
@@ -135,10 +151,1219 @@ void test_str_swap_word()
 		str_free(s);
 		return;
 	}
+	// The new word may come from the string itself, which is moved to make room
+	if (str_swap_word(s, "Hi", s->data) != 0 || strcmp(s->data, "Hi World World") != 0 ||
+	    str_swap_all(s, "World", s->data) != 2 ||
+	    strcmp(s->data, "Hi Hi World World Hi World World") != 0) {
+		printf("str_swap_word test failed: incorrect string after swapping in itself\n");
+		str_free(s);
+		return;
+	}
 	str_free(s);
 	printf("str_swap_word test passed\n");
 }
 
+void test_str_swap_all()
+{
+	str *s = str_init();
+	if (s == NULL || str_add(s, "a-b-c-") != 0) {
+		printf("str_swap_all test failed: setup failed\n");
+		str_free(s);
+		return;
+	}
+	if (str_swap_all(s, "-", "--") != 3 || strcmp(s->data, "a--b--c--") != 0) {
+		printf("str_swap_all test failed: incorrect result when growing\n");
+		str_free(s);
+		return;
+	}
+	if (str_swap_all(s, "--", "") != 3 || strcmp(s->data, "abc") != 0 || str_get_size(s) != 3) {
+		printf("str_swap_all test failed: incorrect result when shrinking\n");
+		str_free(s);
+		return;
+	}
+	if (str_swap_all(s, "b", "bb") != 1 || strcmp(s->data, "abbc") != 0 ||
+	    str_swap_all(s, "x", "y") != 0 || str_swap_all(s, "", "y") != -EINVAL) {
+		printf("str_swap_all test failed: incorrect match handling\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_swap_all test passed\n");
+}
+
+void test_str_to_title_case()
+{
+	str *s = str_init();
+	if (s == NULL || str_add(s, "hELLO  wORLD\tfoo.bar") != 0) {
+		printf("str_to_title_case test failed: setup failed\n");
+		str_free(s);
+		return;
+	}
+	if (str_to_title_case(s) != 0 || strcmp(s->data, "Hello  World\tFoo.bar") != 0) {
+		printf("str_to_title_case test failed: incorrect string after conversion\n");
+		str_free(s);
+		return;
+	}
+	if (str_to_sentence_case(s, ". ") != 0 || str_add(s, ". next. one") != 0 ||
+	    str_to_sentence_case(s, ". ") != 0 || strcmp(s->data, "Hello  World\tFoo.bar. Next. One") != 0) {
+		printf("str_to_title_case test failed: sentence case after title case\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_to_title_case test passed\n");
+}
+
+void test_str_find()
+{
+	const char *hay = "abcabdabcabcabe, needle in a haystack of needles";
+	const char *pats[] = { "needles", "cab", "hay" };
+	size_t lens[] = { 7, 3, 3 }, which = 0;
+	size_t n = strlen(hay);
+
+	if (str_find_n(hay, n, "abcabe", 6) != hay + 9 || str_find_n(hay, n, "needles", 7) != hay + 41 ||
+	    str_find_n(hay, n, "needlex", 7) != NULL || str_find_n(hay, 3, "abcd", 4) != NULL ||
+	    str_find_n(hay, n, "", 0) != hay) {
+		printf("str_find test failed: str_find_n returned the wrong position\n");
+		return;
+	}
+
+	str_ac *ac = str_ac_init(pats, lens, 3);
+	if (ac == NULL) {
+		printf("str_find test failed: str_ac_init failed\n");
+		return;
+	}
+	if (str_ac_find(ac, hay, n, &which) != hay + 2 || which != 1 ||
+	    str_ac_find(ac, hay + 16, n - 16, &which) != hay + 29 || which != 2 ||
+	    str_ac_find(ac, hay, 4, NULL) != NULL) {
+		printf("str_find test failed: str_ac_find returned the wrong match\n");
+		str_ac_free(ac);
+		return;
+	}
+	str_ac_free(ac);
+	printf("str_find test passed\n");
+}
+
+void test_str_wrap()
+{
+	static const struct {
+		const char *in;
+		size_t width;
+		int mode;
+		const char *out;
+	} cases[] = {
+		{ "aaa bb cc ddddd", 6, STR_WRAP_GREEDY, "aaa bb\ncc\nddddd" },
+		{ "aaa bb cc ddddd", 6, STR_WRAP_OPTIMAL, "aaa\nbb cc\nddddd" },
+		{ "aa b ccc dd", 6, STR_WRAP_GREEDY | STR_WRAP_JUSTIFY, "aa   b\nccc dd" },
+		{ "h\xC3\xA9llo \xE4\xB8\x96\xE7\x95\x8C ok", 8, STR_WRAP_GREEDY,
+		  "h\xC3\xA9llo\n\xE4\xB8\x96\xE7\x95\x8C ok" },
+		{ "  a\tb\n\n c   d\n", 10, STR_WRAP_OPTIMAL, "a b\n\nc d\n" },
+		{ "averyveryverylongword x", 5, STR_WRAP_OPTIMAL, "averyveryverylongword\nx" },
+	};
+
+	for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		str *s = str_init();
+		if (s == NULL || str_add(s, cases[i].in) != 0) {
+			printf("str_wrap test failed: setup failed\n");
+			str_free(s);
+			return;
+		}
+		if (str_wrap(s, cases[i].width, cases[i].mode) != 0 || strcmp(s->data, cases[i].out) != 0 ||
+		    str_get_size(s) != strlen(cases[i].out)) {
+			printf("str_wrap test failed: case %zu gave \"%s\"\n", i, s->data);
+			str_free(s);
+			return;
+		}
+		str_free(s);
+	}
+	printf("str_wrap test passed\n");
+}
+
+void test_str_display_width()
+{
+	static const struct {
+		const char *in;
+		size_t width;
+	} cases[] = {
+		{ "", 0 },
+		{ "plain ascii text that is longer than one vector", 47 },
+		{ "tab\there", 7 },
+		{ "h\xC3\xA9llo", 5 },				/* precomposed e acute */
+		{ "he\xCC\x81llo", 5 },			/* e + combining acute */
+		{ "\xE4\xB8\x96\xE7\x95\x8C", 4 },		/* CJK */
+		{ "\xF0\x9F\x98\x80!", 3 },			/* emoji */
+		{ "a\xE2\x80\x8B" "b", 2 },			/* zero width space */
+		{ "\xFF\xC3(\xED\xA0\x80", 6 },		/* invalid bytes, surrogate */
+		{ "0123456789abcdefghijklmnopqrstuv\xEF\xBC\xA1xyz", 37 },
+	};
+
+	for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		if (str_display_width_n(cases[i].in, strlen(cases[i].in)) != cases[i].width) {
+			printf("str_display_width test failed: case %zu\n", i);
+			return;
+		}
+	}
+
+	str *s = str_init();
+	if (s == NULL || str_add(s, "\xE4\xB8\x96 x") != 0 || str_display_width(s) != 4) {
+		printf("str_display_width test failed: setup failed\n");
+		str_free(s);
+		return;
+	}
+	if (str_display_width(s) != 4 || str_add(s, "\xE7\x95\x8C") != 0 || str_display_width(s) != 6 ||
+	    str_consume_front(s, 3) != 0 || str_display_width(s) != 4) {
+		printf("str_display_width test failed: cached width not updated\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_display_width test passed\n");
+}
+
+void test_str_transcode()
+{
+	const char *text = "ascii run long enough for a vector, h\xC3\xA9llo \xE4\xB8\x96 \xF0\x9F\x98\x80";
+	static const int flags[] = { 0, STR_UTF_BE, STR_UTF_BOM, STR_UTF_BE | STR_UTF_BOM };
+	str *in = str_init(), *wide = str_init(), *back = str_init();
+	const char *fail = NULL;
+
+	if (in == NULL || wide == NULL || back == NULL || str_add(in, text) != 0)
+		fail = "setup failed";
+
+	for (size_t i = 0; !fail && i < sizeof(flags) / sizeof(flags[0]); i++) {
+		size_t bom = flags[i] & STR_UTF_BOM ? 2 : 0;
+
+		str_clear(wide);
+		str_clear(back);
+		if (str_to_utf16(in, wide, flags[i]) != 0 || str_get_size(wide) != 2 * 46 + bom ||
+		    str_from_utf16(back, wide->data, wide->len, flags[i] & STR_UTF_BE) != 0 ||
+		    strcmp(back->data, text) != 0)
+			fail = "UTF-16 round trip";
+		str_clear(wide);
+		str_clear(back);
+		if (str_to_utf32(in, wide, flags[i]) != 0 || str_get_size(wide) != 4 * 45 + 2 * bom ||
+		    str_from_utf32(back, wide->data, wide->len, flags[i] & STR_UTF_BE) != 0 ||
+		    strcmp(back->data, text) != 0)
+			fail = "UTF-32 round trip";
+	}
+
+	// Unpaired surrogate, then the same with replacement
+	str_clear(back);
+	if (!fail && (str_from_utf16(back, "a\0\x00\xD8" "b\0", 6, 0) != -EILSEQ || str_get_size(back) != 0 ||
+		      str_from_utf16(back, "a\0\x00\xD8" "b\0", 6, STR_UTF_REPLACE) != 0 ||
+		      strcmp(back->data, "a\xEF\xBF\xBD" "b") != 0))
+		fail = "unpaired surrogate accepted";
+
+	str_clear(wide);
+	str_clear(back);
+	if (!fail && (str_to_latin1(in, wide, 0) != -EILSEQ || str_to_latin1(in, wide, STR_UTF_REPLACE) != 0 ||
+		      str_from_latin1(back, wide->data, wide->len) != 0 ||
+		      strcmp(back->data, "ascii run long enough for a vector, h\xC3\xA9llo ? ?") != 0))
+		fail = "Latin-1 round trip";
+
+	if (!fail && (str_utf8_valid(text, strlen(text)) != strlen(text) || str_utf8_valid("ab\xC0\xAF", 4) != 2))
+		fail = "overlong form accepted";
+
+	if (fail)
+		printf("str_transcode test failed: %s\n", fail);
+	else
+		printf("str_transcode test passed\n");
+	str_free(in);
+	str_free(wide);
+	str_free(back);
+}
+
+void test_str_normalize()
+{
+	static const struct {
+		const char *in;
+		const char *nfc;
+		const char *nfd;
+	} cases[] = {
+		{ "cafe\xCC\x81", "caf\xC3\xA9", "cafe\xCC\x81" },
+		{ "a\xCC\x81\xCC\xA3", "\xE1\xBA\xA1\xCC\x81", "a\xCC\xA3\xCC\x81" },		/* marks reordered */
+		{ "s\xCC\x87\xCC\xA3", "\xE1\xB9\xA9", "s\xCC\xA3\xCC\x87" },
+		{ "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB", "\xED\x95\x9C",			/* Hangul */
+		  "\xE1\x84\x92\xE1\x85\xA1\xE1\x86\xAB" },
+		{ "\xE2\x84\xAB ok", "\xC3\x85 ok", "A\xCC\x8A ok" },			/* Angstrom sign */
+	};
+
+	for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		str *c = str_init(), *d = str_init();
+		if (c == NULL || d == NULL || str_add(c, cases[i].in) != 0 || str_add(d, cases[i].in) != 0) {
+			printf("str_normalize test failed: setup failed\n");
+			str_free(c);
+			str_free(d);
+			return;
+		}
+		if (str_normalize_nfc(c) != 0 || strcmp(c->data, cases[i].nfc) != 0 ||
+		    str_normalize_nfd(d) != 0 || strcmp(d->data, cases[i].nfd) != 0) {
+			printf("str_normalize test failed: case %zu\n", i);
+			str_free(c);
+			str_free(d);
+			return;
+		}
+		str_free(c);
+		str_free(d);
+	}
+
+	// Text already in NFC is left in place
+	str *s = str_init();
+	if (s == NULL || str_add(s, "plain ASCII, then caf\xC3\xA9 and \xE4\xB8\x96\xE7\x95\x8C") != 0) {
+		printf("str_normalize test failed: setup failed\n");
+		str_free(s);
+		return;
+	}
+	const char *data = s->data;
+	if (str_normalize_nfc(s) != 0 || s->data != data || str_add(s, "\xFF") != 0 ||
+	    str_normalize_nfc(s) != -EILSEQ) {
+		printf("str_normalize test failed: quick check\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_normalize test passed\n");
+}
+
+void test_str_seg()
+{
+	/* Expected segments, separated by '|' */
+	static const struct {
+		int kind;
+		const char *segs;
+	} cases[] = {
+		{ STR_SEG_WORD, "can't| |stop|,| |3.14|+|x_1|." },
+		{ STR_SEG_WORD, "e.g|.|   |caf\xC3\xA9|\r\n|r\xC3\xA9" "e\xCC\x81sum\xC3\xA9" },
+		{ STR_SEG_WORD, "\xD7\xA6\xD7\x94\"\xD7\x9C| |\xE3\x82\xAB\xE3\x82\xBF\xE3\x82\xAB\xE3\x83\x8A|\xE4\xB8\xAD|\xE6\x96\x87" },
+		{ STR_SEG_WORD, "\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x92\xBB|"			/* emoji ZWJ sequence */
+				"\xF0\x9F\x87\xAB\xF0\x9F\x87\xB7|\xF0\x9F\x87\xAF\xF0\x9F\x87\xB5|"	/* two flags */
+				"\xF0\x9F\x87\xA9" },
+		{ STR_SEG_SENTENCE, "Mr. |Smith went to Washington. |He saw the U.S.A. |\"Why?\" |she asked." },
+		{ STR_SEG_SENTENCE, "Pi is 3.14 or so!  |Is it?\r\n|Next line\n|etc. and more." },
+	};
+
+	for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+		char text[128];
+		size_t len = 0;
+
+		for (const char *c = cases[i].segs; *c; c++)
+			if (*c != '|')
+				text[len++] = *c;
+
+		str_seg it;
+		const char *seg, *want = cases[i].segs;
+		size_t n;
+
+		str_seg_init(&it, text, len, cases[i].kind);
+		while (str_seg_next(&it, &seg, &n)) {
+			size_t want_len = strcspn(want, "|");
+
+			if (seg != text + it.pos - n || n != want_len || memcmp(seg, want, n) != 0) {
+				printf("str_seg test failed: case %zu at \"%.*s\"\n", i, (int)n, seg);
+				return;
+			}
+			want += want_len + (want[want_len] == '|');
+		}
+		if (*want != '\0') {
+			printf("str_seg test failed: case %zu ended early\n", i);
+			return;
+		}
+	}
+
+	// Punctuation and spaces are not words, ideographs and numbers are
+	str_seg it;
+	const char *seg;
+	size_t n, words = 0;
+
+	str_seg_init(&it, "A, b 42 \xE4\xB8\xAD!", 13, STR_SEG_WORD);
+	while (str_seg_next(&it, &seg, &n))
+		words += (size_t)it.is_word;
+	if (words != 4) {
+		printf("str_seg test failed: %zu words instead of 4\n", words);
+		return;
+	}
+
+	str *s = str_init();
+	if (s == NULL || str_add(s, "\"well,\" she said! then (quietly) left.   3 cats? ok") != 0 ||
+	    str_to_sentence_case(s, NULL) != 0 ||
+	    strcmp(s->data, "\"Well,\" she said! Then (quietly) left.   3 cats? Ok") != 0) {
+		printf("str_seg test failed: sentence case\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_seg test passed\n");
+}
+
+void test_str_diff()
+{
+	str *a = str_init(), *b = str_init(), *c = str_init();
+	str_edit *e = NULL;
+	const char *fail = NULL;
+
+	if (a == NULL || b == NULL || c == NULL ||
+	    str_add(a, "one\ntwo\nthree\nfour\nfive\n") != 0 ||
+	    str_add(b, "zero\none\nthree\nfour\n4.5\nfive") != 0 ||
+	    str_add(c, a->data) != 0)
+		fail = "setup failed";
+
+	// Lines: insert zero, delete two, insert 4.5, change the last line
+	if (!fail && (e = str_diff(a, b, STR_DIFF_LINES)) == NULL)
+		fail = "line diff failed";
+	if (!fail && (e->len != 3 ||
+		      e->hunks[0].a_off != 0 || e->hunks[0].a_len != 0 || e->hunks[0].b_len != 5 ||
+		      e->hunks[1].a_off != 4 || e->hunks[1].a_len != 4 || e->hunks[1].b_len != 0 ||
+		      e->hunks[2].a_off != 19 || e->hunks[2].a_len != 5 ||
+		      e->hunks[2].b_off != 20 || e->hunks[2].b_len != 8 ||
+		      memcmp(e->text, "zero\n4.5\nfive", 13) != 0))
+		fail = "wrong line hunks";
+	if (!fail && (str_patch(c, e) != 0 || strcmp(c->data, b->data) != 0))
+		fail = "line patch failed";
+	if (!fail && str_patch(c, e) != -EINVAL)
+		fail = "patched the wrong text";
+	str_edit_free(e);
+	e = NULL;
+
+	// Bytes
+	if (!fail && (e = str_diff(b, a, STR_DIFF_BYTES)) == NULL)
+		fail = "byte diff failed";
+	if (!fail && (str_patch(c, e) != 0 || strcmp(c->data, a->data) != 0))
+		fail = "byte patch failed";
+	str_edit_free(e);
+	e = NULL;
+
+	// Equal texts need no hunks
+	if (!fail && ((e = str_diff(a, c, STR_DIFF_LINES)) == NULL || e->len != 0))
+		fail = "equal texts differ";
+	str_edit_free(e);
+
+	str_free(a);
+	str_free(b);
+	str_free(c);
+	if (fail)
+		printf("str_diff test failed: %s\n", fail);
+	else
+		printf("str_diff test passed\n");
+}
+
+static const char *test_lookup(void *ctx, const char *name, size_t n, size_t *len)
+{
+	static const char *const vars[][2] = {
+		{ "user", "emrah" }, { "host", "example.org" }, { "empty", "" },
+	};
+
+	(*(int *)ctx)++;
+	for (size_t i = 0; i < sizeof(vars) / sizeof(vars[0]); i++) {
+		if (strlen(vars[i][0]) == n && memcmp(vars[i][0], name, n) == 0) {
+			*len = strlen(vars[i][1]);
+			return vars[i][1];
+		}
+	}
+	return NULL;
+}
+
+void test_str_expand()
+{
+	const char *tmpl = "${user}@${host}: ${missing} $user ${empty}[${user}] ${unclosed";
+	const char *want = "emrah@example.org: ${missing} $user [emrah] ${unclosed";
+	str *s = str_init(), *out = str_init();
+	str_tmpl *t = NULL;
+	const char *fail = NULL;
+	int calls = 0;
+
+	if (s == NULL || out == NULL || str_add(s, tmpl) != 0 || str_add(out, "> ") != 0)
+		fail = "setup failed";
+	if (!fail && (str_expand(s, test_lookup, &calls) != 0 || strcmp(s->data, want) != 0 || calls != 5))
+		fail = "str_expand";
+
+	// A compiled template appends, and can be rendered again
+	if (!fail && (t = str_tmpl_init(tmpl, strlen(tmpl))) == NULL)
+		fail = "str_tmpl_init";
+	if (!fail && (t->count != 5 || str_tmpl_render(t, out, test_lookup, &calls) != 0 ||
+		      str_tmpl_render(t, out, test_lookup, &calls) != 0 ||
+		      strncmp(out->data, "> ", 2) != 0 || strlen(out->data) != 2 + 2 * strlen(want) ||
+		      strncmp(out->data + 2, want, strlen(want)) != 0))
+		fail = "str_tmpl_render";
+
+	str_tmpl_free(t);
+	str_free(s);
+	str_free(out);
+	if (fail)
+		printf("str_expand test failed: %s\n", fail);
+	else
+		printf("str_expand test passed\n");
+}
+
+static int test_kv_is(const struct str_kv *kv, const char *key, const char *val)
+{
+	return kv->key_len == strlen(key) && memcmp(kv->key, key, kv->key_len) == 0 &&
+	       kv->val_len == strlen(val) && memcmp(kv->val, val, kv->val_len) == 0;
+}
+
+void test_str_parse_kv()
+{
+	const char *line = "ts=2024-05-01T12:00:00Z level=info debug msg=\"user said \\\"hi there\\\" "
+			   "and left, then came back much later\" empty= path=/a=b\r\n";
+	const char *headers = "Host: example.org\r\nAccept:  */* \r\nX-Empty:\r\nUser-Agent: t/1.0\n\r\nbody";
+	struct str_kv kv[8];
+	size_t used = 0;
+	const char *fail = NULL;
+
+	if (str_parse_logfmt(line, strlen(line), kv, 8) != 6 ||
+	    !test_kv_is(&kv[0], "ts", "2024-05-01T12:00:00Z") || !test_kv_is(&kv[1], "level", "info") ||
+	    !test_kv_is(&kv[2], "debug", "") || kv[2].quoted ||
+	    !test_kv_is(&kv[3], "msg", "user said \\\"hi there\\\" and left, then came back much later") ||
+	    !kv[3].quoted || !test_kv_is(&kv[4], "empty", "") || !test_kv_is(&kv[5], "path", "/a=b"))
+		fail = "logfmt pairs";
+	else if (str_parse_logfmt(line, strlen(line), kv, 2) != -ENOSPC || !test_kv_is(&kv[1], "level", "info"))
+		fail = "logfmt overflow";
+	else if (str_parse_logfmt("a=\"open", 7, kv, 8) != -EINVAL)
+		fail = "logfmt unclosed quote";
+	else if (str_parse_headers(headers, strlen(headers), kv, 8, &used) != 4 ||
+		 used != strlen(headers) - 4 || !test_kv_is(&kv[0], "Host", "example.org") ||
+		 !test_kv_is(&kv[1], "Accept", "*/*") || !test_kv_is(&kv[2], "X-Empty", "") ||
+		 !test_kv_is(&kv[3], "User-Agent", "t/1.0"))
+		fail = "header fields";
+	else if (str_parse_headers(headers, 30, kv, 8, &used) != -EAGAIN)
+		fail = "incomplete headers";
+	else if (str_parse_headers("A: 1\r\n folded\r\n\r\n", 18, kv, 8, &used) != -EINVAL ||
+		 str_parse_headers("A : 1\r\n\r\n", 9, kv, 8, &used) != -EINVAL)
+		fail = "malformed headers";
+
+	if (fail)
+		printf("str_parse_kv test failed: %s\n", fail);
+	else
+		printf("str_parse_kv test passed\n");
+}
+
+void test_str_rem_words()
+{
+	const char *stop[] = { "the", "a", "of", "and", "cat", "the" };
+	size_t lens[] = { 3, 1, 2, 3, 3, 3 };
+	str_wordset *set = str_wordset_init(stop, lens, 6, STR_WORDSET_ICASE);
+	str *s = str_init();
+	const char *fail = NULL;
+
+	if (!set || !s || str_add(s, "The story of a cat,\tthe dog and the concatenated Theory of the.\nA end"))
+		fail = "setup failed";
+	else if (set->count != 5 || !str_wordset_has(set, "THE", 3) || str_wordset_has(set, "th", 2) ||
+		 str_wordset_has(set, "cats", 4))
+		fail = "lookup";
+	else if (str_rem_words(s, set) != 10 ||
+		 strcmp(str_get_data(s), "story,\tdog concatenated Theory.\nend"))
+		fail = "removal";
+	else if (str_rem_words(s, set) != 0 || str_get_size(s) != 35)
+		fail = "nothing left to remove";
+	else if (str_wordset_init(stop, lens, 0, 0) || errno != EINVAL)
+		fail = "empty set";
+
+	if (fail)
+		printf("str_rem_words test failed: %s\n", fail);
+	else
+		printf("str_rem_words test passed\n");
+	str_wordset_free(set);
+	str_free(s);
+}
+
+void test_str_ref()
+{
+	str_ref a, b, c;
+	const char *long1 = "prefix-shared-long-string-one";
+	const char *long2 = "prefix-shared-long-string-two";
+
+	if (sizeof(str_ref) != 16) {
+		printf("str_ref test failed: header is not 16 bytes\n");
+		return;
+	}
+	if (str_ref_init(&a, "Hello", 5) != 0 || str_ref_init(&b, "Hello", 5) != 0) {
+		printf("str_ref test failed: unable to build inline header\n");
+		return;
+	}
+	if (!str_ref_eq(&a, &b) || str_ref_cmp(&a, &b) != 0) {
+		printf("str_ref test failed: equal inline headers differ\n");
+		return;
+	}
+	str_ref_init(&a, long1, strlen(long1));
+	str_ref_init(&b, long2, strlen(long2));
+	if (str_ref_eq(&a, &b) || str_ref_cmp(&a, &b) >= 0) {
+		printf("str_ref test failed: incorrect ordering of long headers\n");
+		return;
+	}
+	str_ref_init(&c, "prefix-shared", 13);
+	if (!str_ref_starts_with(&a, &c) || str_ref_starts_with(&c, &a)) {
+		printf("str_ref test failed: incorrect prefix check\n");
+		return;
+	}
+	str_ref_init(&c, "Hell", 4);
+	str_ref_init(&b, "Hello", 5);
+	if (str_ref_cmp(&c, &b) >= 0) {
+		printf("str_ref test failed: shorter string does not sort first\n");
+		return;
+	}
+	printf("str_ref test passed\n");
+}
+
+void test_str_vec_sort()
+{
+	const char *words[] = { "pear", "apple", "a-very-long-banana-name", "apple", "fig" };
+	str_vec *v = str_vec_init();
+	if (v == NULL) {
+		printf("str_vec_sort test failed: str_vec_init failed\n");
+		return;
+	}
+	for (size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+		if (str_vec_push(v, words[i], strlen(words[i])) != 0) {
+			printf("str_vec_sort test failed: unable to push\n");
+			str_vec_free(v);
+			return;
+		}
+	}
+	str_vec_sort(v);
+	for (size_t i = 1; i < v->len; i++) {
+		if (str_ref_cmp(&v->items[i - 1], &v->items[i]) > 0) {
+			printf("str_vec_sort test failed: vector not sorted\n");
+			str_vec_free(v);
+			return;
+		}
+	}
+	if (memcmp(str_ref_data(&v->items[0]), "a-very-long-banana-name", 23) != 0) {
+		printf("str_vec_sort test failed: incorrect first element\n");
+		str_vec_free(v);
+		return;
+	}
+	str_vec_free(v);
+	printf("str_vec_sort test passed\n");
+}
+
+void test_str_consume_front()
+{
+	str *s = str_init();
+	if (s == NULL) {
+		printf("str_consume_front test failed: str_init failed\n");
+		return;
+	}
+	str_add(s, "HDR1 HDR2 payload");
+	char *first = s->data;
+	if (str_pop_front(s, ' ') != 0 || str_consume_front(s, 5) != 0) {
+		printf("str_consume_front test failed: unable to consume\n");
+		str_free(s);
+		return;
+	}
+	if (strcmp(s->data, "payload") != 0 || s->data != first + 10) {
+		printf("str_consume_front test failed: bytes were moved or lost\n");
+		str_free(s);
+		return;
+	}
+	if (str_consume_front(s, 100) == 0) {
+		printf("str_consume_front test failed: consumed past the end\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_consume_front test passed\n");
+}
+
+void test_str_prepend()
+{
+	str *s = str_init();
+	if (s == NULL) {
+		printf("str_prepend test failed: str_init failed\n");
+		return;
+	}
+	str_add(s, "World");
+	if (str_prepend(s, "Hello ") != 0) {
+		printf("str_prepend test failed: unable to prepend\n");
+		str_free(s);
+		return;
+	}
+	for (int i = 0; i < 1000; i++)
+		str_prepend(s, ">");
+	// Prepending grows the headroom only, never the room after the contents
+	if (s->cap - s->len > STR_MIN_CAP) {
+		printf("str_prepend test failed: prepends inflated the tail capacity\n");
+		str_free(s);
+		return;
+	}
+	str_consume_front(s, 1000);
+	str_consume_front(s, 6);
+	str_prepend(s, "Hi ");
+	str_add(s, "!!!");
+	str_consume_front(s, 3);
+	if (strcmp(s->data, "World!!!") != 0) {
+		printf("str_prepend test failed: incorrect string after prepend\n");
+		str_free(s);
+		return;
+	}
+	for (int i = 0; i < 200; i++) {
+		str_add(s, "x");
+		str_consume_front(s, 1);
+	}
+	if (str_get_size(s) != 8 || strcmp(s->data, "xxxxxxxx") != 0) {
+		printf("str_prepend test failed: incorrect string after prepend\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_prepend test passed\n");
+}
+
+void test_str_ring()
+{
+	str_ring *r = str_ring_init(1);
+	if (r == NULL) {
+		printf("str_ring test failed: str_ring_init failed\n");
+		return;
+	}
+	size_t size = r->size;
+	int fds[2];
+	if (pipe(fds) != 0) {
+		printf("str_ring test failed: pipe failed\n");
+		str_ring_free(r);
+		return;
+	}
+	/*
+	 * Leave "ab" unread in the last bytes of the ring, so the next read
+	 * starts in its last byte and wraps around to the front.
+	 */
+	char *fill = calloc(1, size);
+	int filled = 0;
+	if (fill != NULL) {
+		fill[size - 3] = 'a';
+		fill[size - 2] = 'b';
+		filled = str_ring_add_n(r, fill, size - 1) == 0 && str_ring_consume(r, size - 3) == 0;
+		free(fill);
+	}
+	if (!filled) {
+		printf("str_ring test failed: unable to fill the ring\n");
+		close(fds[0]);
+		close(fds[1]);
+		str_ring_free(r);
+		return;
+	}
+
+	if (write(fds[1], "Hello World", 11) != 11 || str_ring_read(r, fds[0]) != 11) {
+		printf("str_ring test failed: unable to read into ring\n");
+		close(fds[0]);
+		close(fds[1]);
+		str_ring_free(r);
+		return;
+	}
+	close(fds[0]);
+	close(fds[1]);
+	if (str_ring_get_size(r) != 13 || r->head + 13 <= size ||
+	    memcmp(str_ring_data(r), "abHello World", 13) != 0 || memcmp(r->base, "ello World", 10) != 0) {
+		printf("str_ring test failed: wrapped data is not contiguous\n");
+		str_ring_free(r);
+		return;
+	}
+	str_ring_consume(r, 8);
+	if (memcmp(str_ring_data(r), "World", 5) != 0 || str_ring_add_n(r, "x", size) != -ENOSPC) {
+		printf("str_ring test failed: incorrect data after consume\n");
+		str_ring_free(r);
+		return;
+	}
+	str_ring_free(r);
+	printf("str_ring test passed\n");
+}
+
+void test_str_substr()
+{
+	str *s = str_init();
+	if (s == NULL) {
+		printf("str_substr test failed: str_init failed\n");
+		return;
+	}
+	str_add(s, "Hello World");
+	str *sub = str_substr(s, 6, 5);
+	str *mid = str_substr(s, 2, 3);
+	if (sub == NULL || mid == NULL || sub->data != s->data + 6) {
+		printf("str_substr test failed: substring was copied\n");
+		str_free(sub);
+		str_free(mid);
+		str_free(s);
+		return;
+	}
+	str_to_upper(sub);
+	if (strcmp(s->data, "Hello World") != 0 || strcmp(sub->data, "WORLD") != 0) {
+		printf("str_substr test failed: modification leaked into parent\n");
+		str_free(sub);
+		str_free(mid);
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	if (str_detach(mid) != 0 || strcmp(mid->data, "llo") != 0) {
+		printf("str_substr test failed: incorrect data after detach\n");
+		str_free(sub);
+		str_free(mid);
+		return;
+	}
+	if (str_substr(mid, 2, 5) != NULL) {
+		printf("str_substr test failed: out of range substring returned\n");
+	} else {
+		printf("str_substr test passed\n");
+	}
+	str_free(sub);
+	str_free(mid);
+}
+
+void test_str_load_file()
+{
+	char path[] = "/tmp/strutil_test_XXXXXX";
+	int fd = mkstemp(path);
+	if (fd < 0) {
+		printf("str_load_file test failed: mkstemp failed\n");
+		return;
+	}
+	if (write(fd, "Hello\0World\n", 12) != 12) {
+		printf("str_load_file test failed: write failed\n");
+		close(fd);
+		unlink(path);
+		return;
+	}
+	close(fd);
+
+	str *s = str_load_file(path);
+	unlink(path);
+	if (s == NULL) {
+		printf("str_load_file test failed: returned NULL\n");
+		return;
+	}
+	if (str_get_size(s) != 12 || memcmp(s->data, "Hello\0World\n", 13) != 0) {
+		printf("str_load_file test failed: incorrect data loaded\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+
+	int fds[2];
+	if (pipe(fds) != 0) {
+		printf("str_load_file test failed: pipe failed\n");
+		return;
+	}
+	if (write(fds[1], "piped", 5) != 5) {
+		printf("str_load_file test failed: write failed\n");
+		close(fds[0]);
+		close(fds[1]);
+		return;
+	}
+	close(fds[1]);
+	s = str_load_fd(fds[0]);
+	close(fds[0]);
+	if (s == NULL || strcmp(s->data, "piped") != 0) {
+		printf("str_load_file test failed: incorrect data from pipe\n");
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_load_file test passed\n");
+}
+
+static int append_file(const char *path, const char *text, int flags)
+{
+	int fd = open(path, O_WRONLY | O_CREAT | flags, 0600);
+	if (fd < 0)
+		return -1;
+	ssize_t n = write(fd, text, strlen(text));
+	close(fd);
+	return n == (ssize_t)strlen(text) ? 0 : -1;
+}
+
+void test_str_follow()
+{
+	char dir[] = "/tmp/strutil_follow_XXXXXX";
+	char path[64], rotated[64];
+	const char *line;
+	size_t len;
+
+	if (mkdtemp(dir) == NULL) {
+		printf("str_follow test failed: mkdtemp failed\n");
+		return;
+	}
+	snprintf(path, sizeof(path), "%s/log", dir);
+	snprintf(rotated, sizeof(rotated), "%s/log.1", dir);
+	append_file(path, "first\nsec", O_TRUNC);
+
+	str_follow *f = str_follow_open(path, 0);
+	if (f == NULL) {
+		printf("str_follow test failed: str_follow_open failed\n");
+		rmdir(dir);
+		return;
+	}
+	if (str_follow_next(f, &line, &len) != 1 || len != 5 || memcmp(line, "first", 5) != 0 ||
+	    str_follow_next(f, &line, &len) != 0) {
+		printf("str_follow test failed: incorrect initial lines\n");
+		goto out;
+	}
+
+	append_file(path, "ond\nthird\n", O_APPEND);
+	if (str_follow_wait(f, 1000) < 0 || str_follow_next(f, &line, &len) != 1 ||
+	    len != 6 || memcmp(line, "second", 6) != 0 ||
+	    str_follow_next(f, &line, &len) != 1 || memcmp(line, "third", 5) != 0) {
+		printf("str_follow test failed: appended lines not returned\n");
+		goto out;
+	}
+
+	append_file(path, "new\n", O_TRUNC);
+	if (str_follow_next(f, &line, &len) != 1 || len != 3 || memcmp(line, "new", 3) != 0) {
+		printf("str_follow test failed: truncation not handled\n");
+		goto out;
+	}
+
+	append_file(path, "old tail\n", O_APPEND);
+	rename(path, rotated);
+	append_file(path, "rotated\n", O_TRUNC);
+	if (str_follow_next(f, &line, &len) != 1 || memcmp(line, "old tail", 8) != 0 ||
+	    str_follow_next(f, &line, &len) != 1 || len != 7 || memcmp(line, "rotated", 7) != 0) {
+		printf("str_follow test failed: rotation not handled\n");
+		goto out;
+	}
+
+	// Without inotify, waiting with no timeout still returns to poll the file
+	if (f->ifd >= 0)
+		close(f->ifd);
+	f->ifd = -1;
+	append_file(path, "polled\n", O_APPEND);
+	if (str_follow_wait(f, -1) != 0 || str_follow_next(f, &line, &len) != 1 || len != 6 ||
+	    memcmp(line, "polled", 6) != 0) {
+		printf("str_follow test failed: polling fallback not handled\n");
+		goto out;
+	}
+	printf("str_follow test passed\n");
+out:
+	str_follow_close(f);
+	unlink(path);
+	unlink(rotated);
+	rmdir(dir);
+}
+
+/* Sends a length word with @n descriptors attached, as a misbehaving peer might. */
+static int send_fds(int sock, const int *fds, int n)
+{
+	uint64_t len = 11;
+	struct iovec iov = { &len, sizeof(len) };
+	union {
+		struct cmsghdr hdr;
+		char buf[CMSG_SPACE(4 * sizeof(int))];
+	} ctl;
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+	memset(&ctl, 0, sizeof(ctl));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = ctl.buf;
+	msg.msg_controllen = CMSG_SPACE(n * sizeof(int));
+
+	struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(n * sizeof(int));
+	memcpy(CMSG_DATA(cmsg), fds, n * sizeof(int));
+	return sendmsg(sock, &msg, 0) == (ssize_t)sizeof(len) ? 0 : -1;
+}
+
+void test_str_shared()
+{
+	int sv[2];
+	str *s = str_init_shared(16);
+	if (s == NULL) {
+		printf("str_shared test failed: str_init_shared failed\n");
+		return;
+	}
+	if (str_add(s, "Hello World") != 0 || str_add(s, " too long") != -ENOSPC) {
+		printf("str_shared test failed: incorrect capacity handling\n");
+		str_free(s);
+		return;
+	}
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+		printf("str_shared test failed: socketpair failed\n");
+		str_free(s);
+		return;
+	}
+	if (str_shared_seal(s) != 0 || str_shared_send(s, sv[0]) != 0) {
+		printf("str_shared test failed: unable to seal and send\n");
+		close(sv[0]);
+		close(sv[1]);
+		str_free(s);
+		return;
+	}
+	str *r = str_shared_recv(sv[1]);
+	close(sv[0]);
+	close(sv[1]);
+	if (r == NULL || str_get_size(r) != 11 || strcmp(r->data, "Hello World") != 0) {
+		printf("str_shared test failed: incorrect data received\n");
+		str_free(r);
+		str_free(s);
+		return;
+	}
+	if (str_to_upper(r) == 0 || str_add(r, "!") != -EPERM || str_add(s, "!") != -EPERM) {
+		printf("str_shared test failed: read-only string was modified\n");
+		str_free(r);
+		str_free(s);
+		return;
+	}
+	str_free(r);
+
+	// Extra descriptors are refused and closed; a clean shutdown is not an error
+	int lowest = dup(STDOUT_FILENO), two[2] = { s->fd, s->fd };
+	close(lowest);
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) != 0) {
+		printf("str_shared test failed: socketpair failed\n");
+		str_free(s);
+		return;
+	}
+	int sent = send_fds(sv[0], two, 2);
+	r = str_shared_recv(sv[1]);
+	int bad_errno = errno;
+	close(sv[0]);
+	str *eof = str_shared_recv(sv[1]);
+	int eof_errno = errno;
+	close(sv[1]);
+	int after = dup(STDOUT_FILENO);
+	close(after);
+	if (sent != 0 || r != NULL || bad_errno != EPROTO || eof != NULL || eof_errno != 0 ||
+	    after != lowest) {
+		printf("str_shared test failed: malformed message or shutdown mishandled\n");
+		str_free(r);
+		str_free(eof);
+		str_free(s);
+		return;
+	}
+	str_free(s);
+	printf("str_shared test passed\n");
+}
+
+void test_str_frame()
+{
+	int fds[2];
+	const char *frame;
+	size_t len;
+
+	if (str_crc32c(0, "123456789", 9) != 0xe3069283) {
+		printf("str_frame test failed: incorrect CRC32C\n");
+		return;
+	}
+	if (pipe(fds) != 0) {
+		printf("str_frame test failed: pipe failed\n");
+		return;
+	}
+	str_frame_writer *w = str_frame_writer_init(fds[1]);
+	str_frame_reader *r = str_frame_reader_init(fds[0]);
+	if (w == NULL || r == NULL) {
+		printf("str_frame test failed: unable to create streams\n");
+		goto out;
+	}
+	if (str_frame_write(w, "Hello\nWorld", 11, 0) != 0 ||
+	    str_frame_write(w, "bin\0ary", 7, STR_FRAME_CRC) != 0 ||
+	    str_frame_write(w, "", 0, STR_FRAME_CRC) != 0 ||
+	    str_frame_flush(w) != 0) {
+		printf("str_frame test failed: unable to write frames\n");
+		goto out;
+	}
+	close(fds[1]);
+	fds[1] = -1;
+
+	if (str_frame_read(r, &frame, &len) != 1 || len != 11 || memcmp(frame, "Hello\nWorld", 11) != 0 ||
+	    str_frame_read(r, &frame, &len) != 1 || len != 7 || memcmp(frame, "bin\0ary", 7) != 0 ||
+	    str_frame_read(r, &frame, &len) != 1 || len != 0 ||
+	    str_frame_read(r, &frame, &len) != 0) {
+		printf("str_frame test failed: incorrect frames read\n");
+		goto out;
+	}
+	printf("str_frame test passed\n");
+out:
+	str_frame_writer_free(w);
+	str_frame_reader_free(r);
+	close(fds[0]);
+	if (fds[1] >= 0)
+		close(fds[1]);
+}
+
+#ifdef STR_METRICS
+void test_str_metrics()
+{
+	struct str_metric_stats st[STR_M_COUNT];
+	str *s = str_init();
+	if (s == NULL) {
+		printf("str_metrics test failed: str_init failed\n");
+		return;
+	}
+	str_metrics_reset();
+	for (int i = 0; i < 1000; i++)
+		str_add(s, "Hello World ");
+	str_swap_word(s, "World", "There");
+	str_free(s);
+
+	if (str_metrics_snapshot(st, STR_M_COUNT) != STR_M_COUNT) {
+		printf("str_metrics test failed: incomplete snapshot\n");
+		return;
+	}
+	/* str_add calls str_add_n internally; only the outer call counts. */
+	if (st[STR_M_ADD].calls != 1000 || st[STR_M_ADD_N].calls != 0 ||
+	    st[STR_M_SWAP_WORD].calls != 1 || st[STR_M_SWAP_WORD].size_max < 11000) {
+		printf("str_metrics test failed: incorrect call counts\n");
+		return;
+	}
+	if (st[STR_M_ADD].lat_p50_ns > st[STR_M_ADD].lat_p99_ns ||
+	    st[STR_M_ADD].lat_p99_ns > st[STR_M_ADD].lat_max_ns) {
+		printf("str_metrics test failed: percentiles out of order\n");
+		return;
+	}
+	printf("str_metrics test passed\n");
+}
+#endif
+
+#ifdef STR_ALLOC_PROFILE
+/* Appends from a function of its own; returns where it returns to in its caller. */
+static __attribute__((noinline)) void *alloc_site_probe(str *s)
+{
+	for (int i = 0; i < 100; i++)
+		str_add(s, "probe ");
+	return __builtin_return_address(0);
+}
+
+void test_str_alloc_profile()
+{
+	struct str_alloc_site_stats sites[8];
+	struct str_alloc_waste waste[8];
+	str *s = str_init();
+	str *t = str_init();
+	if (s == NULL || t == NULL) {
+		printf("str_alloc_profile test failed: str_init failed\n");
+		str_free(s);
+		str_free(t);
+		return;
+	}
+	// Sites are the callers of str_*, even where the compiler could inline them
+	str *w = str_init();
+	str_alloc_profile_rate(1);
+	str_alloc_profile_reset();
+	void *caller = w ? alloc_site_probe(w) : NULL;
+	uintptr_t probe = (uintptr_t)alloc_site_probe;
+	int n = str_alloc_report(sites, 8, 0);
+
+	str_free(w);
+	for (int i = 0; i < n; i++) {
+		uintptr_t at = (uintptr_t)sites[i].site;
+		if (sites[i].site == caller || at <= probe || at >= probe + 512)
+			n = 0;
+	}
+	if (n < 1) {
+		printf("str_alloc_profile test failed: allocations not charged to the calling function\n");
+		str_free(s);
+		str_free(t);
+		return;
+	}
+
+	// Count only the allocations made below, whatever earlier tests sampled
+	str_alloc_profile_reset();
+	for (int i = 0; i < 100; i++)
+		str_add(s, "Hello World ");
+	str_add(t, "short 0123456789012345678901234567890123456789012345678901234567890123");
+	str_pop_back(t, ' ');
+
+	// The copy made to unshare a substring belongs to the call that caused it
+	str *u = str_substr(s, 0, 5);
+	if (u == NULL || str_to_upper(u) != 0) {
+		printf("str_alloc_profile test failed: str_substr or str_to_upper failed\n");
+		str_free(u);
+		str_free(s);
+		str_free(t);
+		return;
+	}
+	str_free(u);
+
+	int repeated = 0;
+
+	n = str_alloc_report(sites, 8, 1);
+	for (int i = 0; i < n; i++) {
+		if (sites[i].site == NULL)
+			n = 0;
+		else if (sites[i].count >= 2)
+			repeated = 1;
+	}
+	if (n < 3 || !repeated) {
+		printf("str_alloc_profile test failed: call site not recorded\n");
+		str_free(s);
+		str_free(t);
+		return;
+	}
+	n = str_alloc_waste_report(waste, 8, 16);
+	if (n != 1 || waste[0].s != t || waste[0].len != 5) {
+		printf("str_alloc_profile test failed: wasteful string not reported\n");
+		str_free(s);
+		str_free(t);
+		return;
+	}
+	str_free(s);
+	str_free(t);
+	if (str_alloc_waste_report(waste, 8, 0) != 0) {
+		printf("str_alloc_profile test failed: freed string still reported\n");
+		return;
+	}
+	printf("str_alloc_profile test passed\n");
+}
+#endif
+
+/* Removes then replaces a needle throughout a large, adversarial corpus. */
+void test_str_corpus()
+{
+	struct corpus_opts opts;
+	const char *needle = "aaaab", *repl = "######";
+	char *text, *ref;
+	size_t ref_len, hits = 0;
+	str *s = NULL;
+
+	corpus_defaults(&opts, 42, 1 << 16);
+	opts.utf8_pct = 30;
+	opts.lines = CORPUS_LINES_GEOMETRIC;
+	opts.needle = needle;
+	opts.needle_permille = 5;
+	opts.adv_len = 300;
+	opts.adv_pct = 2;
+
+	text = corpus_generate(&opts);
+	ref = malloc(2 * opts.size + 1);
+	if (!text || !ref || !(s = str_init()) || str_add_n(s, text, opts.size)) {
+		printf("str_corpus test failed: setup failed\n");
+		goto out;
+	}
+
+	/* reference: every occurrence replaced, left to right */
+	ref_len = 0;
+	for (const char *p = text, *m; ; p = m + 5, hits++) {
+		if (!(m = strstr(p, needle))) {
+			strcpy(ref + ref_len, p);
+			ref_len += strlen(p);
+			break;
+		}
+		memcpy(ref + ref_len, p, m - p);
+		ref_len += m - p;
+		memcpy(ref + ref_len, repl, 6);
+		ref_len += 6;
+	}
+
+	while (str_swap_word(s, needle, repl) == 0)
+		;
+	if (hits < 100 || str_get_size(s) != ref_len || memcmp(s->data, ref, ref_len)) {
+		printf("str_corpus test failed: str_swap_word result differs\n");
+		goto out;
+	}
+
+	while (str_rem_word(s, repl) == 0)
+		;
+	if (str_get_size(s) != opts.size - 5 * hits || strstr(s->data, repl)) {
+		printf("str_corpus test failed: str_rem_word result differs\n");
+		goto out;
+	}
+	printf("str_corpus test passed\n");
+out:
+	str_free(s);
+	free(ref);
+	free(text);
+}
+
 int main()
 {
 	test_str_init();
@@ -147,6 +1372,35 @@ int main()
 	test_str_get_size();
 	test_str_rem_word();
 	test_str_swap_word();
+	test_str_swap_all();
+	test_str_to_title_case();
+	test_str_corpus();
+	test_str_find();
+	test_str_wrap();
+	test_str_display_width();
+	test_str_transcode();
+	test_str_normalize();
+	test_str_seg();
+	test_str_diff();
+	test_str_expand();
+	test_str_parse_kv();
+	test_str_rem_words();
+	test_str_ref();
+	test_str_vec_sort();
+	test_str_consume_front();
+	test_str_prepend();
+	test_str_ring();
+	test_str_substr();
+	test_str_load_file();
+	test_str_follow();
+	test_str_shared();
+	test_str_frame();
+#ifdef STR_METRICS
+	test_str_metrics();
+#endif
+#ifdef STR_ALLOC_PROFILE
+	test_str_alloc_profile();
+#endif
 	
 	return 0;
 }
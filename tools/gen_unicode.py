@@ -0,0 +1,378 @@
+#!/usr/bin/env python3
+"""Regenerates the Unicode tables embedded in strutil.h.
+
+The display width, normalization and segmentation tables are written
+between the "UNICODE TABLES" markers. They are built from the Unicode
+Character Database shipped with Python's unicodedata module, so the Unicode
+version follows the Python running this script. The segmentation properties
+come from Perl's Unicode::UCD, which has to be of the same Unicode version.
+
+    python3 tools/gen_unicode.py [path/to/strutil.h]
+"""
+
+import os
+import subprocess
+import sys
+import unicodedata
+
+BEGIN = "/* UNICODE TABLES -> */"
+END = "/* <- UNICODE TABLES */"
+
+# The two-level tables cover planes 0 to 3; above them only the zero-width
+# ranges are listed and every other code point is one column wide.
+TABLE_LIMIT = 0x40000
+WIDTH_SHIFT = 7
+
+# Format characters that are drawn in front of the digits they apply to
+# (Prepended_Concatenation_Mark, which unicodedata does not expose).
+PREPENDED_MARKS = set(range(0x0600, 0x0606)) | {0x06DD, 0x070F, 0x0890, 0x0891,
+                                               0x08E2, 0x110BD, 0x110CD}
+
+
+def width(cp):
+    """Display columns of @cp, following the usual wcwidth() conventions."""
+    if cp < 0x20 or 0x7F <= cp < 0xA0:
+        return 0
+    if cp == 0xAD or cp in PREPENDED_MARKS:  # soft hyphen shows at a line break
+        return 1
+    c = chr(cp)
+    cat = unicodedata.category(c)
+    if cat in ("Mn", "Me", "Cf") or cp == 0x200B:
+        return 0
+    if 0x1160 <= cp <= 0x11FF or 0xD7B0 <= cp <= 0xD7FF:
+        return 0  # Hangul medial vowels and final consonants join the syllable
+    if 0x20000 <= cp <= 0x2FFFD or 0x30000 <= cp <= 0x3FFFD:
+        return 2
+    if cat != "Cn" and unicodedata.east_asian_width(c) in ("W", "F"):
+        return 2
+    return 1
+
+
+def hex_rows(values, fmt, per_row, indent="\t"):
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append(indent + ", ".join(fmt % v for v in values[i:i + per_row]) + ",")
+    return rows
+
+
+def width_tables():
+    block = 1 << WIDTH_SHIFT
+    blocks, stage1 = {}, []
+    for b in range(TABLE_LIMIT >> WIDTH_SHIFT):
+        w = [width((b << WIDTH_SHIFT) + i) for i in range(block)]
+        packed = tuple(sum(w[i + k] << (2 * k) for k in range(4)) for i in range(0, block, 4))
+        stage1.append(blocks.setdefault(packed, len(blocks)))
+    assert len(blocks) <= 256
+
+    ranges = []
+    for cp in range(TABLE_LIMIT, 0x110000):
+        if width(cp) == 0:
+            if ranges and ranges[-1][1] == cp - 1:
+                ranges[-1][1] = cp
+            else:
+                ranges.append([cp, cp])
+        else:
+            assert width(cp) == 1
+
+    out = [
+        "#define STR_WIDTH_SHIFT\t%d" % WIDTH_SHIFT,
+        "#define STR_WIDTH_LIMIT\t0x%X" % TABLE_LIMIT,
+        "",
+        "/* Block in str_width_stage2 for each 1 << STR_WIDTH_SHIFT code points. */",
+        "static const uint8_t str_width_stage1[%d] = {" % len(stage1),
+    ]
+    out += hex_rows(stage1, "%3d", 16)
+    out += [
+        "};",
+        "",
+        "/*",
+        " * Widths packed four to a byte, lowest code point in the low bits, in",
+        " * blocks of (1 << STR_WIDTH_SHIFT) / 4 bytes.",
+        " */",
+        "static const uint8_t str_width_stage2[%d] = {" % (len(blocks) * block // 4),
+    ]
+    out += hex_rows([v for packed in blocks for v in packed], "0x%02x", 16)
+    out += [
+        "};",
+        "",
+        "/* Zero-width ranges at or above STR_WIDTH_LIMIT. */",
+        "static const uint32_t str_width_zero_high[%d][2] = {" % len(ranges),
+    ]
+    out += ["\t{ 0x%05X, 0x%05X }," % (a, b) for a, b in ranges]
+    out.append("};")
+    return out
+
+
+# Normalization properties are only tabled below NORM_LIMIT; everything
+# above it is a starter that neither decomposes nor composes.
+NORM_LIMIT = 0x30000
+NORM_SHIFT = 6
+
+NFD_NO, NFC_NO, NFC_MAYBE = 0x01, 0x02, 0x04
+
+
+def is_hangul_syllable(cp):
+    return 0xAC00 <= cp <= 0xD7A3
+
+
+def norm_tables():
+    decomp, pairs = {}, {}
+    for cp in range(0x110000):
+        if 0xD800 <= cp <= 0xDFFF:
+            continue
+        c = chr(cp)
+        d = unicodedata.normalize("NFD", c)
+        if d != c and not is_hangul_syllable(cp):
+            decomp[cp] = [ord(x) for x in d]
+        # Primary composites: two-character canonical mappings NFC keeps
+        dm = unicodedata.decomposition(c)
+        if dm and not dm.startswith("<"):
+            parts = [int(x, 16) for x in dm.split()]
+            if len(parts) == 2 and unicodedata.normalize("NFC", d) == c:
+                pairs[tuple(parts)] = cp
+    # Hangul is composed algorithmically, but its vowels and trailing
+    # consonants still combine with what precedes them.
+    seconds = {b for _, b in pairs} | set(range(0x1161, 0x1176)) | set(range(0x11A8, 0x11C3))
+
+    def prop(cp):
+        if 0xD800 <= cp <= 0xDFFF:
+            return (0, 0)
+        c = chr(cp)
+        qc = NFD_NO if unicodedata.normalize("NFD", c) != c else 0
+        qc |= NFC_NO if unicodedata.normalize("NFC", c) != c else 0
+        qc |= NFC_MAYBE if cp in seconds else 0
+        return (unicodedata.combining(c), qc)
+
+    for cp in range(NORM_LIMIT, 0x110000):
+        assert prop(cp) == (0, 0)
+
+    props = {(0, 0): 0}
+    blocks, stage1 = {}, []
+    for b in range(NORM_LIMIT >> NORM_SHIFT):
+        blk = tuple(props.setdefault(prop((b << NORM_SHIFT) + i), len(props))
+                    for i in range(1 << NORM_SHIFT))
+        stage1.append(blocks.setdefault(blk, len(blocks)))
+    assert len(blocks) <= 256 and len(props) <= 256
+
+    index, data = [], []
+    for cp in sorted(decomp):
+        d = decomp[cp]
+        assert 1 <= len(d) <= 4 and len(data) < (1 << 14)
+        index.append((len(data) << 2) | (len(d) - 1))
+        data += d
+
+    out = [
+        "",
+        "#define STR_NORM_SHIFT\t%d" % NORM_SHIFT,
+        "#define STR_NORM_LIMIT\t0x%X" % NORM_LIMIT,
+        "#define STR_NORM_NFD_NO\t0x%02x\t/* has a canonical decomposition */" % NFD_NO,
+        "#define STR_NORM_NFC_NO\t0x%02x\t/* cannot appear in NFC */" % NFC_NO,
+        "#define STR_NORM_NFC_MAYBE\t0x%02x\t/* may compose with the previous character */" % NFC_MAYBE,
+        "",
+        "/* Canonical combining class and STR_NORM_* flags, by property index. */",
+        "static const uint8_t str_norm_props[%d][2] = {" % len(props),
+    ]
+    out += hex_rows(["{ %3d, %d }" % p for p in props], "%s", 6)
+    out += [
+        "};",
+        "",
+        "/* Block in str_norm_stage2 for each 1 << STR_NORM_SHIFT code points. */",
+        "static const uint8_t str_norm_stage1[%d] = {" % len(stage1),
+    ]
+    out += hex_rows(stage1, "%3d", 16)
+    out += [
+        "};",
+        "",
+        "/* Property index of each code point, in blocks of 1 << STR_NORM_SHIFT. */",
+        "static const uint8_t str_norm_stage2[%d] = {" % (len(blocks) << NORM_SHIFT),
+    ]
+    out += hex_rows([v for blk in blocks for v in blk], "%2d", 16)
+    out += [
+        "};",
+        "",
+        "/* Code points with a full canonical decomposition, Hangul excepted. */",
+        "static const uint32_t str_nfd_cps[%d] = {" % len(index),
+    ]
+    out += hex_rows(sorted(decomp), "0x%05X", 8)
+    out += [
+        "};",
+        "",
+        "/* Per str_nfd_cps entry: offset into str_nfd_data << 2 | (length - 1). */",
+        "static const uint16_t str_nfd_index[%d] = {" % len(index),
+    ]
+    out += hex_rows(index, "0x%04x", 8)
+    out += [
+        "};",
+        "",
+        "static const uint32_t str_nfd_data[%d] = {" % len(data),
+    ]
+    out += hex_rows(data, "0x%05X", 8)
+    out += [
+        "};",
+        "",
+        "/* Primary composites as { first, second, composite }, sorted. */",
+        "static const uint32_t str_nfc_pairs[%d][3] = {" % len(pairs),
+    ]
+    out += hex_rows(["{ 0x%05X, 0x%05X, 0x%05X }" % (a, b, pairs[(a, b)]) for a, b in sorted(pairs)],
+                    "%s", 3)
+    out.append("};")
+    return out
+
+
+# Segmentation properties (UAX #29) come from Perl's Unicode::UCD, since
+# unicodedata does not expose Word_Break or Sentence_Break.
+WORD_BREAK = ["Other", "CR", "LF", "Newline", "Extend", "ZWJ", "Regional_Indicator",
+              "Format", "Katakana", "Hebrew_Letter", "ALetter", "Single_Quote",
+              "Double_Quote", "MidNumLet", "MidLetter", "MidNum", "Numeric",
+              "ExtendNumLet", "WSegSpace"]
+SENTENCE_BREAK = ["Other", "CR", "LF", "Extend", "Sep", "Format", "Sp", "Lower", "Upper",
+                  "OLetter", "Numeric", "ATerm", "SContinue", "STerm", "Close"]
+SEG_LIMIT = 0x20000
+SEG_SHIFT2, SEG_SHIFT3 = 3, 4
+
+PERL_DUMP = r"""
+use Unicode::UCD qw(prop_invlist);
+print Unicode::UCD::UnicodeVersion(), "\n";
+print join(" ", $_, prop_invlist($_)), "\n" for @ARGV;
+"""
+
+
+def perl_props(names):
+    """Inversion lists of the binary properties @names, as {name: [(lo, hi)]}."""
+    out = subprocess.run(["perl", "-e", PERL_DUMP] + names, check=True,
+                         capture_output=True, text=True).stdout.splitlines()
+    if out[0] != unicodedata.unidata_version:
+        sys.exit("perl has Unicode %s, python %s" % (out[0], unicodedata.unidata_version))
+    ranges = {}
+    for line in out[1:]:
+        name, *bounds = line.split()
+        bounds = [int(x) for x in bounds] + ([0x110000] if len(bounds) % 2 else [])
+        ranges[name] = list(zip(bounds[0::2], bounds[1::2]))
+    return ranges
+
+
+def seg_tables():
+    names = ["Word_Break=" + v for v in WORD_BREAK[1:]]
+    names += ["Sentence_Break=" + v for v in SENTENCE_BREAK[1:]]
+    names.append("Extended_Pictographic")
+    ranges = perl_props(names)
+
+    wb, sb, ep = [0] * 0x110000, [0] * 0x110000, [0] * 0x110000
+    for name, rs in ranges.items():
+        prop, _, value = name.partition("=")
+        for lo, hi in rs:
+            for cp in range(lo, hi):
+                if prop == "Word_Break":
+                    wb[cp] = WORD_BREAK.index(value)
+                elif prop == "Sentence_Break":
+                    sb[cp] = SENTENCE_BREAK.index(value)
+                else:
+                    ep[cp] = 1
+
+    props = {(0, 0, 0): 0}
+    index = [props.setdefault((wb[cp], sb[cp], ep[cp]), len(props)) for cp in range(0x110000)]
+    assert len(props) <= 256
+
+    # Three levels: leaves of 1 << SEG_SHIFT3 property indexes, and middle
+    # blocks of 1 << SEG_SHIFT2 leaf numbers.
+    leaves, mid = {}, []
+    for b in range(SEG_LIMIT >> SEG_SHIFT3):
+        leaf = tuple(index[b << SEG_SHIFT3:(b + 1) << SEG_SHIFT3])
+        mid.append(leaves.setdefault(leaf, len(leaves)))
+    blocks, top = {}, []
+    for b in range(len(mid) >> SEG_SHIFT2):
+        blk = tuple(mid[b << SEG_SHIFT2:(b + 1) << SEG_SHIFT2])
+        top.append(blocks.setdefault(blk, len(blocks)))
+    assert len(blocks) <= 256 and len(leaves) <= 0x10000
+
+    high = []
+    for cp in range(SEG_LIMIT, 0x110000):
+        if index[cp]:
+            if high and high[-1][1] == cp - 1 and high[-1][2] == index[cp]:
+                high[-1][1] = cp
+            else:
+                high.append([cp, cp, index[cp]])
+
+    def enum(prefix, values):
+        names = ["STR_%s_%s" % (prefix, v.upper()) for v in values]
+        lines = hex_rows(names, "%s", 4)
+        return ["enum str_%s {" % prefix.lower()] + lines + ["\tSTR_%s_COUNT" % prefix, "};"]
+
+    out = [""]
+    out += enum("WB", WORD_BREAK)
+    out += [""]
+    out += enum("SB", SENTENCE_BREAK)
+    out += [
+        "",
+        "#define STR_SEG_SHIFT2\t%d" % SEG_SHIFT2,
+        "#define STR_SEG_SHIFT3\t%d" % SEG_SHIFT3,
+        "#define STR_SEG_LIMIT\t0x%X" % SEG_LIMIT,
+        "",
+        "/* Word_Break, Sentence_Break and Extended_Pictographic, by property index. */",
+        "static const uint8_t str_seg_props[%d][3] = {" % len(props),
+    ]
+    out += hex_rows(["{ %2d, %2d, %d }" % p for p in props], "%s", 6)
+    out += [
+        "};",
+        "",
+        "/* Middle block for each 1 << (STR_SEG_SHIFT2 + STR_SEG_SHIFT3) code points. */",
+        "static const uint8_t str_seg_stage1[%d] = {" % len(top),
+    ]
+    out += hex_rows(top, "%3d", 16)
+    out += [
+        "};",
+        "",
+        "/* Leaf for each 1 << STR_SEG_SHIFT3 code points, in blocks of 1 << STR_SEG_SHIFT2. */",
+        "static const uint16_t str_seg_stage2[%d] = {" % (len(blocks) << SEG_SHIFT2),
+    ]
+    out += hex_rows([v for blk in blocks for v in blk], "%3d", 16)
+    out += [
+        "};",
+        "",
+        "/* Property index of each code point, in leaves of 1 << STR_SEG_SHIFT3. */",
+        "static const uint8_t str_seg_stage3[%d] = {" % (len(leaves) << SEG_SHIFT3),
+    ]
+    out += hex_rows([v for leaf in leaves for v in leaf], "%2d", 16)
+    out += [
+        "};",
+        "",
+        "/* Property index of each ASCII character, skipping the stages. */",
+        "static const uint8_t str_seg_ascii[128] = {",
+    ]
+    out += hex_rows(index[:128], "%2d", 16)
+    out += [
+        "};",
+        "",
+        "/* Property index of the code points at or above STR_SEG_LIMIT not in index 0. */",
+        "static const uint32_t str_seg_high[%d][3] = {" % len(high),
+    ]
+    out += ["\t{ 0x%05X, 0x%05X, %2d }," % tuple(r) for r in high]
+    out.append("};")
+    return out
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else \
+        os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "strutil.h")
+    with open(path, "rb") as f:
+        text = f.read().decode("utf-8")
+    eol = "\r\n" if "\r\n" in text else "\n"
+    text = text.replace("\r\n", "\n")
+
+    start = text.index(BEGIN) + len(BEGIN)
+    end = text.index(END)
+    body = [
+        "/* Generated by tools/gen_unicode.py from Unicode %s, do not edit. */"
+        % unicodedata.unidata_version,
+    ]
+    body += width_tables()
+    body += norm_tables()
+    body += seg_tables()
+    text = text[:start] + "\n" + "\n".join(body) + "\n" + text[end:]
+
+    with open(path, "wb") as f:
+        f.write(text.replace("\n", eol).encode("utf-8"))
+
+
+if __name__ == "__main__":
+    main()